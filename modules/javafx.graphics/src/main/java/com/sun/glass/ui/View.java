@@ -798,6 +798,34 @@ public abstract class View {
         }
     }
 
+    /**
+     * Uploads only the given areas of the pixels. Platforms that cannot
+     * present partial updates upload the whole frame.
+     */
+    protected void _uploadPixels(long ptr, Pixels pixels, int[] dirtyRects, int dirtyRectCount) {
+        _uploadPixels(ptr, pixels);
+    }
+
+    /**
+     * This method dumps the pixels on to the view, updating only the areas
+     * that changed since the previous upload. The pixels must still hold the
+     * complete frame.
+     *
+     * @param pixels the frame
+     * @param dirtyRects x, y, width, height quadruples in pixel coordinates
+     * @param dirtyRectCount the number of rectangles in dirtyRects
+     */
+    public void uploadPixels(Pixels pixels, int[] dirtyRects, int dirtyRectCount) {
+        Application.checkEventThread();
+        checkNotClosed();
+        lock();
+        try {
+            _uploadPixels(this.ptr, pixels, dirtyRects, dirtyRectCount);
+        } finally {
+            unlock();
+        }
+    }
+
 
     //-------- FULLSCREEN --------//
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -219,7 +219,11 @@ final class GtkApplication extends Application implements
         final boolean disableGrab = (Boolean.getBoolean("sun.awt.disablegrab") ||
                Boolean.getBoolean("glass.disableGrab"));
 
-        _init(eventProc, disableGrab);
+        // Software rendered frames are presented through MIT-SHM when the
+        // X server supports it
+        final boolean disableShm = Boolean.getBoolean("glass.gtk.disableShm");
+
+        _init(eventProc, disableGrab, disableShm);
     }
 
     @Override
@@ -261,7 +265,7 @@ final class GtkApplication extends Application implements
 
     private native void _terminateLoop();
 
-    private native void _init(long eventProc, boolean disableGrab);
+    private native void _init(long eventProc, boolean disableGrab, boolean disableShm);
 
     private native void _runLoop(Runnable launchable, boolean noErrorTrap);
 
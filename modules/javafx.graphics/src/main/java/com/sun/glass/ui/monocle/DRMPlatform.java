@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+/**
+ * A software-rendered platform that presents frames through the Linux
+ * DRM/KMS API instead of the legacy frame buffer device.
+ * <p>
+ * Like the other Monocle platforms on Linux, it needs the native libraries
+ * that are only built for the embedded targets (see armv6hf.gradle); the
+ * desktop Linux build does not include them.
+ */
+class DRMPlatform extends LinuxPlatform {
+
+    /**
+     * Creates a new Monocle DRM Platform.
+     */
+    DRMPlatform() {
+    }
+
+    /**
+     * Creates a screen on the DRM device, falling back to the frame buffer
+     * device if the DRM device cannot be used, for example because another
+     * process is its master.
+     */
+    @Override
+    protected NativeScreen createScreen() {
+        try {
+            DRMSystem.getDRMSystem().loadLibrary();
+            return new DRMScreen();
+        } catch (RuntimeException | UnsatisfiedLinkError e) {
+            return super.createScreen();
+        }
+    }
+}
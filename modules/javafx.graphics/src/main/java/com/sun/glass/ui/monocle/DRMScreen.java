@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import com.sun.glass.ui.Pixels;
+import com.sun.glass.ui.Size;
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.util.Logging;
+import java.io.IOException;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.text.MessageFormat;
+import java.util.concurrent.locks.ReadWriteLock;
+import java.util.concurrent.locks.ReentrantReadWriteLock;
+
+/**
+ * A native screen for a Linux DRM/KMS device. Windows are composed directly
+ * into one of two dumb buffers while the other is scanned out, and the
+ * buffers are exchanged with a page flip at the vertical blank. Each flip
+ * carries the areas that differ from the buffer it replaces, so that drivers
+ * for displays with their own memory only transfer those areas.
+ */
+class DRMScreen implements NativeScreen {
+
+    /**
+     * The system property for setting the DRM device path.
+     */
+    private static final String DRM_PATH_KEY = "monocle.screen.drm";
+
+    /**
+     * The default value for the DRM device path.
+     */
+    private static final String DRM_PATH_DEFAULT = "/dev/dri/card0";
+
+    /**
+     * The density used when the display does not report its size.
+     */
+    private static final int DEFAULT_DPI = 96;
+
+    private final PlatformLogger logger = Logging.getJavaFXLogger();
+
+    private final DRMSystem system;
+    private final long device;
+    private final int width;
+    private final int height;
+    private final int refreshRate;
+    private final int dpi;
+    private final int pitch;
+    private final ByteBuffer[] mappings = new ByteBuffer[DRMSystem.BUFFER_COUNT];
+    private final Framebuffer[] buffers = new Framebuffer[DRMSystem.BUFFER_COUNT];
+
+    /**
+     * Guards the device against being closed while the timer thread waits
+     * for a vertical blank.
+     */
+    private final ReadWriteLock deviceLock = new ReentrantReadWriteLock();
+
+    /**
+     * The index of the buffer being composed, the other one is on screen.
+     */
+    private int back = 1;
+
+    /**
+     * The areas uploaded in the frame being composed and in the frame on
+     * screen, as (x, y, width, height) quadruples. A count of -1 means the
+     * whole screen.
+     */
+    private int[] damage = new int[DRMSystem.MAX_DAMAGE_CLIPS * 4];
+    private int damageCount = -1;
+    private int[] shownDamage = new int[DRMSystem.MAX_DAMAGE_CLIPS * 4];
+    private int shownDamageCount = -1;
+    private final int[] flipRects = new int[DRMSystem.MAX_DAMAGE_CLIPS * 4];
+
+    private boolean isShutdown;
+
+    /**
+     * Creates a native screen for the DRM device.
+     *
+     * @throws IllegalStateException if an error occurs opening the device
+     */
+    DRMScreen() {
+        String path = System.getProperty(DRM_PATH_KEY, DRM_PATH_DEFAULT);
+        system = DRMSystem.getDRMSystem();
+        device = system.openDevice(path);
+        if (device == 0L) {
+            String msg = MessageFormat.format("Failed opening DRM device: {0}", path);
+            IOException e = new IOException(LinuxSystem.getLinuxSystem().getErrorMessage());
+            logger.severe(msg, e);
+            throw new IllegalStateException(msg, e);
+        }
+        width = system.getWidth(device);
+        height = system.getHeight(device);
+        refreshRate = system.getRefreshRate(device);
+        pitch = system.getPitch(device);
+        int mmWidth = system.getPhysicalWidth(device);
+        dpi = mmWidth > 0 ? Math.round(width * 25.4f / mmWidth) : DEFAULT_DPI;
+
+        /*
+         * Rows of a dumb buffer may be padded. The frame buffers are given the
+         * padded width so that their rows line up with the buffer; anything
+         * composed into the padding is never displayed.
+         */
+        int size = (int) system.getBufferSize(device);
+        C c = C.getC();
+        for (int i = 0; i < buffers.length; i++) {
+            ByteBuffer bb = c.NewDirectByteBuffer(system.getBufferAddress(device, i), size);
+            bb.order(ByteOrder.nativeOrder());
+            mappings[i] = bb;
+            buffers[i] = new Framebuffer(bb, pitch / 4, height, Integer.SIZE, true);
+        }
+        int rc = system.setMode(device, 1 - back);
+        if (rc != 0) {
+            system.closeDevice(device);
+            String msg = MessageFormat.format("Failed setting mode on DRM device: {0}", path);
+            IOException e = new IOException(LinuxSystem.getLinuxSystem().strerror(rc));
+            logger.severe(msg, e);
+            throw new IllegalStateException(msg, e);
+        }
+        logger.fine("DRM screen geometry: {0} px x {1} px at {2} mHz, damage clips: {3}",
+                width, height, refreshRate, system.hasDamageClips(device));
+    }
+
+    private Framebuffer getFramebuffer() {
+        return buffers[back];
+    }
+
+    private void addDamage(int x, int y, int w, int h) {
+        if (damageCount < 0) {
+            return;
+        }
+        int x1 = Math.max(x, 0);
+        int y1 = Math.max(y, 0);
+        int x2 = Math.min(x + w, width);
+        int y2 = Math.min(y + h, height);
+        if (x1 >= x2 || y1 >= y2) {
+            return;
+        }
+        if (damageCount == DRMSystem.MAX_DAMAGE_CLIPS) {
+            damageCount = -1;
+            return;
+        }
+        int i = damageCount++ * 4;
+        damage[i] = x1;
+        damage[i + 1] = y1;
+        damage[i + 2] = x2 - x1;
+        damage[i + 3] = y2 - y1;
+    }
+
+    /**
+     * Collects the areas in which the composed buffer differs from the one on
+     * screen: every window uploaded in this frame, and every window uploaded
+     * in the previous frame, since each frame starts from a cleared buffer.
+     *
+     * @return the number of rectangles in {@link #flipRects}, or -1 for the
+     * whole screen
+     */
+    private int collectFlipDamage() {
+        if (damageCount < 0 || shownDamageCount < 0
+                || damageCount + shownDamageCount > DRMSystem.MAX_DAMAGE_CLIPS) {
+            return -1;
+        }
+        System.arraycopy(damage, 0, flipRects, 0, damageCount * 4);
+        System.arraycopy(shownDamage, 0, flipRects, damageCount * 4, shownDamageCount * 4);
+        return damageCount + shownDamageCount;
+    }
+
+    @Override
+    public int getDepth() {
+        return Integer.SIZE;
+    }
+
+    @Override
+    public int getNativeFormat() {
+        // DRM_FORMAT_XRGB8888 is stored as B, G, R, X in little endian order
+        return Pixels.Format.BYTE_BGRA_PRE;
+    }
+
+    @Override
+    public int getWidth() {
+        return width;
+    }
+
+    @Override
+    public int getHeight() {
+        return height;
+    }
+
+    @Override
+    public int getDPI() {
+        return dpi;
+    }
+
+    @Override
+    public long getNativeHandle() {
+        return device;
+    }
+
+    @Override
+    public float getScale() {
+        return 1.0f;
+    }
+
+    @Override
+    public double getVideoRefreshPeriod() {
+        return refreshRate > 0 ? 1000000.0 / refreshRate : 0.0;
+    }
+
+    @Override
+    public boolean waitForVSync() {
+        deviceLock.readLock().lock();
+        try {
+            return !isShutdown && system.waitForVBlank(device) == 0;
+        } finally {
+            deviceLock.readLock().unlock();
+        }
+    }
+
+    @Override
+    public synchronized void shutdown() {
+        deviceLock.writeLock().lock();
+        try {
+            isShutdown = true;
+            system.closeDevice(device);
+        } finally {
+            deviceLock.writeLock().unlock();
+        }
+    }
+
+    @Override
+    public synchronized void uploadPixels(Buffer b,
+                                          int x, int y, int w, int h,
+                                          float alpha) {
+        if (isShutdown) {
+            return;
+        }
+        Framebuffer fb = getFramebuffer();
+        if (!fb.hasReceivedData()) {
+            // The buffer may still be on screen until the last flip completes
+            system.waitForFlip(device);
+        }
+        fb.composePixels(b, x, y, w, h, alpha);
+        addDamage(x, y, w, h);
+    }
+
+    @Override
+    public synchronized void swapBuffers() {
+        Framebuffer fb = getFramebuffer();
+        if (isShutdown || !fb.hasReceivedData()) {
+            return;
+        }
+        try {
+            NativeCursor cursor = NativePlatformFactory.getNativePlatform().getCursor();
+            if (cursor instanceof SoftwareCursor && cursor.getVisiblity()) {
+                SoftwareCursor swCursor = (SoftwareCursor) cursor;
+                Buffer b = swCursor.getCursorBuffer();
+                Size size = swCursor.getBestSize();
+                uploadPixels(b, swCursor.getRenderX(), swCursor.getRenderY(),
+                             size.width, size.height, 1.0f);
+            }
+            int count = collectFlipDamage();
+            int rc = system.pageFlip(device, back, count < 0 ? null : flipRects, count);
+            if (rc == 0) {
+                back = 1 - back;
+                int[] tmp = shownDamage;
+                shownDamage = damage;
+                shownDamageCount = damageCount;
+                damage = tmp;
+            } else {
+                logger.severe("Failed flipping DRM buffers: {0}",
+                        LinuxSystem.getLinuxSystem().strerror(rc));
+            }
+        } finally {
+            damageCount = 0;
+            fb.reset();
+        }
+    }
+
+    @Override
+    public synchronized ByteBuffer getScreenCapture() {
+        ByteBuffer front = mappings[1 - back];
+        ByteBuffer ret = ByteBuffer.allocate(width * height * 4);
+        ret.order(ByteOrder.nativeOrder());
+        for (int y = 0; y < height; y++) {
+            front.limit(y * pitch + width * 4);
+            front.position(y * pitch);
+            ret.put(front);
+        }
+        front.clear();
+        ret.flip();
+        return ret;
+    }
+
+    @Override
+    public String toString() {
+        return MessageFormat.format("{0}[width={1} height={2} DPI={3} refreshRate={4}mHz]",
+                getClass().getName(), getWidth(), getHeight(), getDPI(), refreshRate);
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import com.sun.glass.utils.NativeLibLoader;
+
+/**
+ * A Java-language interface to a Linux DRM/KMS device driven with dumb
+ * buffers. {@code DRMSystem} is a singleton. Its instance is obtained by
+ * calling the {@link DRMSystem#getDRMSystem} method.
+ * <p>
+ * A device is opened with {@link #openDevice}, which selects the first
+ * connected connector, its preferred mode and a CRTC, and allocates two
+ * 32-bit XRGB dumb buffers the size of that mode. The remaining methods take
+ * the native handle returned by {@code openDevice}. Methods returning an
+ * {@code int} status return zero on success or an {@code errno} value.
+ */
+class DRMSystem {
+
+    /**
+     * The number of dumb buffers allocated for each device.
+     */
+    static final int BUFFER_COUNT = 2;
+
+    /**
+     * The maximum number of damage rectangles passed with a page flip.
+     */
+    static final int MAX_DAMAGE_CLIPS = 16;
+
+    private static final DRMSystem INSTANCE = new DRMSystem();
+
+    /**
+     * Obtains the single instance of {@code DRMSystem}. The
+     * {@link #loadLibrary} method must be called on the DRMSystem instance
+     * before any system calls can be made using it.
+     *
+     * @return the {@code DRMSystem} instance
+     */
+    static DRMSystem getDRMSystem() {
+        return INSTANCE;
+    }
+
+    private DRMSystem() {
+    }
+
+    /**
+     * Loads the native libraries required to make system calls using this
+     * {@code DRMSystem} instance. This method must be called before any other
+     * instance methods of {@code DRMSystem}. If this method is called multiple
+     * times, it has no effect after the first call.
+     */
+    void loadLibrary() {
+        NativeLibLoader.loadLibrary("glass_monocle_drm");
+    }
+
+    /**
+     * Opens a DRM device and prepares its buffers for display.
+     *
+     * @param path the path of the device, such as <i>/dev/dri/card0</i>
+     * @return a native handle for the device, or 0 on failure, in which case
+     * {@link LinuxSystem#errno} is set
+     */
+    native long openDevice(String path);
+
+    /**
+     * Restores the previous configuration of the CRTC, releases the buffers
+     * and closes the device.
+     */
+    native void closeDevice(long device);
+
+    native int getWidth(long device);
+    native int getHeight(long device);
+
+    /**
+     * Returns the physical width of the display in millimeters, or 0 if
+     * unknown.
+     */
+    native int getPhysicalWidth(long device);
+
+    /**
+     * Returns the refresh rate of the mode in millihertz.
+     */
+    native int getRefreshRate(long device);
+
+    /**
+     * Returns the number of bytes between the start of consecutive rows of
+     * each buffer.
+     */
+    native int getPitch(long device);
+
+    /**
+     * Returns the address at which the buffer is mapped.
+     */
+    native long getBufferAddress(long device, int index);
+
+    /**
+     * Returns the size of each buffer in bytes.
+     */
+    native long getBufferSize(long device);
+
+    /**
+     * Checks whether page flips are atomic commits carrying the
+     * {@code FB_DAMAGE_CLIPS} plane property. Otherwise damage is passed to
+     * the driver with {@code DRM_IOCTL_MODE_DIRTYFB} before a legacy page
+     * flip.
+     */
+    native boolean hasDamageClips(long device);
+
+    /**
+     * Sets the mode on the CRTC, scanning out the given buffer.
+     */
+    native int setMode(long device, int index);
+
+    /**
+     * Waits for any previous flip to complete, then schedules the buffer to
+     * be scanned out from the next vertical blank. Does not wait for the flip
+     * itself to complete.
+     *
+     * @param rects the changed areas as (x, y, width, height) quadruples, or
+     * {@code null} if the whole buffer changed
+     * @param count the number of rectangles, at most {@link #MAX_DAMAGE_CLIPS}
+     */
+    native int pageFlip(long device, int index, int[] rects, int count);
+
+    /**
+     * Waits until no page flip is pending, after which the buffer that was
+     * previously scanned out can be written.
+     */
+    native int waitForFlip(long device);
+
+    /**
+     * Blocks until the start of the next vertical blank of the CRTC.
+     */
+    native int waitForVBlank(long device);
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import java.io.File;
+import java.io.IOException;
+import java.io.RandomAccessFile;
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.VarHandle;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+
+/**
+ * A ring of frames in a shared memory file that the headless screen composes
+ * into, so that other processes can map the file and read finished frames
+ * without any copy through Java.
+ * <p>
+ * All fields are in native byte order. The file starts with a header:
+ * <pre>
+ *   0  u32 magic          0x4A465846 ("FXFJ" in little endian)
+ *   4  u32 version        1
+ *   8  u32 header size    64
+ *  12  u32 slot count
+ *  16  u32 width          in pixels
+ *  20  u32 height         in pixels
+ *  24  u32 stride         in bytes
+ *  28  u32 format         1 = 32-bit BGRA, premultiplied
+ *  32  u64 slot size      in bytes, including the slot header
+ *  40  u64 latest         sequence number of the last published frame
+ *  48  u32 flags          1 = the screen has shut down
+ * </pre>
+ * followed by the slots. Each slot has a header of {@link #SLOT_HEADER_SIZE}
+ * bytes followed by the pixels:
+ * <pre>
+ *   0  u64 sequence       of the frame in the slot, 0 while being composed
+ *   8  u64 timestamp      System.nanoTime() when published
+ *  16  u32 damage count   0xFFFFFFFF if the whole frame changed
+ *  24  u32[16][4] damage  x, y, width, height of the changed areas
+ * </pre>
+ * Frame {@code n} is stored in slot {@code (n - 1) % slot count}. A reader
+ * loads {@code latest}, checks that the slot sequence equals it, uses the
+ * pixels in place and then reads the slot sequence again: if it changed, the
+ * slot was reused while being read and the frame must be discarded. The
+ * damage lists the areas that differ from frame {@code n - 1}.
+ */
+final class HeadlessFrameRing {
+
+    static final int MAGIC = 0x4A465846;
+    static final int VERSION = 1;
+    static final int HEADER_SIZE = 64;
+    static final int SLOT_HEADER_SIZE = 320;
+    static final int FORMAT_BGRA_PRE = 1;
+    static final int FLAG_CLOSED = 1;
+    static final int MAX_DAMAGE_RECTS = 16;
+    static final int FULL_DAMAGE = -1;
+
+    private static final int LATEST_OFFSET = 40;
+    private static final int FLAGS_OFFSET = 48;
+    private static final int DAMAGE_OFFSET = 24;
+    private static final int PAGE_SIZE = 4096;
+
+    private static final VarHandle LONG =
+            MethodHandles.byteBufferViewVarHandle(long[].class, ByteOrder.nativeOrder());
+    private static final VarHandle INT =
+            MethodHandles.byteBufferViewVarHandle(int[].class, ByteOrder.nativeOrder());
+
+    private final File file;
+    private final MappedByteBuffer buffer;
+    private final int width;
+    private final int height;
+    private final int slotCount;
+    private final int slotSize;
+
+    private long sequence;
+    private int slot;
+
+    /**
+     * The areas uploaded in the frame being composed and in the previous
+     * frame, as (x, y, width, height) quadruples. A count of
+     * {@link #FULL_DAMAGE} means the whole frame.
+     */
+    private int[] damage = new int[MAX_DAMAGE_RECTS * 4];
+    private int damageCount = FULL_DAMAGE;
+    private int[] lastDamage = new int[MAX_DAMAGE_RECTS * 4];
+    private int lastDamageCount = FULL_DAMAGE;
+
+    /**
+     * Creates the shared memory file and maps it.
+     *
+     * @param path the file to create; a name without a directory is created
+     * in <i>/dev/shm</i> so that it can also be opened with
+     * {@code shm_open}
+     * @param width the frame width in pixels
+     * @param height the frame height in pixels
+     * @param slotCount the number of frames in the ring, at least 2
+     * @throws IOException if the file cannot be created or mapped
+     */
+    HeadlessFrameRing(String path, int width, int height, int slotCount) throws IOException {
+        this.file = path.indexOf(File.separatorChar) < 0
+                ? new File("/dev/shm", path) : new File(path);
+        this.width = width;
+        this.height = height;
+        this.slotCount = Math.max(2, slotCount);
+        long size = (long) SLOT_HEADER_SIZE + (long) width * height * 4;
+        size = (size + PAGE_SIZE - 1) & ~(long) (PAGE_SIZE - 1);
+        long total = HEADER_SIZE + size * this.slotCount;
+        if (total > Integer.MAX_VALUE) {
+            throw new IOException("Frame ring too large: " + total + " bytes");
+        }
+        this.slotSize = (int) size;
+        try (RandomAccessFile raf = new RandomAccessFile(file, "rw")) {
+            raf.setLength(0);
+            raf.setLength(total);
+            buffer = raf.getChannel().map(FileChannel.MapMode.READ_WRITE, 0, total);
+        }
+        buffer.order(ByteOrder.nativeOrder());
+        buffer.putInt(4, VERSION);
+        buffer.putInt(8, HEADER_SIZE);
+        buffer.putInt(12, this.slotCount);
+        buffer.putInt(16, width);
+        buffer.putInt(20, height);
+        buffer.putInt(24, width * 4);
+        buffer.putInt(28, FORMAT_BGRA_PRE);
+        buffer.putLong(32, slotSize);
+        LONG.setRelease(buffer, LATEST_OFFSET, 0L);
+        // Written last so that readers never see a partial header
+        INT.setRelease(buffer, 0, MAGIC);
+    }
+
+    /**
+     * Returns the mapping of the whole file, to compose frames into.
+     */
+    ByteBuffer getBuffer() {
+        return buffer;
+    }
+
+    private int slotOffset(int s) {
+        return HEADER_SIZE + s * slotSize;
+    }
+
+    /**
+     * Returns the offset in {@link #getBuffer} of the pixels of the frame
+     * being composed.
+     */
+    int getPixelOffset() {
+        return slotOffset(slot) + SLOT_HEADER_SIZE;
+    }
+
+    /**
+     * Marks the slot for the next frame as being composed. Must be called
+     * before the first pixel of a frame is written.
+     */
+    void beginFrame() {
+        LONG.setVolatile(buffer, slotOffset(slot), 0L);
+        // A volatile store does not keep the plain pixel stores that follow
+        // from being reordered before it, which would let a reader see the
+        // old sequence number next to a partly written frame.
+        VarHandle.storeStoreFence();
+    }
+
+    /**
+     * Records an area updated in the frame being composed.
+     */
+    void addDamage(int x, int y, int w, int h) {
+        if (damageCount == FULL_DAMAGE) {
+            return;
+        }
+        int x1 = Math.max(x, 0);
+        int y1 = Math.max(y, 0);
+        int x2 = Math.min(x + w, width);
+        int y2 = Math.min(y + h, height);
+        if (x1 >= x2 || y1 >= y2) {
+            return;
+        }
+        if (damageCount == MAX_DAMAGE_RECTS) {
+            damageCount = FULL_DAMAGE;
+            return;
+        }
+        int i = damageCount++ * 4;
+        damage[i] = x1;
+        damage[i + 1] = y1;
+        damage[i + 2] = x2 - x1;
+        damage[i + 3] = y2 - y1;
+    }
+
+    /**
+     * Publishes the frame being composed and moves on to the next slot.
+     * Since each frame is composed from a cleared slot, the frame differs
+     * from the previous one where either of them uploaded pixels.
+     */
+    void publishFrame() {
+        int offset = slotOffset(slot);
+        int count = damageCount + lastDamageCount;
+        if (damageCount == FULL_DAMAGE || lastDamageCount == FULL_DAMAGE
+                || count > MAX_DAMAGE_RECTS) {
+            count = FULL_DAMAGE;
+        } else {
+            int p = offset + DAMAGE_OFFSET;
+            for (int i = 0; i < damageCount * 4; i++, p += 4) {
+                buffer.putInt(p, damage[i]);
+            }
+            for (int i = 0; i < lastDamageCount * 4; i++, p += 4) {
+                buffer.putInt(p, lastDamage[i]);
+            }
+        }
+        buffer.putInt(offset + 16, count);
+        buffer.putLong(offset + 8, System.nanoTime());
+        sequence++;
+        LONG.setRelease(buffer, offset, sequence);
+        LONG.setRelease(buffer, LATEST_OFFSET, sequence);
+
+        int[] tmp = lastDamage;
+        lastDamage = damage;
+        lastDamageCount = damageCount;
+        damage = tmp;
+        damageCount = 0;
+        slot = (slot + 1) % slotCount;
+    }
+
+    /**
+     * Returns the pixels of the last published frame, or of the frame being
+     * composed if none has been published yet.
+     */
+    ByteBuffer getLatestFrame() {
+        int s = sequence == 0 ? slot : (int) ((sequence - 1) % slotCount);
+        int offset = slotOffset(s) + SLOT_HEADER_SIZE;
+        ByteBuffer b = buffer.duplicate();
+        b.limit(offset + width * height * 4);
+        b.position(offset);
+        return b.slice().order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Flags the ring as closed for readers and removes the file. Readers
+     * that have mapped it keep their mapping.
+     */
+    void close() {
+        INT.setRelease(buffer, FLAGS_OFFSET, FLAG_CLOSED);
+        file.delete();
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,7 +26,10 @@
 package com.sun.glass.ui.monocle;
 
 import com.sun.glass.ui.Pixels;
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.util.Logging;
 
+import java.io.IOException;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
@@ -37,9 +40,26 @@ class HeadlessScreen implements NativeScreen {
     protected int width;
     protected int height;
     protected Framebuffer fb;
+    private HeadlessFrameRing frameRing;
+
+    private final PlatformLogger logger = Logging.getJavaFXLogger();
 
     HeadlessScreen() {
         this(1280, 800, 32);
+        String path = System.getProperty("monocle.headless.shm");
+        if (path != null && depth == 32) {
+            int frames = Integer.getInteger("monocle.headless.shm.frames", 3);
+            try {
+                frameRing = new HeadlessFrameRing(path, width, height, frames);
+                fb = new Framebuffer(frameRing.getBuffer(), width, height, depth, true);
+                fb.setStartAddress(frameRing.getPixelOffset());
+                frameRing.beginFrame();
+            } catch (IOException e) {
+                logger.severe("Cannot create shared frame ring '"
+                        + path + "'", e);
+                frameRing = null;
+            }
+        }
     }
 
     protected HeadlessScreen(int defaultWidth,
@@ -107,6 +127,9 @@ class HeadlessScreen implements NativeScreen {
 
     @Override
     public void shutdown() {
+        if (frameRing != null) {
+            frameRing.close();
+        }
     }
 
     @Override
@@ -114,15 +137,26 @@ class HeadlessScreen implements NativeScreen {
                              int x, int y, int width, int height,
                              float alpha) {
         fb.composePixels(b, x, y, width, height, alpha);
+        if (frameRing != null) {
+            frameRing.addDamage(x, y, width, height);
+        }
     }
 
     @Override
     public void swapBuffers() {
+        if (frameRing != null && fb.hasReceivedData()) {
+            frameRing.publishFrame();
+            fb.setStartAddress(frameRing.getPixelOffset());
+            frameRing.beginFrame();
+        }
         fb.reset();
     }
 
     @Override
     public ByteBuffer getScreenCapture() {
+        if (frameRing != null) {
+            return frameRing.getLatestFrame();
+        }
         return fb.getBuffer();
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -209,7 +209,8 @@ public final class MonocleApplication extends Application {
 
     @Override
     protected double staticScreen_getVideoRefreshPeriod() {
-        return 0.0;
+        NativeScreen screen = platform.getScreen();
+        return screen == null ? 0.0 : screen.getVideoRefreshPeriod();
     }
 
     @Override
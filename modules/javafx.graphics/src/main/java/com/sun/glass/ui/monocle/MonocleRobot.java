@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -220,7 +220,7 @@ class MonocleRobot extends GlassRobot {
 
             if (x == 0 && y == 0 && width == scrWidth && height == scrHeight) {
                 // Easy case, the entire screen is being captured.
-                System.arraycopy(buffer.array(), 0, data, 0, buffer.array().length);
+                buffer.get(data, 0, Math.min(data.length, buffer.remaining()));
                 return;
             }
 
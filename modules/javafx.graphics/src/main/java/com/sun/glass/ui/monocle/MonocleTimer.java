@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,9 +35,11 @@ import java.util.concurrent.TimeUnit;
  */
 final class MonocleTimer extends Timer {
     private static final String THREAD_NAME = "Monocle Timer";
+    private static final String VSYNC_THREAD_NAME = "Monocle VSync Timer";
 
     private static ScheduledThreadPoolExecutor scheduler;
     private ScheduledFuture<?> task;
+    private volatile Thread vsyncThread;
 
     MonocleTimer(final Runnable runnable) {
         super(runnable);
@@ -64,8 +66,43 @@ final class MonocleTimer extends Timer {
         return 1; // need something non-zero to denote success.
     }
 
+    /**
+     * Starts a timer that runs once for each vertical blank of the primary
+     * screen. If the screen stops reporting vertical blanks, the timer falls
+     * back to sleeping for the refresh period.
+     */
     @Override protected long _start(Runnable runnable) {
-        throw new RuntimeException("vsync timer not supported");
+        final NativeScreen screen =
+                NativePlatformFactory.getNativePlatform().getScreen();
+        final double period =
+                screen == null ? 0.0 : screen.getVideoRefreshPeriod();
+        if (period <= 0.0) {
+            throw new RuntimeException("vsync timer not supported");
+        }
+        final long periodNanos = (long) (period * 1000000.0);
+        Thread thread = new Thread(() -> {
+            boolean vsync = true;
+            while (vsyncThread == Thread.currentThread()) {
+                if (vsync) {
+                    vsync = screen.waitForVSync();
+                }
+                if (!vsync) {
+                    try {
+                        Thread.sleep(periodNanos / 1000000L,
+                                     (int) (periodNanos % 1000000L));
+                    } catch (InterruptedException e) {
+                        continue;
+                    }
+                }
+                if (vsyncThread == Thread.currentThread()) {
+                    runnable.run();
+                }
+            }
+        }, VSYNC_THREAD_NAME);
+        thread.setDaemon(true);
+        vsyncThread = thread;
+        thread.start();
+        return 1; // need something non-zero to denote success.
     }
 
     @Override protected void _stop(long timer) {
@@ -73,6 +110,11 @@ final class MonocleTimer extends Timer {
             task.cancel(false);
             task = null;
         }
+        Thread thread = vsyncThread;
+        if (thread != null) {
+            vsyncThread = null;
+            thread.interrupt();
+        }
     }
 
     @Override protected void _pause(long timer) {}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -80,7 +80,7 @@ public abstract class NativePlatformFactory {
         if (platform == null) {
             String platformFactoryProperty =
                     System.getProperty("monocle.platform",
-                                        "MX6,OMAP,Dispman,Android,X11,Linux,Headless");
+                                        "MX6,OMAP,Dispman,Android,X11,DRM,Linux,Headless");
             String[] platformFactories = platformFactoryProperty.split(",");
             for (int i = 0; i < platformFactories.length; i++) {
                 String factoryName = platformFactories[i].trim();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -120,4 +120,23 @@ public interface NativeScreen {
      */
     public float getScale();
 
+    /**
+     * Returns the time between vertical blanks of the screen in milliseconds,
+     * or 0.0 if {@link #waitForVSync} is not supported.
+     */
+    default double getVideoRefreshPeriod() {
+        return 0.0;
+    }
+
+    /**
+     * Blocks until the start of the next vertical blank of the screen. Called
+     * on the Monocle timer thread.
+     *
+     * @return true if the wait succeeded, false if the screen cannot wait
+     * for a vertical blank
+     */
+    default boolean waitForVSync() {
+        return false;
+    }
+
 }
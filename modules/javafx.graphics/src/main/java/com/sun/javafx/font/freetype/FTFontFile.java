@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,8 @@ import com.sun.javafx.font.PrismFontFile;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.transform.BaseTransform;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
 
 class FTFontFile extends PrismFontFile {
     /*
@@ -52,6 +54,19 @@ class FTFontFile extends PrismFontFile {
     private long face;
     private FTDisposer disposer;
 
+    /*
+     * Scratch storage reused by createGlyphOutline() and initGlyphs(), also
+     * guarded by the font file lock. Glyph pixels are rendered in batches
+     * into glyphPixels, which grows when a single glyph does not fit.
+     */
+    private static final int GLYPH_PIXELS_SIZE = 64 * 1024;
+    private ByteBuffer glyphPixels;
+    private int[] glyphCodes;
+    private int[] glyphMetrics;
+    private byte[] outlineTypes;
+    private float[] outlineCoords;
+    private final int[] outlineCounts = new int[2];
+
     FTFontFile(String name, String filename, int fIndex, boolean register,
                boolean embedded, boolean copy) throws Exception {
         super(name, filename, fIndex, register, embedded, copy);
@@ -114,14 +129,36 @@ class FTFontFile extends PrismFontFile {
         OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
         int flags = OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP | OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
         OSFreetype.FT_Load_Glyph(face, gc, flags);
-        return OSFreetype.FT_Outline_Decompose(face);
+        if (outlineTypes == null) {
+            outlineTypes = new byte[64];
+            outlineCoords = new float[256];
+        }
+        int error = OSFreetype.decomposeOutline(face, outlineTypes, outlineCoords, outlineCounts);
+        if (error != 0) return null;
+        int numTypes = outlineCounts[0];
+        int numCoords = outlineCounts[1];
+        if (numTypes > outlineTypes.length || numCoords > outlineCoords.length) {
+            /* The glyph is still loaded, decompose it again into larger arrays */
+            outlineTypes = new byte[Math.max(numTypes, outlineTypes.length * 2)];
+            outlineCoords = new float[Math.max(numCoords, outlineCoords.length * 2)];
+            error = OSFreetype.decomposeOutline(face, outlineTypes, outlineCoords, outlineCounts);
+            if (error != 0) return null;
+        }
+        return new Path2D(Path2D.WIND_EVEN_ODD,
+                          Arrays.copyOf(outlineTypes, numTypes), numTypes,
+                          Arrays.copyOf(outlineCoords, numCoords), numCoords);
     }
 
-    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
+    /* Renders the first count glyphs of the array with a single native call
+     * per batch. All the glyphs must belong to the given strike.
+     */
+    synchronized void initGlyphs(FTGlyph[] glyphs, int count, FTFontStrike strike) {
         float size = strike.getSize();
         if (size == 0) {
-            glyph.buffer = new byte[0];
-            glyph.bitmap = new FT_Bitmap();
+            for (int i = 0; i < count; i++) {
+                glyphs[i].buffer = new byte[0];
+                glyphs[i].bitmap = new FT_Bitmap();
+            }
             return;
         }
         int size26dot6 = (int)(size * 64);
@@ -143,8 +180,39 @@ class FTFontFile extends PrismFontFile {
             flags |= OSFreetype.FT_LOAD_TARGET_NORMAL;
         }
 
+        if (glyphCodes == null || glyphCodes.length < count) {
+            glyphCodes = new int[count];
+            glyphMetrics = new int[count * OSFreetype.GLYPH_METRICS_SIZE];
+        }
+        for (int i = 0; i < count; i++) {
+            glyphCodes[i] = glyphs[i].getGlyphCode();
+        }
+        if (glyphPixels == null) {
+            glyphPixels = ByteBuffer.allocateDirect(GLYPH_PIXELS_SIZE);
+        }
+
+        int start = 0;
+        while (start < count) {
+            int rendered = OSFreetype.renderGlyphs(face, glyphCodes, start, count - start,
+                                                   flags, glyphPixels, 0, glyphMetrics);
+            for (int i = 0; i < rendered; i++) {
+                setGlyph(glyphs[start + i], i, flags, lcd);
+            }
+            start += rendered;
+            if (rendered == 0) {
+                /* The pixels of the next glyph do not fit in the buffer */
+                int needed = glyphMetrics[OSFreetype.GLYPH_WIDTH] *
+                             glyphMetrics[OSFreetype.GLYPH_ROWS];
+                if (needed <= glyphPixels.capacity()) break;
+                glyphPixels = ByteBuffer.allocateDirect(Math.max(needed, glyphPixels.capacity() * 2));
+            }
+        }
+    }
+
+    private void setGlyph(FTGlyph glyph, int index, int flags, boolean lcd) {
+        int m = index * OSFreetype.GLYPH_METRICS_SIZE;
         int glyphCode = glyph.getGlyphCode();
-        int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
+        int error = glyphMetrics[m + OSFreetype.GLYPH_ERROR];
         if (error != 0) {
             if (PrismFontFactory.debugFonts) {
                 System.err.println("FT_Load_Glyph failed " + error +
@@ -154,14 +222,9 @@ class FTFontFile extends PrismFontFile {
             return;
         }
 
-        FT_GlyphSlotRec glyphRec = OSFreetype.getGlyphSlot(face);
-        if (glyphRec == null) return;
-        FT_Bitmap bitmap = glyphRec.bitmap;
-        if (bitmap == null) return;
-        int pixelMode = bitmap.pixel_mode;
-        int width = bitmap.width;
-        int height = bitmap.rows;
-        int pitch = bitmap.pitch;
+        int pixelMode = glyphMetrics[m + OSFreetype.GLYPH_PIXEL_MODE];
+        int width = glyphMetrics[m + OSFreetype.GLYPH_WIDTH];
+        int height = glyphMetrics[m + OSFreetype.GLYPH_ROWS];
         if (pixelMode != OSFreetype.FT_PIXEL_MODE_GRAY && pixelMode != OSFreetype.FT_PIXEL_MODE_LCD) {
             /* This procedure only requests FT_RENDER_MODE_NORMAL and FT_RENDER_MODE_LCD,
              * and for its output is expects FT_PIXEL_MODE_GRAY and FT_PIXEL_MODE_LCD, respectively.
@@ -178,32 +241,32 @@ class FTFontFile extends PrismFontFile {
         }
         byte[] buffer;
         if (width != 0 && height != 0) {
-            buffer = OSFreetype.getBitmapData(face);
-            if (buffer != null && pitch != width) {
-                /* Common for LCD glyphs */
-                byte[] newBuffer = new byte[width * height];
-                int src = 0, dst = 0;
-                for (int y = 0; y < height; y++) {
-                    for (int x = 0; x < width; x++) {
-                        newBuffer[dst + x] = buffer[src + x];
-                    }
-                    dst += width;
-                    src += pitch;
-                }
-                buffer = newBuffer;
+            int offset = glyphMetrics[m + OSFreetype.GLYPH_OFFSET];
+            if (offset >= 0) {
+                /* Rows are already packed to the width by the native code */
+                buffer = new byte[width * height];
+                glyphPixels.get(offset, buffer);
+            } else {
+                buffer = null;
             }
         } else {
             /* white space */
             buffer = new byte[0];
         }
 
+        FT_Bitmap bitmap = new FT_Bitmap();
+        bitmap.width = width;
+        bitmap.rows = height;
+        bitmap.pitch = width;
+        bitmap.pixel_mode = (byte)pixelMode;
+
         glyph.buffer = buffer;
         glyph.bitmap = bitmap;
-        glyph.bitmap_left = glyphRec.bitmap_left;
-        glyph.bitmap_top = glyphRec.bitmap_top;
-        glyph.advanceX = glyphRec.advance_x / 64f;    /* Fixed 26.6*/
-        glyph.advanceY = glyphRec.advance_y / 64f;
-        glyph.userAdvance = glyphRec.linearHoriAdvance / 65536.0f; /* Fixed 16.16 */
+        glyph.bitmap_left = glyphMetrics[m + OSFreetype.GLYPH_LEFT];
+        glyph.bitmap_top = glyphMetrics[m + OSFreetype.GLYPH_TOP];
+        glyph.advanceX = glyphMetrics[m + OSFreetype.GLYPH_ADVANCE_X] / 64f;    /* Fixed 26.6*/
+        glyph.advanceY = glyphMetrics[m + OSFreetype.GLYPH_ADVANCE_Y] / 64f;
+        glyph.userAdvance = glyphMetrics[m + OSFreetype.GLYPH_LINEAR_HORI] / 65536.0f; /* Fixed 16.16 */
         glyph.lcd = lcd;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@ import com.sun.javafx.font.PrismFontFactory;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.transform.BaseTransform;
+import java.util.HashSet;
 
 class FTFontStrike extends PrismFontStrike<FTFontFile> {
     FT_Matrix matrix;
@@ -80,7 +81,24 @@ class FTFontStrike extends PrismFontStrike<FTFontFile> {
 
     void initGlyph(FTGlyph glyph) {
         FTFontFile fontResource = getFontResource();
-        fontResource.initGlyph(glyph, this);
+        fontResource.initGlyphs(new FTGlyph[] {glyph}, 1, this);
+    }
+
+    @Override
+    public void prefetchGlyphs(int[] glyphCodes, int count) {
+        FTGlyph[] glyphs = new FTGlyph[count];
+        HashSet<Integer> pending = new HashSet<>();
+        int pendingCount = 0;
+        for (int i = 0; i < count; i++) {
+            FTGlyph glyph = (FTGlyph)getGlyph(glyphCodes[i]);
+            if (!glyph.isInitialized() && pending.add(glyphCodes[i])) {
+                glyphs[pendingCount++] = glyph;
+            }
+        }
+        if (pendingCount > 0) {
+            FTFontFile fontResource = getFontResource();
+            fontResource.initGlyphs(glyphs, pendingCount, this);
+        }
     }
 
 }
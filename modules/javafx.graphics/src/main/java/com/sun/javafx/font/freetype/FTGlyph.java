@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,8 +51,12 @@ class FTGlyph implements Glyph {
         return glyphCode;
     }
 
+    boolean isInitialized() {
+        return bitmap != null;
+    }
+
     private void init() {
-        if (bitmap != null) return;
+        if (isInitialized()) return;
         strike.initGlyph(this);
     }
 
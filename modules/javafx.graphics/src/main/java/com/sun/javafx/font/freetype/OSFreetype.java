@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,7 +26,7 @@
 package com.sun.javafx.font.freetype;
 
 import com.sun.glass.utils.NativeLibLoader;
-import com.sun.javafx.geom.Path2D;
+import java.nio.ByteBuffer;
 
 class OSFreetype {
 
@@ -92,7 +92,19 @@ class OSFreetype {
         return (x >> 16 ) & 15;
     }
 
-    static final native Path2D FT_Outline_Decompose(long face);
+    /* Layout of the per glyph metrics written by renderGlyphs() */
+    static final int GLYPH_METRICS_SIZE = 10;
+    static final int GLYPH_ERROR        = 0;
+    static final int GLYPH_PIXEL_MODE   = 1;
+    static final int GLYPH_WIDTH        = 2;
+    static final int GLYPH_ROWS         = 3;
+    static final int GLYPH_LEFT         = 4;
+    static final int GLYPH_TOP          = 5;
+    static final int GLYPH_ADVANCE_X    = 6; /* Fixed 26.6 */
+    static final int GLYPH_ADVANCE_Y    = 7; /* Fixed 26.6 */
+    static final int GLYPH_LINEAR_HORI  = 8; /* Fixed 16.16 */
+    static final int GLYPH_OFFSET       = 9; /* -1 if no pixels were copied */
+
     static final native int FT_Init_FreeType(long[] alibrary);
     static final native int FT_Done_FreeType(long library);
     static final native void FT_Library_Version(long library, int[] amajor, int[] aminor, int[] apatch);
@@ -104,7 +116,11 @@ class OSFreetype {
     static final native int FT_Load_Glyph(long face, int glyph_index, int load_flags);
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
-    static final native byte[] getBitmapData(long face);
+    /* Renders count glyphs into the direct buffer dst, rows packed to width */
+    static final native int renderGlyphs(long face, int[] glyphCodes, int start, int count, int load_flags,
+                                         ByteBuffer dst, int dstOffset, int[] metrics);
+    /* Writes the outline of the loaded glyph into types and coords, counts receives their sizes */
+    static final native int decomposeOutline(long face, byte[] types, float[] coords, int[] counts);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
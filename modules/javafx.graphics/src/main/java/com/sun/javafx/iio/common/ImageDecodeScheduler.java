@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.common;
+
+import com.sun.javafx.runtime.async.AsyncOperation;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.PriorityBlockingQueue;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * A bounded pool of image decoding threads, one per core, shared by the
+ * background image loading of the toolkit and by loaders that split a
+ * single image into parts decoded in parallel.
+ * <p>
+ * Jobs should not block on I/O, since that would keep other images from
+ * being decoded. The toolkit reads background images on threads of its
+ * own and only hands the data read to this pool.
+ * <p>
+ * Jobs with a higher priority run first, jobs of equal priority in the
+ * order they were submitted. The priority of a job that has not started
+ * yet may be changed, and cancelling such a job removes it from the queue.
+ * Parts of an image are submitted with a priority just above that of the
+ * job decoding the image, so that images which are already being decoded
+ * are finished before new ones are started.
+ */
+public final class ImageDecodeScheduler {
+
+    /** Priority of images nobody is looking at yet. */
+    public static final int PRIORITY_NORMAL = AsyncOperation.PRIORITY_NORMAL;
+
+    /** Priority of images that are shown while they load. */
+    public static final int PRIORITY_VISIBLE = AsyncOperation.PRIORITY_VISIBLE;
+
+    private static final ImageDecodeScheduler theInstance = new ImageDecodeScheduler();
+
+    private static final ThreadLocal<Job<?>> currentJob = new ThreadLocal<>();
+
+    private final int parallelism;
+    private final ThreadPoolExecutor executor;
+    private final AtomicLong sequence = new AtomicLong();
+
+    private ImageDecodeScheduler() {
+        parallelism = Math.max(1, Runtime.getRuntime().availableProcessors());
+
+        AtomicInteger threadCount = new AtomicInteger();
+        ThreadFactory threadFactory = runnable -> {
+            Thread thread = new Thread(runnable,
+                    "JavaFX Image Decoder-" + threadCount.incrementAndGet());
+            thread.setDaemon(true);
+            thread.setPriority(Thread.MIN_PRIORITY);
+            return thread;
+        };
+
+        executor = new ThreadPoolExecutor(parallelism, parallelism,
+                1, TimeUnit.SECONDS, new PriorityBlockingQueue<>(), threadFactory);
+        executor.allowCoreThreadTimeOut(true);
+    }
+
+    public static ImageDecodeScheduler getInstance() {
+        return theInstance;
+    }
+
+    /**
+     * Returns the number of decoding threads.
+     */
+    public int getParallelism() {
+        return parallelism;
+    }
+
+    /**
+     * Returns the priority of the job running on the current thread, or
+     * {@link #PRIORITY_NORMAL} if the current thread is not running a job.
+     */
+    public static int currentPriority() {
+        Job<?> job = currentJob.get();
+        return job != null ? job.priority : PRIORITY_NORMAL;
+    }
+
+    /**
+     * Queues the given work and returns its job.
+     */
+    public <V> Job<V> submit(Callable<V> callable, int priority) {
+        Job<V> job = new Job<>(this, callable, priority);
+        executor.execute(job);
+        return job;
+    }
+
+    /**
+     * Queues the given work and returns its job. The runnable is typically
+     * a {@code Future} whose result is obtained from it directly.
+     */
+    public Job<Void> execute(Runnable runnable, int priority) {
+        return submit(() -> {
+            runnable.run();
+            return null;
+        }, priority);
+    }
+
+    /**
+     * The unit of work of the scheduler.
+     */
+    public static final class Job<V> extends FutureTask<V> implements Comparable<Job<?>> {
+        private final ImageDecodeScheduler scheduler;
+        private volatile int priority;
+        private final long order;
+
+        private Job(ImageDecodeScheduler scheduler, Callable<V> callable, int priority) {
+            super(callable);
+            this.scheduler = scheduler;
+            this.priority = priority;
+            this.order = scheduler.sequence.getAndIncrement();
+        }
+
+        public int getPriority() {
+            return priority;
+        }
+
+        /**
+         * Changes the priority of this job. This has no effect once the job
+         * has started.
+         */
+        public void setPriority(int priority) {
+            if (this.priority == priority) {
+                return;
+            }
+            // The queue only orders elements as they are inserted
+            if (scheduler.executor.remove(this)) {
+                this.priority = priority;
+                scheduler.executor.execute(this);
+            } else {
+                this.priority = priority;
+            }
+        }
+
+        @Override
+        public boolean cancel(boolean mayInterruptIfRunning) {
+            boolean cancelled = super.cancel(mayInterruptIfRunning);
+            if (cancelled) {
+                scheduler.executor.remove(this);
+            }
+            return cancelled;
+        }
+
+        /**
+         * Waits for the result of this job. If the job has not started yet
+         * it is run on the calling thread instead, so a job may join the
+         * jobs it has submitted without tying up the pool.
+         */
+        public V join() throws InterruptedException, ExecutionException {
+            if (scheduler.executor.remove(this)) {
+                run();
+            }
+            return get();
+        }
+
+        @Override
+        public void run() {
+            Job<?> outer = currentJob.get();
+            currentJob.set(this);
+            try {
+                super.run();
+            } finally {
+                if (outer != null) {
+                    currentJob.set(outer);
+                } else {
+                    currentJob.remove();
+                }
+            }
+        }
+
+        @Override
+        public int compareTo(Job<?> other) {
+            if (priority != other.priority) {
+                return priority > other.priority ? -1 : 1;
+            }
+            return Long.compare(order, other.order);
+        }
+    }
+}
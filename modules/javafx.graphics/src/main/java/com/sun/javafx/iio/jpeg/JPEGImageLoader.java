@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,11 +29,16 @@ import com.sun.javafx.iio.ImageFrame;
 import com.sun.javafx.iio.ImageMetadata;
 import com.sun.javafx.iio.ImageStorage.ImageType;
 import com.sun.glass.utils.NativeLibLoader;
+import com.sun.javafx.iio.common.ImageDecodeScheduler;
 import com.sun.javafx.iio.common.ImageLoaderImpl;
 import com.sun.javafx.iio.common.ImageTools;
+import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
+import java.io.InterruptedIOException;
+import java.io.SequenceInputStream;
 import java.nio.ByteBuffer;
+import java.util.concurrent.ExecutionException;
 
 public class JPEGImageLoader extends ImageLoaderImpl {
 
@@ -77,8 +82,16 @@ public class JPEGImageLoader extends ImageLoaderImpl {
     private int outWidth;
     /** Set by setOutputAttributes native code callback. */
     private int outHeight;
+    private int outNumComponents;
     private ImageType outImageType;
 
+    /**
+     * The input while it may still be decoded in bands, see
+     * {@link JPEGRestartBands}. Otherwise {@code null}.
+     */
+    private JPEGRestartBands.RecordingInputStream recorder;
+    private JPEGRestartBands restartBands;
+
     private boolean isDisposed = false;
 
     private Lock accessLock = new Lock();
@@ -98,7 +111,9 @@ public class JPEGImageLoader extends ImageLoaderImpl {
     private native int startDecompression(long structPointer,
             int outColorSpaceCode, int scaleNum, int scaleDenom);
 
-    private native boolean decompressIndirect(long structPointer, boolean reportProgress, byte[] array) throws IOException;
+    /** Decodes all rows into the array, starting at the given offset. */
+    private native boolean decompressIndirect(long structPointer, boolean reportProgress,
+            byte[] array, int offset) throws IOException;
 
     static {
         NativeLibLoader.loadLibrary("javafx_iio");
@@ -172,11 +187,20 @@ public class JPEGImageLoader extends ImageLoaderImpl {
     }
 
     JPEGImageLoader(InputStream input) throws IOException {
+        this(input, ImageDecodeScheduler.getInstance().getParallelism() > 1);
+    }
+
+    private JPEGImageLoader(InputStream input, boolean splittable) throws IOException {
         super(JPEGDescriptor.getInstance());
         if (input == null) {
             throw new IllegalArgumentException("input == null!");
         }
 
+        if (splittable) {
+            recorder = new JPEGRestartBands.RecordingInputStream(input);
+            input = recorder;
+        }
+
         try {
             this.structPointer = initDecompressor(input);
         } catch (IOException e) {
@@ -187,6 +211,18 @@ public class JPEGImageLoader extends ImageLoaderImpl {
         if (this.structPointer == 0L) {
             throw new IOException("Unable to initialize JPEG decompressor");
         }
+
+        if (recorder != null) {
+            if (inWidth >= 8
+                    && (long) inWidth * inHeight >= JPEGRestartBands.MIN_PIXELS) {
+                restartBands = JPEGRestartBands.parseHeader(
+                        recorder.getBuffer(), recorder.getCount());
+            }
+            if (restartBands == null) {
+                recorder.stopRecording();
+                recorder = null;
+            }
+        }
     }
 
     @Override
@@ -223,25 +259,11 @@ public class JPEGImageLoader extends ImageLoaderImpl {
 
         ByteBuffer buffer = null;
 
-        int outNumComponents;
         try {
-            outNumComponents = startDecompression(structPointer,
-                    outColorSpaceCode, width, height);
-
-            if (outWidth < 0 || outHeight < 0 || outNumComponents < 0) {
-               throw new IOException("negative dimension.");
-            }
-            if (outWidth > (Integer.MAX_VALUE / outNumComponents)) {
-               throw new IOException("bad width.");
-            }
-            int scanlineStride = outWidth * outNumComponents;
-            if (scanlineStride > (Integer.MAX_VALUE / outHeight)) {
-               throw new IOException("bad height.");
-            }
-
-            byte[] array = new byte[scanlineStride*outHeight];
+            byte[] array = restartBands != null
+                    ? decompressBands(width, height)
+                    : decompress(width, height, listeners != null && !listeners.isEmpty());
             buffer = ByteBuffer.wrap(array);
-            decompressIndirect(structPointer, listeners != null && !listeners.isEmpty(), buffer.array());
         } catch (IOException e) {
             throw e;
         } catch (Throwable t) {
@@ -269,6 +291,175 @@ public class JPEGImageLoader extends ImageLoaderImpl {
                 width, height, width * outNumComponents, imagePixelScale, md);
     }
 
+    /*
+     * Decodes the whole image with this loader.
+     */
+    private byte[] decompress(int width, int height, boolean reportProgress) throws IOException {
+        outNumComponents = startDecompression(structPointer,
+                outColorSpaceCode, width, height);
+
+        if (outWidth < 0 || outHeight < 0 || outNumComponents < 0) {
+           throw new IOException("negative dimension.");
+        }
+        if (outWidth > (Integer.MAX_VALUE / outNumComponents)) {
+           throw new IOException("bad width.");
+        }
+        int scanlineStride = outWidth * outNumComponents;
+        if (scanlineStride > (Integer.MAX_VALUE / outHeight)) {
+           throw new IOException("bad height.");
+        }
+
+        byte[] array = new byte[scanlineStride*outHeight];
+        decompressIndirect(structPointer, reportProgress, array, 0);
+        return array;
+    }
+
+    /*
+     * Decodes the image in bands on the threads of the decode scheduler,
+     * or all at once if it turns out not to be splittable after all.
+     */
+    private byte[] decompressBands(int width, int height) throws IOException {
+        // The rest of the image is needed either way, unless it is too
+        // large to be kept in memory
+        boolean complete = recorder.readRemaining(JPEGRestartBands.MAX_STREAM_LENGTH);
+        byte[] data = recorder.getBuffer();
+        int length = recorder.getCount();
+        InputStream rest = recorder.getSource();
+        recorder = null;
+
+        ImageDecodeScheduler scheduler = ImageDecodeScheduler.getInstance();
+        JPEGRestartBands.Band[] bands = complete
+                ? restartBands.split(data, length, scheduler.getParallelism())
+                : null;
+        restartBands = null;
+        if (bands == null) {
+            // The native decoder has already consumed the header, start over
+            InputStream input = new ByteArrayInputStream(data, 0, length);
+            if (!complete) {
+                input = new SequenceInputStream(input, rest);
+            }
+            JPEGImageLoader whole = new JPEGImageLoader(input, false);
+            try {
+                byte[] array = whole.decompress(width, height, false);
+                outWidth = whole.outWidth;
+                outHeight = whole.outHeight;
+                outNumComponents = whole.outNumComponents;
+                return array;
+            } finally {
+                whole.dispose();
+            }
+        }
+
+        // Every band has to be scaled by the same factor as the whole image
+        // would be, so the bands are given a width that selects that factor.
+        int scaleDenom = getScaleDenom(inWidth, inHeight, width, height);
+        JPEGImageLoader[] loaders = new JPEGImageLoader[bands.length];
+        @SuppressWarnings("unchecked")
+        ImageDecodeScheduler.Job<Boolean>[] jobs = new ImageDecodeScheduler.Job[bands.length];
+        try {
+            int[] offsets = new int[bands.length];
+            int lines = 0;
+            for (int i = 0; i < bands.length; i++) {
+                JPEGRestartBands.Band band = bands[i];
+                JPEGImageLoader loader = new JPEGImageLoader(
+                        new ByteArrayInputStream(band.stream), false);
+                loaders[i] = loader;
+                loader.outNumComponents = loader.startDecompression(loader.structPointer,
+                        outColorSpaceCode, inWidth / scaleDenom, 0);
+                if (i == 0) {
+                    outWidth = loader.outWidth;
+                    outNumComponents = loader.outNumComponents;
+                    if (outWidth <= 0 || outNumComponents <= 0
+                            || outWidth > (Integer.MAX_VALUE / outNumComponents)) {
+                        throw new IOException("bad width.");
+                    }
+                }
+                if (loader.outWidth != outWidth
+                        || loader.outNumComponents != outNumComponents
+                        || band.firstLine / scaleDenom != lines
+                        || loader.outHeight != (band.lines + scaleDenom - 1) / scaleDenom) {
+                    throw new IOException("JPEG band does not fit the image.");
+                }
+                offsets[i] = lines;
+                lines += loader.outHeight;
+            }
+            int scanlineStride = outWidth * outNumComponents;
+            if (lines > (Integer.MAX_VALUE / scanlineStride)) {
+               throw new IOException("bad height.");
+            }
+            outHeight = lines;
+
+            byte[] array = new byte[scanlineStride * outHeight];
+            // Finish images already being decoded before starting new ones
+            int priority = ImageDecodeScheduler.currentPriority() + 1;
+            for (int i = 0; i < bands.length; i++) {
+                JPEGImageLoader loader = loaders[i];
+                int offset = offsets[i] * scanlineStride;
+                jobs[i] = scheduler.submit(() -> loader.decompressIndirect(
+                        loader.structPointer, false, array, offset), priority);
+            }
+            try {
+                // Bands finish roughly in order, report each as it is done
+                for (int i = 0; i < jobs.length; i++) {
+                    jobs[i].join();
+                    updateImageProgress(i + 1 < offsets.length ? offsets[i + 1] : outHeight);
+                }
+            } catch (InterruptedException e) {
+                throw new InterruptedIOException("JPEG decoding interrupted");
+            } catch (ExecutionException e) {
+                Throwable cause = e.getCause();
+                if (cause instanceof IOException) {
+                    throw (IOException) cause;
+                }
+                throw new IOException(cause);
+            }
+            return array;
+        } finally {
+            // A band that is being decoded can not be disposed of
+            boolean interrupted = false;
+            for (ImageDecodeScheduler.Job<Boolean> job : jobs) {
+                if (job != null && !job.cancel(false)) {
+                    while (true) {
+                        try {
+                            job.get();
+                            break;
+                        } catch (InterruptedException e) {
+                            interrupted = true;
+                        } catch (ExecutionException e) {
+                            break;
+                        }
+                    }
+                }
+            }
+            for (JPEGImageLoader loader : loaders) {
+                if (loader != null) {
+                    loader.dispose();
+                }
+            }
+            if (interrupted) {
+                Thread.currentThread().interrupt();
+            }
+        }
+    }
+
+    /*
+     * The scale factor chosen by startDecompression for the given size.
+     */
+    private static int getScaleDenom(int inWidth, int inHeight, int width, int height) {
+        float xScale = (float) width / (float) inWidth;
+        float yScale = (float) height / (float) inHeight;
+        float maxScale = xScale > yScale ? xScale : yScale;
+        if (maxScale > 0.5f) {
+            return 1;
+        } else if (maxScale > 0.25f) {
+            return 2;
+        } else if (maxScale > 0.125f) {
+            return 4;
+        } else {
+            return 8;
+        }
+    }
+
     private static class Lock {
         private boolean locked;
 
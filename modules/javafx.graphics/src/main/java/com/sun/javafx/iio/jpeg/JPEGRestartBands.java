@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.javafx.iio.jpeg;
+
+import java.io.FilterInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.Arrays;
+
+/**
+ * Splits a baseline JPEG image that uses restart markers into horizontal
+ * bands which can be decoded independently of each other.
+ * <p>
+ * The entropy coded data of such an image is divided into restart
+ * intervals of a fixed number of MCUs, and the decoder state is reset at
+ * the start of every interval. A band starts at an MCU row that is also the
+ * start of an interval. Each band is turned into a complete JPEG stream of
+ * its own: a copy of the tables and frame header with the image height
+ * changed to the height of the band, followed by the intervals of the band
+ * with their restart markers renumbered from 0. Since the IDCT, upsampling
+ * and color conversion only ever look at the blocks of one MCU row, the
+ * bands decode to exactly the rows of the full image.
+ */
+final class JPEGRestartBands {
+
+    /** Images with fewer pixels are not worth splitting. */
+    static final int MIN_PIXELS = 1024 * 1024;
+
+    /**
+     * Longer streams are decoded sequentially, rather than kept in memory
+     * to be split.
+     */
+    static final int MAX_STREAM_LENGTH = 64 * 1024 * 1024;
+
+    private static final int SOF0 = 0xC0;
+    private static final int SOF1 = 0xC1;
+    private static final int DHT = 0xC4;
+    private static final int JPG = 0xC8;
+    private static final int DAC = 0xCC;
+    private static final int SOF15 = 0xCF;
+    private static final int RST0 = 0xD0;
+    private static final int RST7 = 0xD7;
+    private static final int SOI = 0xD8;
+    private static final int EOI = 0xD9;
+    private static final int SOS = 0xDA;
+    private static final int DRI = 0xDD;
+
+    /** A band of whole MCU rows and the stream to decode it from. */
+    static final class Band {
+        final int firstLine;
+        final int lines;
+        final byte[] stream;
+
+        private Band(int firstLine, int lines, byte[] stream) {
+            this.firstLine = firstLine;
+            this.lines = lines;
+            this.stream = stream;
+        }
+    }
+
+    /** Length of the tables and headers, up to the first entropy coded byte. */
+    private final int headerLength;
+    /** Offset of the image height in the frame header. */
+    private final int heightOffset;
+    private final int imageHeight;
+    private final int mcuHeight;
+    private final int mcusPerRow;
+    private final int restartInterval;
+
+    private JPEGRestartBands(int headerLength, int heightOffset, int imageWidth,
+            int imageHeight, int mcuWidth, int mcuHeight, int restartInterval) {
+        this.headerLength = headerLength;
+        this.heightOffset = heightOffset;
+        this.imageHeight = imageHeight;
+        this.mcuHeight = mcuHeight;
+        this.mcusPerRow = (imageWidth + mcuWidth - 1) / mcuWidth;
+        this.restartInterval = restartInterval;
+    }
+
+    /**
+     * Parses the markers in front of the first scan. Returns {@code null}
+     * unless the image is baseline or extended sequential Huffman coded,
+     * has a single scan containing all components and uses restart markers.
+     */
+    static JPEGRestartBands parseHeader(byte[] data, int length) {
+        if (length < 4 || (data[0] & 0xff) != 0xff || (data[1] & 0xff) != SOI) {
+            return null;
+        }
+        int pos = 2;
+        int heightOffset = -1;
+        int width = 0, height = 0;
+        int numComponents = 0;
+        int hMax = 1, vMax = 1;
+        int restartInterval = 0;
+        while (true) {
+            // Skip to the marker code, a marker may be preceded by fill bytes
+            if (pos >= length || (data[pos] & 0xff) != 0xff) {
+                return null;
+            }
+            while (pos < length && (data[pos] & 0xff) == 0xff) {
+                pos++;
+            }
+            if (pos + 2 >= length) {
+                return null;
+            }
+            int marker = data[pos++] & 0xff;
+            int segmentLength = readShort(data, pos);
+            if (segmentLength < 2 || pos + segmentLength > length) {
+                return null;
+            }
+            int body = pos + 2;
+            if (marker == SOF0 || marker == SOF1) {
+                if (segmentLength < 8 || data[body] != 8) {
+                    return null;
+                }
+                heightOffset = body + 1;
+                height = readShort(data, body + 1);
+                width = readShort(data, body + 3);
+                numComponents = data[body + 5] & 0xff;
+                if (segmentLength < 8 + 3 * numComponents) {
+                    return null;
+                }
+                for (int i = 0; i < numComponents; i++) {
+                    int sampling = data[body + 7 + 3 * i] & 0xff;
+                    hMax = Math.max(hMax, sampling >> 4);
+                    vMax = Math.max(vMax, sampling & 0x0f);
+                }
+            } else if (marker > SOF1 && marker <= SOF15
+                    && marker != DHT && marker != JPG && marker != DAC) {
+                // Progressive, lossless or arithmetic coded
+                return null;
+            } else if (marker == DRI) {
+                if (segmentLength < 4) {
+                    return null;
+                }
+                restartInterval = readShort(data, body);
+            } else if (marker == SOS) {
+                if (heightOffset < 0 || height == 0 || width == 0
+                        || restartInterval == 0) {
+                    return null;
+                }
+                int scanComponents = data[body] & 0xff;
+                int spectral = body + 1 + 2 * scanComponents;
+                if (scanComponents != numComponents
+                        || segmentLength != 6 + 2 * scanComponents
+                        || data[spectral] != 0 || data[spectral + 1] != 63
+                        || data[spectral + 2] != 0) {
+                    return null;
+                }
+                // A single component scan is never interleaved and uses
+                // one block per MCU whatever its sampling factors
+                int mcuWidth = numComponents == 1 ? 8 : 8 * hMax;
+                int mcuHeight = numComponents == 1 ? 8 : 8 * vMax;
+                return new JPEGRestartBands(pos + segmentLength, heightOffset,
+                        width, height, mcuWidth, mcuHeight, restartInterval);
+            }
+            pos += segmentLength;
+        }
+    }
+
+    private static int readShort(byte[] data, int pos) {
+        return ((data[pos] & 0xff) << 8) | (data[pos + 1] & 0xff);
+    }
+
+    private static int gcd(int a, int b) {
+        while (b != 0) {
+            int t = a % b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    /**
+     * Splits the complete image into at most {@code maxBands} bands of
+     * roughly equal height. Returns {@code null} if the image cannot be
+     * split, or if its entropy coded data does not have exactly the restart
+     * intervals the header promises, in which case the image is left to the
+     * sequential decoder to deal with.
+     */
+    Band[] split(byte[] data, int length, int maxBands) {
+        int mcuRows = (imageHeight + mcuHeight - 1) / mcuHeight;
+        long mcus = (long) mcuRows * mcusPerRow;
+        long intervals = (mcus + restartInterval - 1) / restartInterval;
+        // Bands must start at MCU rows which also start an interval
+        int rowStep = restartInterval / gcd(restartInterval, mcusPerRow);
+        int bandRows = (mcuRows + maxBands - 1) / maxBands;
+        bandRows = (bandRows + rowStep - 1) / rowStep * rowStep;
+        if (maxBands < 2 || bandRows >= mcuRows || intervals > Integer.MAX_VALUE / 2) {
+            return null;
+        }
+
+        // Find where each interval starts and ends
+        int[] starts = new int[(int) intervals];
+        int[] ends = new int[(int) intervals];
+        int count = 0;
+        starts[0] = headerLength;
+        int pos = headerLength;
+        while (true) {
+            if (pos + 1 >= length) {
+                // No EOI
+                return null;
+            }
+            if ((data[pos] & 0xff) != 0xff) {
+                pos++;
+                continue;
+            }
+            int code = data[pos + 1] & 0xff;
+            if (code == 0 || code == 0xff) {
+                // Stuffed zero byte or a fill byte
+                pos += code == 0 ? 2 : 1;
+            } else if (code >= RST0 && code <= RST7) {
+                if (count + 1 >= intervals || code != RST0 + (count & 7)) {
+                    return null;
+                }
+                ends[count++] = pos;
+                pos += 2;
+                starts[count] = pos;
+            } else if (code == EOI) {
+                ends[count++] = pos;
+                break;
+            } else {
+                return null;
+            }
+        }
+        if (count != intervals) {
+            return null;
+        }
+
+        int numBands = (mcuRows + bandRows - 1) / bandRows;
+        Band[] bands = new Band[numBands];
+        for (int b = 0; b < numBands; b++) {
+            int firstRow = b * bandRows;
+            int lastRow = Math.min(firstRow + bandRows, mcuRows);
+            int first = (int) ((long) firstRow * mcusPerRow / restartInterval);
+            int last = lastRow == mcuRows ? count
+                    : (int) ((long) lastRow * mcusPerRow / restartInterval);
+            int firstLine = firstRow * mcuHeight;
+            int lines = Math.min(lastRow * mcuHeight, imageHeight) - firstLine;
+            bands[b] = new Band(firstLine, lines, makeStream(data, starts, ends, first, last, lines));
+        }
+        return bands;
+    }
+
+    private byte[] makeStream(byte[] data, int[] starts, int[] ends,
+            int first, int last, int lines) {
+        int size = headerLength + 2 * (last - first) + 2;
+        for (int i = first; i < last; i++) {
+            size += ends[i] - starts[i];
+        }
+        byte[] stream = Arrays.copyOf(data, size);
+        stream[heightOffset] = (byte) (lines >> 8);
+        stream[heightOffset + 1] = (byte) lines;
+        int pos = headerLength;
+        for (int i = first; i < last; i++) {
+            if (i > first) {
+                stream[pos++] = (byte) 0xff;
+                stream[pos++] = (byte) (RST0 + ((i - first - 1) & 7));
+            }
+            int n = ends[i] - starts[i];
+            System.arraycopy(data, starts[i], stream, pos, n);
+            pos += n;
+        }
+        stream[pos++] = (byte) 0xff;
+        stream[pos++] = (byte) EOI;
+        return Arrays.copyOf(stream, pos);
+    }
+
+    /**
+     * Keeps a copy of everything read from a stream, so that the header
+     * can be examined after the native decoder has read it and the whole
+     * image can be split later on.
+     */
+    static final class RecordingInputStream extends FilterInputStream {
+        private byte[] buffer = new byte[8192];
+        private int count;
+
+        RecordingInputStream(InputStream in) {
+            super(in);
+        }
+
+        byte[] getBuffer() {
+            return buffer;
+        }
+
+        int getCount() {
+            return count;
+        }
+
+        /** Stops recording and releases the copy. */
+        void stopRecording() {
+            buffer = null;
+            count = 0;
+        }
+
+        /** Returns the stream that is being recorded. */
+        InputStream getSource() {
+            return in;
+        }
+
+        /**
+         * Reads the rest of the stream into the copy, but stops once the
+         * copy holds {@code limit} bytes. Returns {@code true} if the end of
+         * the stream was reached, otherwise the rest can still be read from
+         * {@link #getSource}.
+         */
+        boolean readRemaining(int limit) throws IOException {
+            byte[] chunk = new byte[8192];
+            while (count < limit) {
+                if (read(chunk, 0, Math.min(chunk.length, limit - count)) == -1) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        private void record(byte[] b, int off, int len) {
+            if (buffer == null || len <= 0) {
+                return;
+            }
+            if (count + len > buffer.length) {
+                int newLength = Math.max(buffer.length * 2, count + len);
+                if (newLength < 0) {
+                    throw new OutOfMemoryError("JPEG stream too large");
+                }
+                buffer = Arrays.copyOf(buffer, newLength);
+            }
+            System.arraycopy(b, off, buffer, count, len);
+            count += len;
+        }
+
+        @Override
+        public int read() throws IOException {
+            int b = in.read();
+            if (b >= 0) {
+                record(new byte[] { (byte) b }, 0, 1);
+            }
+            return b;
+        }
+
+        @Override
+        public int read(byte[] b, int off, int len) throws IOException {
+            int n = in.read(b, off, len);
+            record(b, off, n);
+            return n;
+        }
+
+        @Override
+        public long skip(long n) throws IOException {
+            if (buffer == null) {
+                return in.skip(n);
+            }
+            // Skipped bytes are part of the image too
+            byte[] chunk = new byte[(int) Math.min(n, 8192)];
+            long skipped = 0;
+            while (skipped < n) {
+                int r = read(chunk, 0, (int) Math.min(n - skipped, chunk.length));
+                if (r <= 0) {
+                    break;
+                }
+                skipped += r;
+            }
+            return skipped;
+        }
+
+        @Override
+        public boolean markSupported() {
+            return false;
+        }
+    }
+}
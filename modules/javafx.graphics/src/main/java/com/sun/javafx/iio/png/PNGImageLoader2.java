@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
  */
 package com.sun.javafx.iio.png;
 
+import com.sun.glass.utils.NativeLibLoader;
 import com.sun.javafx.iio.*;
 import com.sun.javafx.iio.common.*;
 import java.io.*;
@@ -73,6 +74,44 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
     // Palette data : r,g,b,[a]  -  alpha optional
     private byte palette[][];
 
+    // Size of the batches of inflated data handed to the native decoder
+    private static final int INFLATE_BATCH_BYTES = 64 * 1024;
+    private static final int IDAT_READ_BYTES = 8 * 1024;
+
+    /**
+     * True if the native row decoder of the javafx_iio library can be used,
+     * the Java implementation below is used otherwise.
+     */
+    private static final boolean nativeDecoder;
+
+    /**
+     * Sets up the native row decoder. The palette holds r,g,b[,a] for each
+     * entry and is only used for palette images, trns holds the tRNS
+     * r,g,b values of gray and RGB images or is null.
+     */
+    private static native long initDecoder(int width, int height, int bitDepth,
+            int colorType, boolean interlaced, byte[] palette, int[] trns) throws IOException;
+
+    /**
+     * Decodes the next length bytes of inflated image data into image.
+     * Returns true when all rows of the image have been decoded.
+     */
+    private static native boolean decodeRows(long decoder, byte[] data,
+            int length, byte[] image);
+
+    private static native void disposeDecoder(long decoder);
+
+    static {
+        boolean loaded;
+        try {
+            NativeLibLoader.loadLibrary("javafx_iio");
+            loaded = true;
+        } catch (SecurityException | UnsatisfiedLinkError e) {
+            loaded = false;
+        }
+        nativeDecoder = loaded;
+    }
+
     public PNGImageLoader2(InputStream input) throws IOException {
         super(PNGDescriptor.getInstance());
         stream = new DataInputStream(input);
@@ -588,6 +627,52 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
         }
     }
 
+    /*
+     * Inflates the IDAT data in batches and lets the native decoder unfilter
+     * and store the rows, see pngloader.c. The errors match those of
+     * InflaterInputStream used by load() above.
+     */
+    private void loadNative(byte image[], InputStream iDat, Inflater inf) throws IOException {
+        byte packedPalette[] = null;
+        if (colorType == PNG_COLOR_PALETTE) {
+            int bands = palette.length, entries = palette[0].length;
+            packedPalette = new byte[entries * bands];
+            for (int i = 0, idx = 0; i != entries; ++i) {
+                for (int k = 0; k != bands; ++k) {
+                    packedPalette[idx++] = palette[k][i];
+                }
+            }
+        }
+        int trns[] = tRNS_GRAY_RGB ? new int[]{trnsR, trnsG, trnsB} : null;
+
+        long decoder = initDecoder(width, height, bitDepth, colorType,
+                isInterlaced, packedPalette, trns);
+        try {
+            byte in[] = new byte[IDAT_READ_BYTES];
+            byte rows[] = new byte[INFLATE_BATCH_BYTES];
+            boolean done = false;
+            while (!done) {
+                int n = inf.inflate(rows);
+                if (n > 0) {
+                    done = decodeRows(decoder, rows, n, image);
+                } else if (inf.finished() || inf.needsDictionary()) {
+                    throw new EOFException();
+                } else if (inf.needsInput()) {
+                    int read = iDat.read(in, 0, in.length);
+                    if (read == -1) {
+                        throw new EOFException("Unexpected end of ZLIB input stream");
+                    }
+                    inf.setInput(in, 0, read);
+                }
+            }
+        } catch (DataFormatException e) {
+            String s = e.getMessage();
+            throw new ZipException(s != null ? s : "Invalid ZLIB data format");
+        } finally {
+            disposeDecoder(decoder);
+        }
+    }
+
     private ImageFrame decodePalette(byte srcImage[], ImageMetadata metadata) throws IOException {
         int bpp = tRNS_present ? 4 : 3;
         if (width >= (Integer.MAX_VALUE / height / bpp)) {
@@ -651,7 +736,11 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
             return null;
         }
 
-        int bpp = bpp();
+        boolean useNative = nativeDecoder
+                && (colorType != PNG_COLOR_PALETTE || palette != null);
+
+        // the native decoder expands palette images itself
+        int bpp = useNative && colorType == PNG_COLOR_PALETTE ? palette.length : bpp();
         if (width >= (Integer.MAX_VALUE / height / bpp)) {
             throw new IOException("Bad PNG image size!");
         }
@@ -669,10 +758,13 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
 
         PNGIDATChunkInputStream iDat = new PNGIDATChunkInputStream(stream, dataSize);
         Inflater inf = new Inflater();
-        InputStream data = new BufferedInputStream(new InflaterInputStream(iDat, inf));
 
         try {
-            load(bb.array(), data);
+            if (useNative) {
+                loadNative(bb.array(), iDat, inf);
+            } else {
+                load(bb.array(), new BufferedInputStream(new InflaterInputStream(iDat, inf)));
+            }
         } catch (IOException e) {
             throw e;
         } finally {
@@ -681,9 +773,17 @@ public final class PNGImageLoader2 extends ImageLoaderImpl {
             }
         }
 
-        ImageFrame imgPNG = colorType == PNG_COLOR_PALETTE
-                ? decodePalette(bb.array(), metaData)
-                : new ImageFrame(getType(), bb, width, height, bpp * width, metaData);
+        ImageFrame imgPNG;
+        if (colorType != PNG_COLOR_PALETTE) {
+            imgPNG = new ImageFrame(getType(), bb, width, height, bpp * width, metaData);
+        } else if (useNative) {
+            ImageStorage.ImageType type = bpp == 4
+                    ? ImageStorage.ImageType.RGBA
+                    : ImageStorage.ImageType.RGB;
+            imgPNG = new ImageFrame(type, bb, width, height, bpp * width, metaData);
+        } else {
+            imgPNG = decodePalette(bb.array(), metaData);
+        }
 
         imgPNG.setPixelScale(imagePixelScale);
 
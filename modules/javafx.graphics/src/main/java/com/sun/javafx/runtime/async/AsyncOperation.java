@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,12 @@
 package com.sun.javafx.runtime.async;
 
 public interface AsyncOperation {
+    /** Priority of an operation whose result nobody is waiting for yet. */
+    int PRIORITY_NORMAL = 0;
+
+    /** Priority of an operation whose result is about to be shown. */
+    int PRIORITY_VISIBLE = 10;
+
     void start();
 
     void cancel();
@@ -33,4 +39,11 @@ public interface AsyncOperation {
     boolean isCancelled();
 
     boolean isDone();
+
+    /**
+     * Hints how urgently the result is needed, operations with a higher
+     * priority are run first. The default implementation ignores it.
+     */
+    default void setPriority(int priority) {
+    }
 }
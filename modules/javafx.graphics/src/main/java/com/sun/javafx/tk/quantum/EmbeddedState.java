@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,8 @@ final class EmbeddedState extends SceneState {
      */
     @Override
     public void uploadPixels(PixelSource source) {
+        // The embedded scene always uploads the whole frame
+        clearFrameDamage();
         if (isValid()) {
             Pixels pixels = source.getLatestPixels();
             if (pixels != null) {
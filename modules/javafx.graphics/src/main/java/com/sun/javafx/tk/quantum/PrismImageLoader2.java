@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.tk.quantum;
 
+import java.io.ByteArrayInputStream;
+import java.io.IOException;
 import java.io.InputStream;
 
 import com.sun.javafx.iio.ImageFrame;
@@ -33,11 +35,14 @@ import com.sun.javafx.iio.ImageLoader;
 import com.sun.javafx.iio.ImageMetadata;
 import com.sun.javafx.iio.ImageStorage;
 import com.sun.javafx.iio.ImageStorageException;
+import com.sun.javafx.iio.common.ImageDecodeScheduler;
 import com.sun.javafx.runtime.async.AbstractRemoteResource;
 import com.sun.javafx.runtime.async.AsyncOperationListener;
 import com.sun.javafx.tk.PlatformImage;
 import com.sun.prism.Image;
 import com.sun.prism.impl.PrismSettings;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ExecutionException;
 import java.util.concurrent.ExecutorService;
 import java.util.concurrent.Executors;
 import java.util.concurrent.ThreadFactory;
@@ -70,6 +75,10 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
         loadAll(stream, width, height, preserveRatio, smooth);
     }
 
+    private PrismImageLoader2(Exception exception) {
+        handleException(exception);
+    }
+
     @Override
     public double getWidth() {
         return width;
@@ -228,6 +237,9 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     static final class AsyncImageLoader
         extends AbstractRemoteResource<com.sun.javafx.tk.ImageLoader>
     {
+        // Reading the image may block on the network for a long time, so it
+        // is done here rather than on the decode scheduler, which only has
+        // one thread per core.
         private static final ExecutorService BG_LOADING_EXECUTOR =
                 createExecutor();
 
@@ -235,6 +247,9 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
         boolean preserveRatio;
         boolean smooth;
 
+        private int priority = ImageDecodeScheduler.PRIORITY_NORMAL;
+        private ImageDecodeScheduler.Job<PrismImageLoader2> job;
+
         public AsyncImageLoader(
                 AsyncOperationListener<com.sun.javafx.tk.ImageLoader> listener,
                 SizedStreamSupplier sizedStreamSupplier,
@@ -247,9 +262,45 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
             this.smooth = smooth;
         }
 
+        /*
+         * Called on the loading thread. The image is read in full and then
+         * decoded on the decode scheduler, while this thread waits.
+         */
         @Override
         protected PrismImageLoader2 processStream(InputStream stream) {
-            return new PrismImageLoader2(stream, width, height, preserveRatio, smooth);
+            byte[] data;
+            try {
+                data = stream.readAllBytes();
+            } catch (IOException e) {
+                return new PrismImageLoader2(e);
+            }
+
+            ImageDecodeScheduler.Job<PrismImageLoader2> decodeJob;
+            synchronized (this) {
+                if (future.isCancelled()) {
+                    return null;
+                }
+                job = ImageDecodeScheduler.getInstance().submit(
+                        () -> new PrismImageLoader2(new ByteArrayInputStream(data),
+                                width, height, preserveRatio, smooth),
+                        priority);
+                decodeJob = job;
+            }
+            try {
+                return decodeJob.get();
+            } catch (InterruptedException e) {
+                // cancelled while decoding
+                decodeJob.cancel(false);
+                Thread.currentThread().interrupt();
+                return null;
+            } catch (CancellationException e) {
+                // the decode job was cancelled before it completed
+                return null;
+            } catch (ExecutionException e) {
+                Throwable cause = e.getCause();
+                return new PrismImageLoader2(cause instanceof Exception
+                        ? (Exception) cause : new ExecutionException(cause));
+            }
         }
 
         @Override
@@ -280,5 +331,26 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
 
             return bgLoadingExecutor;
         }
+
+        @Override
+        public synchronized void setPriority(int priority) {
+            this.priority = priority;
+            if (job != null) {
+                job.setPriority(priority);
+            }
+        }
+
+        @Override
+        public void cancel() {
+            super.cancel();
+            ImageDecodeScheduler.Job<PrismImageLoader2> j;
+            synchronized (this) {
+                j = job;
+            }
+            if (j != null) {
+                // drop it from the queue if it has not started yet
+                j.cancel(false);
+            }
+        }
     }
 }
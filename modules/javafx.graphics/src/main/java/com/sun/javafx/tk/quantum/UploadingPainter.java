@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -150,6 +150,10 @@ final class UploadingPainter extends ViewPainter {
             RTTexture rtt;
             if (rttexture.isMSAA() || outWidth != bufWidth || outHeight != bufHeight) {
                 rtt = resolveRenderTarget(g, outWidth, outHeight);
+                if (outWidth != bufWidth || outHeight != bufHeight) {
+                    // The damage was recorded in render buffer coordinates
+                    sceneState.setFrameDamage(null, 0);
+                }
             } else {
                 rtt = rttexture;
             }
@@ -178,6 +182,7 @@ final class UploadingPainter extends ViewPainter {
                 /* transparent pixels created and ready for upload */
                 // Copy references, which are volatile, used by upload. Thus
                 // ensure they still exist once event queue is consumed.
+                sceneState.commitFrameDamage(pix);
                 pixelSource.enqueuePixels(pix);
                 sceneState.uploadPixels(pixelSource);
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,6 +107,10 @@ abstract class ViewPainter implements Runnable {
     private Affine3D scaleTx;
     private GeneralTransform3D viewProjTx;
     private GeneralTransform3D projTx;
+    // Device pixel areas repainted by the current paintImpl() call, as
+    // x, y, width, height quadruples, reported to the scene state so that
+    // only those areas have to be presented.
+    private int[] damageRects;
 
     /**
      * This is used for drawing dirty regions and overdraw rectangles in cases where we are
@@ -139,6 +143,7 @@ abstract class ViewPainter implements Runnable {
             dirtyRegionTemp = new RectBounds();
             dirtyRegionPool = new DirtyRegionPool(PrismSettings.dirtyRegionCount);
             dirtyRegionContainer = dirtyRegionPool.checkOut();
+            damageRects = new int[PrismSettings.dirtyRegionCount * 4];
         }
     }
 
@@ -167,6 +172,7 @@ abstract class ViewPainter implements Runnable {
         // that is <= 0, so we might as well bail right off.
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
             root.renderForcedContent(backBufferGraphics);
+            sceneState.setFrameDamage(null, 0);
             return;
         }
 
@@ -304,6 +310,7 @@ abstract class ViewPainter implements Runnable {
             }
 
             // Paint each dirty region
+            int damageCount = 0;
             for (int i = 0; i < dirtyRegionSize; ++i) {
                 final RectBounds dirtyRegion = dirtyRegionContainer.getDirtyRegion(i);
                 // TODO it should be impossible to have ever created a dirty region that was empty...
@@ -320,13 +327,21 @@ abstract class ViewPainter implements Runnable {
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
+                    damageRects[damageCount * 4    ] = dirtyRect.x;
+                    damageRects[damageCount * 4 + 1] = dirtyRect.y;
+                    damageRects[damageCount * 4 + 2] = dirtyRect.width;
+                    damageRects[damageCount * 4 + 3] = dirtyRect.height;
+                    damageCount++;
                 }
             }
+            // The dirty opts overlays are drawn across the entire back buffer
+            sceneState.setFrameDamage(showDirtyOpts ? null : damageRects, damageCount);
         } else {
             // There are no dirty regions, so just paint everything
             g.setHasPreCullingBits(false);
             g.setClipRect(null);
             this.doPaint(g, null);
+            sceneState.setFrameDamage(null, 0);
         }
         root.renderForcedContent(g);
 
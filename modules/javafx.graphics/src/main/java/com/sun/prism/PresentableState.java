@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,9 @@
 
 package com.sun.prism;
 
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Iterator;
 import com.sun.glass.ui.Application;
 import com.sun.glass.ui.Pixels;
 import com.sun.glass.ui.Screen;
@@ -66,6 +69,42 @@ public abstract class PresentableState {
     protected boolean isClosed;
     protected final int pixelFormat = Pixels.getNativeFormat();
 
+    /**
+     * Upper limit on the number of damaged rectangles handed to the view for
+     * a single upload. Anything above it is presented as a full frame.
+     */
+    private static final int MAX_DAMAGE_RECTS = 64;
+
+    /**
+     * Upper limit on the number of frames whose damage is kept while waiting
+     * for an upload. Older frames are folded into a single full frame.
+     */
+    private static final int MAX_PENDING_FRAMES = 8;
+
+    /**
+     * The damage of a rendered frame, bound to the Pixels it was read into.
+     * A null rects array means the whole frame.
+     */
+    private static final class FrameDamage {
+        Pixels pixels;
+        final int[] rects;
+        final int count;
+
+        FrameDamage(Pixels pixels, int[] rects, int count) {
+            this.pixels = pixels;
+            this.rects = rects;
+            this.count = count;
+        }
+    }
+
+    // Damage of the frame currently being rendered (renderer thread only)
+    private int[] frameDamageRects;
+    private int frameDamageCount;
+    // Damage of frames that were enqueued but not yet uploaded, oldest first
+    private final ArrayDeque<FrameDamage> pendingDamage = new ArrayDeque<>();
+    // Merged damage for the current upload (event thread only)
+    private int[] uploadDamageRects = new int[16];
+
     /** Create a PresentableState based on a View.
      *
      * Must be called on the event thread.
@@ -296,6 +335,109 @@ public abstract class PresentableState {
         if (view != null) view.unlock();
     }
 
+    /**
+     * Records the areas of the render buffer that were repainted for the
+     * frame currently being rendered, in render pixel coordinates.
+     *
+     * Must be called on the Prism renderer thread.
+     *
+     * @param rects x, y, width, height quadruples, or null if the entire
+     *              frame was repainted
+     * @param count the number of rectangles in rects
+     */
+    public void setFrameDamage(int[] rects, int count) {
+        if (rects == null || count > MAX_DAMAGE_RECTS) {
+            frameDamageRects = null;
+            frameDamageCount = 0;
+        } else {
+            frameDamageRects = Arrays.copyOf(rects, count * 4);
+            frameDamageCount = count;
+        }
+    }
+
+    /**
+     * Binds the damage recorded with {@link #setFrameDamage} to the Pixels
+     * the frame was read back into, so that uploading those Pixels only
+     * presents what changed since the previous upload. Frames that never
+     * had their damage recorded are presented in full.
+     *
+     * Must be called on the Prism renderer thread before the Pixels are
+     * enqueued.
+     *
+     * @param pixels the Pixels holding the rendered frame
+     */
+    public void commitFrameDamage(Pixels pixels) {
+        synchronized (pendingDamage) {
+            // A recycled Pixels object now holds a newer frame; older damage
+            // bound to it still has to be merged into the next upload.
+            for (FrameDamage d : pendingDamage) {
+                if (d.pixels == pixels) {
+                    d.pixels = null;
+                }
+            }
+            // Frames that are skipped or never uploaded would otherwise pile
+            // up here; whichever upload comes next presents the full frame.
+            if (pendingDamage.size() >= MAX_PENDING_FRAMES) {
+                pendingDamage.clear();
+                pendingDamage.add(new FrameDamage(null, null, 0));
+            }
+            pendingDamage.add(new FrameDamage(pixels, frameDamageRects, frameDamageCount));
+        }
+        frameDamageRects = null;
+        frameDamageCount = 0;
+    }
+
+    /**
+     * Drops the damage of every frame that was committed so far. Used by
+     * subclasses that always present the whole frame.
+     */
+    protected void clearFrameDamage() {
+        synchronized (pendingDamage) {
+            pendingDamage.clear();
+        }
+    }
+
+    int getPendingFrameDamageCount() {
+        synchronized (pendingDamage) {
+            return pendingDamage.size();
+        }
+    }
+
+    /**
+     * Merges the damage of every frame up to and including the one held by
+     * pixels into uploadDamageRects.
+     *
+     * @return the number of rectangles, or -1 if the entire frame has to be
+     *         presented
+     */
+    private int collectDamage(Pixels pixels) {
+        int count = 0;
+        boolean full = false;
+        boolean found = false;
+        synchronized (pendingDamage) {
+            Iterator<FrameDamage> it = pendingDamage.iterator();
+            while (it.hasNext() && !found) {
+                FrameDamage d = it.next();
+                it.remove();
+                found = (d.pixels == pixels);
+                if (full) {
+                    continue;
+                }
+                if (d.rects == null || count + d.count > MAX_DAMAGE_RECTS) {
+                    full = true;
+                    continue;
+                }
+                if (uploadDamageRects.length < (count + d.count) * 4) {
+                    uploadDamageRects = Arrays.copyOf(uploadDamageRects,
+                                                      MAX_DAMAGE_RECTS * 4);
+                }
+                System.arraycopy(d.rects, 0, uploadDamageRects, count * 4, d.count * 4);
+                count += d.count;
+            }
+        }
+        return (full || !found) ? -1 : count;
+    }
+
     /**
      * Put the pixels on the screen.
      *
@@ -305,7 +447,12 @@ public abstract class PresentableState {
         Pixels pixels = source.getLatestPixels();
         if (pixels != null) {
             try {
-                view.uploadPixels(pixels);
+                int count = collectDamage(pixels);
+                if (count < 0) {
+                    view.uploadPixels(pixels);
+                } else {
+                    view.uploadPixels(pixels, uploadDamageRects, count);
+                }
             } finally {
                 source.doneWithPixels(pixels);
             }
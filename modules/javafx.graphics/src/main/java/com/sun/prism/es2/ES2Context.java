@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,7 @@ import com.sun.prism.RenderTarget;
 import com.sun.prism.Texture;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.ps.BaseShaderContext;
+import com.sun.prism.paint.Color;
 import com.sun.prism.ps.Shader;
 import com.sun.prism.ps.ShaderFactory;
 
@@ -71,6 +72,21 @@ class ES2Context extends BaseShaderContext {
 
     public static final int NUM_QUADS = PrismSettings.superShader ? 4096 : 256;
 
+    // MeshViews waiting to be drawn, see renderMeshView. They share the
+    // mesh, shader, textures, lights and device state of the first one and
+    // are drawn with one instanced draw call, each with its own world
+    // transform and diffuse color stored in instanceData.
+    private static final int MAX_INSTANCES = 1024;
+    private final boolean instancing;
+    private final ES2MeshView[] instanceViews = new ES2MeshView[MAX_INSTANCES];
+    private final float[] instanceData =
+            new float[MAX_INSTANCES * GLContext.FLOATS_PER_INSTANCE];
+    private int numInstances;
+    private ES2Shader instanceShader;
+    private float instancePixelScaleX, instancePixelScaleY;
+    // for -Dprism.printStats
+    private int meshViewDrawCalls, meshViewsDrawn;
+
     ES2Context(Screen screen, ShaderFactory factory) {
         super(screen, factory, NUM_QUADS);
         GLFactory glF = ES2Pipeline.glFactory;
@@ -88,6 +104,7 @@ class ES2Context extends BaseShaderContext {
         makeCurrent(dummyGLDrawable);
 
         glContext.enableVertexAttributes();
+        instancing = PrismSettings.meshInstancing && glContext.isInstancingSupported();
         quadIndices = genQuadsIndexBuffer(NUM_QUADS);
         setIndexBuffer(quadIndices);
         state = new State();
@@ -256,13 +273,11 @@ class ES2Context extends BaseShaderContext {
 
     @Override
     protected void updateTexture(int texUnit, Texture tex) {
-        glContext.updateActiveTextureUnit(texUnit);
-
         if (tex == null) {
-            glContext.updateBoundTexture(0);
+            glContext.updateTextureBinding(texUnit, 0);
         } else {
             ES2Texture es2Tex = (ES2Texture)tex;
-            glContext.updateBoundTexture(es2Tex.getNativeSourceHandle());
+            glContext.updateTextureBinding(texUnit, es2Tex.getNativeSourceHandle());
             es2Tex.updateWrapState();
             es2Tex.updateFilterState();
         }
@@ -379,6 +394,12 @@ class ES2Context extends BaseShaderContext {
         setIndexBuffer(quadIndices);
     }
 
+    @Override
+    public void flushVertexBuffer() {
+        flushMeshViews();
+        super.flushVertexBuffer();
+    }
+
     @Override
     public void setDeviceParametersFor3D() {
         // unbind vertex attributes and index buffer
@@ -392,17 +413,20 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2Mesh(long nativeHandle) {
+        flushMeshViews();
         glContext.releaseES2Mesh(nativeHandle);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
             int vertexBufferLength, short[] indexBuffer, int indexBufferLength) {
+        flushMeshViews();
         return glContext.buildNativeGeometry(nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
     boolean buildNativeGeometry(long nativeHandle, float[] vertexBuffer,
             int vertexBufferLength, int[] indexBuffer, int indexBufferLength) {
+        flushMeshViews();
         return glContext.buildNativeGeometry(nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
@@ -413,6 +437,7 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2PhongMaterial(long nativeHandle) {
+        flushMeshViews();
         glContext.releaseES2PhongMaterial(nativeHandle);
     }
 
@@ -430,6 +455,7 @@ class ES2Context extends BaseShaderContext {
 
     // TODO: 3D - Should this be called dispose?
     void releaseES2MeshView(long nativeHandle) {
+        flushMeshViews();
         glContext.releaseES2MeshView(nativeHandle);
     }
 
@@ -473,44 +499,160 @@ class ES2Context extends BaseShaderContext {
                           dstX0, dstY0, dstX1, dstY1);
     }
 
+    /**
+     * Queues the given MeshView to be drawn along with the MeshViews queued
+     * before it, if they can all be drawn by a single instanced draw call.
+     * Otherwise the queued MeshViews are drawn first. The queue is drawn
+     * by flushMeshViews, at the latest when the vertex buffer is flushed.
+     */
     void renderMeshView(long nativeHandle, Graphics g, ES2MeshView meshView) {
-
+        ES2PhongMaterial material = meshView.getMaterial();
+        // The texture maps stay locked until the MeshView is drawn
+        material.lockTextureMaps();
         ES2Shader shader = getPhongShader(meshView);
-        setShaderProgram(shader.getProgramObject());
 
-        // Support retina display by scaling the projViewTx and pass it to the shader.
-        float pixelScaleFactorX = g.getPixelScaleFactorX();
-        float pixelScaleFactorY = g.getPixelScaleFactorY();
-        if (pixelScaleFactorX != 1.0 || pixelScaleFactorY != 1.0) {
-            scratchTx = scratchTx.set(projViewTx);
-            scratchTx.scale(pixelScaleFactorX, pixelScaleFactorY, 1.0);
-            updateRawMatrix(scratchTx);
-        } else {
-            updateRawMatrix(projViewTx);
+        if (numInstances > 0 && !canDrawInstanced(g, meshView, shader)) {
+            flushMeshViews();
+        }
+        if (numInstances == 0) {
+            instanceShader = shader;
+            instancePixelScaleX = g.getPixelScaleFactorX();
+            instancePixelScaleY = g.getPixelScaleFactorY();
         }
-        shader.setMatrix("viewProjectionMatrix", rawMatrix);
-        shader.setConstant("camPos", (float) cameraPos.x,
-                (float) cameraPos.y, (float)cameraPos.z);
 
         // Undo the SwapChain scaling done in createGraphics() because 3D needs
         // this information in the shader (via projViewTx)
         BaseTransform xform = g.getTransformNoClone();
-        if (pixelScaleFactorX != 1.0 || pixelScaleFactorY != 1.0) {
+        if (instancePixelScaleX != 1.0 || instancePixelScaleY != 1.0) {
             scratchAffine3DTx.setToIdentity();
-            scratchAffine3DTx.scale(1.0 / pixelScaleFactorX, 1.0 / pixelScaleFactorY);
+            scratchAffine3DTx.scale(1.0 / instancePixelScaleX, 1.0 / instancePixelScaleY);
             scratchAffine3DTx.concatenate(xform);
             updateWorldTransform(scratchAffine3DTx);
         } else {
             updateWorldTransform(xform);
         }
-        updateRawMatrix(worldTx);
 
-        shader.setMatrix("worldMatrix", rawMatrix);
-//        printRawMatrix("worldMatrix");
+        // The world transform is affine, its last row is always (0, 0, 0, 1)
+        int i = numInstances * GLContext.FLOATS_PER_INSTANCE;
+        for (int j = 0; j < 12; j++) {
+            instanceData[i++] = (float) worldTx.get(j);
+        }
+        Color diffuseColor = material.diffuseColor;
+        instanceData[i++] = diffuseColor.getRed();
+        instanceData[i++] = diffuseColor.getGreen();
+        instanceData[i++] = diffuseColor.getBlue();
+        instanceData[i++] = diffuseColor.getAlpha();
+        instanceViews[numInstances++] = meshView;
+        meshView.setInstancePending(true);
+
+        if (!instancing || numInstances == MAX_INSTANCES) {
+            flushMeshViews();
+        }
+    }
+
+    private boolean canDrawInstanced(Graphics g, ES2MeshView meshView, ES2Shader shader) {
+        ES2MeshView first = instanceViews[0];
+        if (shader != instanceShader || meshView.getMesh() != first.getMesh()
+                || meshView.getCullingMode() != first.getCullingMode()
+                || meshView.isWireframe() != first.isWireframe()
+                || g.getPixelScaleFactorX() != instancePixelScaleX
+                || g.getPixelScaleFactorY() != instancePixelScaleY
+                || meshView.getAmbientLightRed() != first.getAmbientLightRed()
+                || meshView.getAmbientLightGreen() != first.getAmbientLightGreen()
+                || meshView.getAmbientLightBlue() != first.getAmbientLightBlue()) {
+            return false;
+        }
+
+        // The diffuse color is the only material property set per instance
+        ES2PhongMaterial material = meshView.getMaterial();
+        ES2PhongMaterial firstMaterial = first.getMaterial();
+        if (material != firstMaterial) {
+            for (int i = 0; i < material.maps.length; i++) {
+                if (material.maps[i].getTexture() != firstMaterial.maps[i].getTexture()) {
+                    return false;
+                }
+            }
+            if (!material.specularColor.equals(firstMaterial.specularColor)) {
+                return false;
+            }
+        }
+
+        ES2Light[] lights = meshView.getLights();
+        ES2Light[] firstLights = first.getLights();
+        for (int i = 0; i < lights.length; i++) {
+            if (!ES2Light.sameLight(lights[i], firstLights[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Draws the MeshViews queued by renderMeshView.
+     */
+    void flushMeshViews() {
+        int count = numInstances;
+        if (count == 0) {
+            return;
+        }
+        numInstances = 0;
+
+        // This may be called while validating a 2D operation, which expects
+        // its shader to stay enabled
+        int program = shaderProgram;
+        ES2MeshView meshView = instanceViews[0];
+        ES2Shader shader = (count == 1) ? instanceShader
+                : ES2PhongShader.getShader(meshView, this, true);
+        setShaderProgram(shader.getProgramObject());
+
+        // Support retina display by scaling the projViewTx and pass it to the shader.
+        if (instancePixelScaleX != 1.0 || instancePixelScaleY != 1.0) {
+            scratchTx = scratchTx.set(projViewTx);
+            scratchTx.scale(instancePixelScaleX, instancePixelScaleY, 1.0);
+            updateRawMatrix(scratchTx);
+        } else {
+            updateRawMatrix(projViewTx);
+        }
+        shader.setMatrix("viewProjectionMatrix", rawMatrix);
+        shader.setConstant("camPos", (float) cameraPos.x,
+                (float) cameraPos.y, (float)cameraPos.z);
 
         ES2PhongShader.setShaderParamaters(shader, meshView, this);
 
-        glContext.renderMeshView(nativeHandle);
+        if (count == 1) {
+            updateRawMatrix(instanceData);
+            shader.setMatrix("worldMatrix", rawMatrix);
+//            printRawMatrix("worldMatrix");
+            shader.setConstant("diffuseColor", instanceData[12], instanceData[13],
+                    instanceData[14], instanceData[15]);
+            glContext.renderMeshView(meshView.getNativeHandle());
+        } else {
+            glContext.renderMeshViewInstanced(meshView.getNativeHandle(),
+                    instanceData, count);
+        }
+        meshViewDrawCalls++;
+        meshViewsDrawn += count;
+
+        for (int i = 0; i < count; i++) {
+            instanceViews[i].getMaterial().unlockTextureMaps();
+            instanceViews[i].setInstancePending(false);
+            instanceViews[i] = null;
+        }
+        if (program != 0) {
+            updateShaderProgram(program);
+        }
+    }
+
+    /**
+     * Returns the number of MeshView draw calls, followed by the number of
+     * MeshViews they drew, per frame of the given number of frames drawn
+     * since the last call.
+     */
+    String getMeshViewStatistics(int frames) {
+        String stats = "meshViewDrawCalls=" + (meshViewDrawCalls + frames / 2) / frames
+                + "\n\tmeshViews=" + (meshViewsDrawn + frames / 2) / frames;
+        meshViewDrawCalls = meshViewsDrawn = 0;
+        return stats;
     }
 
     @Override
@@ -547,6 +689,27 @@ class ES2Context extends BaseShaderContext {
         rawMatrix[15] = (float)src.get(15);
     }
 
+    // Sets rawMatrix to the world matrix of the first queued MeshView, stored
+    // as the first three rows of the matrix
+    private void updateRawMatrix(float[] rows) {
+        rawMatrix[0]  = rows[0];
+        rawMatrix[1]  = rows[4];
+        rawMatrix[2]  = rows[8];
+        rawMatrix[3]  = 0f;
+        rawMatrix[4]  = rows[1];
+        rawMatrix[5]  = rows[5];
+        rawMatrix[6]  = rows[9];
+        rawMatrix[7]  = 0f;
+        rawMatrix[8]  = rows[2];
+        rawMatrix[9]  = rows[6];
+        rawMatrix[10] = rows[10];
+        rawMatrix[11] = 0f;
+        rawMatrix[12] = rows[3];
+        rawMatrix[13] = rows[7];
+        rawMatrix[14] = rows[11];
+        rawMatrix[15] = 1f;
+    }
+
     static {
         BaseTransform tx = Affine2D.getScaleInstance(1.0, -1.0);
         flipTx.setIdentity();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,4 +68,27 @@ class ES2Light {
         // testing if w is 0 or 1 using <0.5 since equality check for floating points might not work well
         return isAttenuated < 0.5;
     }
+
+    boolean isOn() {
+        return w > 0;
+    }
+
+    /**
+     * Returns true if both lights, either of which may be null, light a
+     * mesh the same way.
+     */
+    static boolean sameLight(ES2Light l1, ES2Light l2) {
+        boolean on1 = l1 != null && l1.isOn();
+        boolean on2 = l2 != null && l2.isOn();
+        if (!on1 || !on2) {
+            return on1 == on2;
+        }
+        return l1.x == l2.x && l1.y == l2.y && l1.z == l2.z
+                && l1.r == l2.r && l1.g == l2.g && l1.b == l2.b && l1.w == l2.w
+                && l1.ca == l2.ca && l1.la == l2.la && l1.qa == l2.qa
+                && l1.isAttenuated == l2.isAttenuated && l1.maxRange == l2.maxRange
+                && l1.dirX == l2.dirX && l1.dirY == l2.dirY && l1.dirZ == l2.dirZ
+                && l1.innerAngle == l2.innerAngle && l1.outerAngle == l2.outerAngle
+                && l1.falloff == l2.falloff;
+    }
 }
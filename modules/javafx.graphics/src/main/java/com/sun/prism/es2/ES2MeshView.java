@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,10 @@ class ES2MeshView extends BaseMeshView {
     private float ambientLightRed = 0;
     private float ambientLightBlue = 0;
     private float ambientLightGreen = 0;
+    private int cullingMode;
+    private boolean wireframe;
+    // true while waiting in the context to be drawn, see ES2Context.renderMeshView
+    private boolean instancePending;
 
     // NOTE: We only support up to 3 point lights at the present
     private ES2Light[] lights = new ES2Light[3];
@@ -66,22 +70,28 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setCullingMode(int cullingMode) {
+        flushPendingInstance();
+        this.cullingMode = cullingMode;
         context.setCullingMode(nativeHandle, cullingMode);
     }
 
     @Override
     public void setMaterial(Material material) {
+        flushPendingInstance();
         context.setMaterial(nativeHandle, material);
         this.material = (ES2PhongMaterial) material;
     }
 
     @Override
     public void setWireframe(boolean wireframe) {
+        flushPendingInstance();
+        this.wireframe = wireframe;
         context.setWireframe(nativeHandle, wireframe);
     }
 
     @Override
     public void setAmbientLight(float r, float g, float b) {
+        flushPendingInstance();
         ambientLightRed = r;
         ambientLightGreen = g;
         ambientLightBlue = b;
@@ -106,6 +116,7 @@ class ES2MeshView extends BaseMeshView {
             float innerAngle, float outerAngle, float falloff) {
         // NOTE: We only support up to 3 point lights at the present
         if (index >= 0 && index <= 2) {
+            flushPendingInstance();
             lights[index] = new ES2Light(x, y, z, r, g, b, w, ca, la, qa, isAttenuated,
                     maxRange, dirX, dirY, dirZ, innerAngle, outerAngle, falloff);
             context.setLight(nativeHandle, index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated,
@@ -117,11 +128,36 @@ class ES2MeshView extends BaseMeshView {
         return lights;
     }
 
+    int getCullingMode() {
+        return cullingMode;
+    }
+
+    boolean isWireframe() {
+        return wireframe;
+    }
+
+    ES2Mesh getMesh() {
+        return mesh;
+    }
+
+    long getNativeHandle() {
+        return nativeHandle;
+    }
+
+    void setInstancePending(boolean instancePending) {
+        this.instancePending = instancePending;
+    }
+
+    // The state of a MeshView must not change while it waits to be drawn
+    private void flushPendingInstance() {
+        if (instancePending) {
+            context.flushMeshViews();
+        }
+    }
+
     @Override
     public void render(Graphics g) {
-        material.lockTextureMaps();
         context.renderMeshView(nativeHandle, g, this);
-        material.unlockTextureMaps();
     }
 
     ES2PhongMaterial getMaterial() {
@@ -131,6 +167,7 @@ class ES2MeshView extends BaseMeshView {
     @Override
     public void dispose() {
         // TODO: 3D - Need a mechanism to "decRefCount" Mesh and Material
+        flushPendingInstance();
         material = null;
         lights = null;
         disposerRecord.dispose();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,12 +73,15 @@ class ES2PhongMaterial extends BasePhongMaterial {
 
     @Override
     public void setSpecularColor(boolean set, float r, float g, float b, float a) {
+        // MeshViews waiting to be drawn may use this material
+        context.flushMeshViews();
         specularColorSet = set;
         specularColor = new Color(r,g,b,a);
     }
 
     @Override
     public void setTextureMap(TextureMap map) {
+        context.flushMeshViews();
         maps[map.getType().ordinal()] = map;
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,7 +35,11 @@ class ES2PhongShader {
 
     //dimensions:
     static ES2Shader shaders[][][][][] = null;
+    // the same shaders, taking the world matrix and the diffuse color from
+    // per instance attributes, see ES2Context.renderMeshView
+    static ES2Shader instancedShaders[][][][][] = null;
     static String vertexShaderSource;
+    static String instancedVertexShaderSource;
     static String mainFragShaderSource;
 
     enum DiffuseState {
@@ -66,6 +70,7 @@ class ES2PhongShader {
     }
     static final int lightStateCount = 4;
     private static String diffuseShaderParts[] = new String[DiffuseState.values().length];
+    private static String instancedDiffuseShaderParts[] = new String[DiffuseState.values().length];
     private static String specularShaderParts[] = new String[SpecularState.values().length];
     private static String selfIllumShaderParts[] = new String[SelfIllumState.values().length];
     private static String normalMapShaderParts[] = new String[BumpMapState.values().length];
@@ -74,6 +79,8 @@ class ES2PhongShader {
     static {
         shaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
                 [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
+        instancedShaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
+                [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
 
         //NOTE: When creating new shaders, underscore denotes a "shader part"
         diffuseShaderParts[DiffuseState.NONE.ordinal()] =
@@ -83,6 +90,13 @@ class ES2PhongShader {
         diffuseShaderParts[DiffuseState.TEXTURE.ordinal()] =
                 ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/diffuse_texture.frag"));
 
+        instancedDiffuseShaderParts[DiffuseState.NONE.ordinal()] =
+                diffuseShaderParts[DiffuseState.NONE.ordinal()];
+        instancedDiffuseShaderParts[DiffuseState.DIFFUSECOLOR.ordinal()] =
+                ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/diffuse_color_instanced.frag"));
+        instancedDiffuseShaderParts[DiffuseState.TEXTURE.ordinal()] =
+                ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/diffuse_texture_instanced.frag"));
+
         specularShaderParts[SpecularState.NONE.ordinal()] =
                 ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/specular_none.frag"));
         specularShaderParts[SpecularState.TEXTURE.ordinal()] =
@@ -112,6 +126,7 @@ class ES2PhongShader {
                 ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/main3Lights.frag"));
 
         vertexShaderSource = ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/main.vert"));
+        instancedVertexShaderSource = ES2Shader.readStreamIntoString(ES2ResourceFactory.class.getResourceAsStream("glsl/main_instanced.vert"));
 
     }
 
@@ -125,6 +140,10 @@ class ES2PhongShader {
     }
 
     static ES2Shader getShader(ES2MeshView meshView, ES2Context context) {
+        return getShader(meshView, context, false);
+    }
+
+    static ES2Shader getShader(ES2MeshView meshView, ES2Context context, boolean instanced) {
 
         ES2PhongMaterial material = meshView.getMaterial();
 
@@ -150,10 +169,12 @@ class ES2PhongShader {
             if (light != null && light.w > 0) { numLights++; }
         }
 
-        ES2Shader shader = shaders[diffuseState.ordinal()][specularState.ordinal()]
+        ES2Shader[][][][][] cache = instanced ? instancedShaders : shaders;
+        ES2Shader shader = cache[diffuseState.ordinal()][specularState.ordinal()]
                 [selfIllumState.ordinal()][bumpState.ordinal()][numLights];
         if (shader == null) {
-            String fragShader = lightingShaderParts[numLights].replace("vec4 apply_diffuse();", diffuseShaderParts[diffuseState.ordinal()]);
+            String[] diffuseParts = instanced ? instancedDiffuseShaderParts : diffuseShaderParts;
+            String fragShader = lightingShaderParts[numLights].replace("vec4 apply_diffuse();", diffuseParts[diffuseState.ordinal()]);
             fragShader = fragShader.replace("vec4 apply_specular();", specularShaderParts[specularState.ordinal()]);
             fragShader = fragShader.replace("vec3 apply_normal();", normalMapShaderParts[bumpState.ordinal()]);
             fragShader = fragShader.replace("vec4 apply_selfIllum();", selfIllumShaderParts[selfIllumState.ordinal()]);
@@ -167,6 +188,12 @@ class ES2PhongShader {
             attributes.put("pos", 0);
             attributes.put("texCoords", 1);
             attributes.put("tangent", 2);
+            if (instanced) {
+                attributes.put("worldRow0", GLContext.INSTANCE_ATTRIB_INDEX);
+                attributes.put("worldRow1", GLContext.INSTANCE_ATTRIB_INDEX + 1);
+                attributes.put("worldRow2", GLContext.INSTANCE_ATTRIB_INDEX + 2);
+                attributes.put("instanceDiffuseColor", GLContext.INSTANCE_ATTRIB_INDEX + 3);
+            }
 
             Map<String, Integer> samplers = new HashMap<>();
             samplers.put("diffuseTexture", 0);
@@ -174,10 +201,12 @@ class ES2PhongShader {
             samplers.put("normalMap", 2);
             samplers.put("selfIllumTexture", 3);
 
-            shader = ES2Shader.createFromSource(context, vertexShaderSource, pixelShaders, samplers, attributes, 1, false);
+            shader = ES2Shader.createFromSource(context,
+                    instanced ? instancedVertexShaderSource : vertexShaderSource,
+                    pixelShaders, samplers, attributes, 1, false);
 
 
-            shaders[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
+            cache[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
                     [bumpState.ordinal()][numLights] = shader;
         }
         return shader;
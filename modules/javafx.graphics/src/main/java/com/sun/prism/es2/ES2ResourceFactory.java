@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,6 +93,28 @@ public class ES2ResourceFactory extends BaseShaderFactory {
         }
     }
 
+    static final int STATS_FREQUENCY = PrismSettings.prismStatFrequency;
+    private int nFrame = -1;
+
+    private void displayPrismStatistics() {
+        if (STATS_FREQUENCY > 0) {
+            if (++nFrame == STATS_FREQUENCY) {
+                nFrame = 0;
+                int skipped = context.getGLContext().getSkippedStateCalls(true);
+                System.err.println("ES2 Statistics per last " + STATS_FREQUENCY
+                        + " frame(s) :\n\tskippedStateCalls="
+                        + (skipped + STATS_FREQUENCY / 2) / STATS_FREQUENCY
+                        + "\n\t" + context.getMeshViewStatistics(STATS_FREQUENCY));
+            }
+        }
+    }
+
+    @Override
+    public boolean isDeviceReady() {
+        displayPrismStatistics();
+        return super.isDeviceReady();
+    }
+
     @Override
     public TextureResourcePool getTextureResourcePool() {
         return ES2VramPool.instance;
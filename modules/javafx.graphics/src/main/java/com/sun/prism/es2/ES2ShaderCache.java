@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.PrismSettings;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.AtomicMoveNotSupportedException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.HexFormat;
+import java.util.zip.CRC32;
+
+/**
+ * On-disk cache of linked shader program binaries, so that the shaders of
+ * the ES2 pipeline do not have to be compiled from source every time an
+ * application starts.
+ * <p>
+ * A program is looked up by a hash of the GL vendor, renderer and version
+ * strings and of everything that goes into linking it. An entry that is
+ * corrupt, or that the driver rejects, is removed and the program compiled
+ * from source again. The directory is set with {@code prism.shadercache},
+ * which may also be set to {@code false} to disable the cache.
+ */
+final class ES2ShaderCache {
+
+    private static final int MAGIC = 0x50534243; // "PSBC"
+    private static final int VERSION = 1;
+    private static final String SUFFIX = ".bin";
+
+    private static final ES2ShaderCache theInstance = createInstance();
+
+    private final Path dir;
+    private final String driver;
+
+    private ES2ShaderCache(Path dir, String driver) {
+        this.dir = dir;
+        this.driver = driver;
+    }
+
+    private static ES2ShaderCache createInstance() {
+        if (PrismSettings.shaderCacheDir == null || ES2Pipeline.glFactory == null) {
+            return null;
+        }
+        try {
+            Path dir = Path.of(PrismSettings.shaderCacheDir);
+            Files.createDirectories(dir);
+            return new ES2ShaderCache(dir, ES2Pipeline.glFactory.getDriverIdentity());
+        } catch (IOException | RuntimeException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("Shader cache disabled: " + e);
+            }
+            return null;
+        }
+    }
+
+    /**
+     * Returns the shader cache, or null if programs are not cached.
+     */
+    static ES2ShaderCache getInstance() {
+        return theInstance;
+    }
+
+    /**
+     * Returns the key of the program linked from the given sources with
+     * the given attribute locations.
+     */
+    String getKey(String vert, String[] frag, String[] attrs, int[] indexs) {
+        MessageDigest md;
+        try {
+            md = MessageDigest.getInstance("SHA-256");
+        } catch (NoSuchAlgorithmException e) {
+            throw new InternalError(e);
+        }
+        update(md, driver);
+        update(md, vert);
+        for (String f : frag) {
+            update(md, f);
+        }
+        for (int i = 0; i < attrs.length; i++) {
+            update(md, attrs[i] + "=" + indexs[i]);
+        }
+        return HexFormat.of().formatHex(md.digest());
+    }
+
+    private static void update(MessageDigest md, String s) {
+        md.update(s.getBytes(StandardCharsets.UTF_8));
+        // separator, so that the boundaries between strings are part of the key
+        md.update((byte) 0);
+    }
+
+    /**
+     * Creates the program with the given key from its cached binary.
+     * Returns 0 if there is no usable binary for it.
+     */
+    int load(GLContext glCtx, String key) {
+        Path file = dir.resolve(key + SUFFIX);
+        byte[] data;
+        try {
+            data = Files.readAllBytes(file);
+        } catch (IOException e) {
+            return 0;
+        }
+
+        int programID = 0;
+        try (DataInputStream in = new DataInputStream(new ByteArrayInputStream(data))) {
+            if (in.readInt() == MAGIC && in.readInt() == VERSION) {
+                int format = in.readInt();
+                long crc = in.readLong();
+                byte[] binary = in.readAllBytes();
+                CRC32 crc32 = new CRC32();
+                crc32.update(binary);
+                if (crc32.getValue() == crc) {
+                    programID = glCtx.createProgramFromBinary(format, binary);
+                }
+            }
+        } catch (IOException e) {
+            // truncated entry
+        }
+
+        if (programID == 0) {
+            if (PrismSettings.verbose) {
+                System.err.println("Removing unusable shader cache entry " + file);
+            }
+            try {
+                Files.deleteIfExists(file);
+            } catch (IOException e) {
+                // compiled from source and stored again
+            }
+        }
+        return programID;
+    }
+
+    /**
+     * Stores the binary of the given linked program under the given key.
+     */
+    void store(GLContext glCtx, String key, int programID) {
+        int[] format = new int[1];
+        byte[] binary = glCtx.getProgramBinary(programID, format);
+        if (binary == null) {
+            return;
+        }
+        CRC32 crc32 = new CRC32();
+        crc32.update(binary);
+
+        Path tmp = null;
+        try {
+            ByteArrayOutputStream bytes = new ByteArrayOutputStream(binary.length + 20);
+            try (DataOutputStream out = new DataOutputStream(bytes)) {
+                out.writeInt(MAGIC);
+                out.writeInt(VERSION);
+                out.writeInt(format[0]);
+                out.writeLong(crc32.getValue());
+                out.write(binary);
+            }
+            // Write to a temporary file first, so that an application
+            // starting at the same time never reads a partial entry
+            tmp = Files.createTempFile(dir, key, ".tmp");
+            Files.write(tmp, bytes.toByteArray());
+            Path file = dir.resolve(key + SUFFIX);
+            try {
+                Files.move(tmp, file, StandardCopyOption.ATOMIC_MOVE,
+                        StandardCopyOption.REPLACE_EXISTING);
+            } catch (AtomicMoveNotSupportedException e) {
+                Files.move(tmp, file, StandardCopyOption.REPLACE_EXISTING);
+            }
+            tmp = null;
+        } catch (IOException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("Could not store shader cache entry: " + e);
+            }
+        } finally {
+            if (tmp != null) {
+                try {
+                    Files.deleteIfExists(tmp);
+                } catch (IOException e) {
+                    // ignore
+                }
+            }
+        }
+    }
+}
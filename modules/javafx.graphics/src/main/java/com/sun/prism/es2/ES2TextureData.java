@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,8 +92,7 @@ class ES2TextureData implements Disposer.Record {
                     // depend on the texture that is about to be diposed
                     context.flushVertexBuffer();
                     // the given texture is currently bound, so unbind it now
-                    glCtx.updateActiveTextureUnit(i);
-                    glCtx.setBoundTexture(0);
+                    glCtx.updateTextureBinding(i, 0);
                 }
             }
             // delete the texture
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@ import com.sun.prism.MeshView;
 import com.sun.prism.PhongMaterial.MapType;
 import com.sun.prism.Texture.WrapMode;
 import com.sun.prism.impl.PrismSettings;
+import com.sun.prism.impl.PrismTrace;
 import com.sun.prism.paint.Color;
 
 abstract class GLContext {
@@ -115,10 +116,22 @@ abstract class GLContext {
     // Use by Uniform Matrix
     final static int NUM_MATRIX_ELEMENTS          = 16;
 
+    // Per instance attributes of instanced MeshView draws: three rows of the
+    // world matrix and the diffuse color, starting at this attribute index.
+    // Must match INSTANCE_3D_INDEX and INSTANCE_3D_SIZE in PrismES2Defs.h
+    final static int INSTANCE_ATTRIB_INDEX        = 3;
+    final static int FLOATS_PER_INSTANCE          = 16;
+
+    // Operations of nSetState, each followed by its arguments
+    final static int STATE_ACTIVE_TEXTURE         = 1; // unit
+    final static int STATE_BIND_TEXTURE           = 2; // texID
+
     long nativeCtxInfo;
     private int maxTextureSize = -1;
     private Boolean nonPowTwoExtAvailable;
     private Boolean clampToZeroAvailable;
+    private Boolean programBinaryAvailable;
+    private Boolean instancingAvailable;
 
     // TODO : Consider moving these cached values to ES2Context.
     // track some other state here to avoid redundant state changes
@@ -129,6 +142,12 @@ abstract class GLContext {
     private boolean depthTest = false;
     private boolean msaa = false;
     private int maxSampleSize = -1;
+    // the pixel store state texture uploads read with, the native code
+    // needs it to know how many bytes an upload spans
+    private int unpackAlignment = 4;
+    private int unpackRowLength = 0;
+    // state changes applied with a single nSetState call
+    private final int[] stateOps = new int[4];
 
     private static final int FBO_ID_UNSET = -1;
     private static final int FBO_ID_NOCACHE = -2;
@@ -137,7 +156,9 @@ abstract class GLContext {
     private static native void nActiveTexture(long nativeCtxInfo, int texUnit);
     private static native void nBindFBO(long nativeCtxInfo, int nativeFBOID);
     private static native void nBindTexture(long nativeCtxInfo, int texID);
-    private static native void nBlendFunc(int sFactor, int dFactor);
+    private static native void nBlendFunc(long nativeCtxInfo, int sFactor, int dFactor);
+    private static native void nSetState(long nativeCtxInfo, int[] ops, int length);
+    private static native int nGetSkippedStateCalls(long nativeCtxInfo, boolean reset);
     private static native void nClearBuffers(long nativeCtxInfo,
             float red, float green, float blue, float alpha,
             boolean clearColor, boolean clearDepth, boolean ignoreScissor);
@@ -153,6 +174,11 @@ abstract class GLContext {
             int numAttrs, String[] attrs, int[] indexs);
     private static native int nCreateTexture(long nativeCtxInfo, int width,
             int height);
+    private static native boolean nIsProgramBinarySupported(long nativeCtxInfo);
+    private static native byte[] nGetProgramBinary(long nativeCtxInfo,
+            int programID, int[] format);
+    private static native int nCreateProgramFromBinary(long nativeCtxInfo,
+            int format, byte[] binary);
     private static native void nDeleteRenderBuffer(long nativeCtxInfo, int rbID);
     private static native void nDeleteFBO(long nativeCtxInfo, int fboID);
     private static native void nDeleteShader(long nativeCtxInfo, int shadeID);
@@ -160,7 +186,7 @@ abstract class GLContext {
     private static native void nDisposeShaders(long nativeCtxInfo,
             int pID, int vID, int[] fID);
     private static native void nFinish();
-    private static native int nGenAndBindTexture();
+    private static native int nGenAndBindTexture(long nativeCtxInfo);
     private static native int nGetFBO();
     private static native int nGetIntParam(int pname);
     private static native int nGetMaxSampleSize();
@@ -182,12 +208,14 @@ abstract class GLContext {
     private static native boolean nTexImage2D1(int target, int level, int internalFormat,
             int width, int height, int border, int format,
             int type, Object pixels, int pixelsByteOffset, boolean useMipmap);
-    private static native void nTexSubImage2D0(int target, int level,
+    private static native int nTexSubImage2D0(long nativeCtxInfo, int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
-            int type, Object pixels, int pixelsByteOffset);
-    private static native void nTexSubImage2D1(int target, int level,
+            int type, Object pixels, int pixelsByteOffset,
+            int rowLength, int alignment);
+    private static native int nTexSubImage2D1(long nativeCtxInfo, int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
-            int type, Object pixels, int pixelsByteOffset);
+            int type, Object pixels, int pixelsByteOffset,
+            int rowLength, int alignment);
     private static native void nUpdateViewport(long nativeCtxInfo, int x, int y,
             int w, int h);
     private static native void nUniform1f(long nativeCtxInfo, int location, float v0);
@@ -256,6 +284,9 @@ abstract class GLContext {
             float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff);
     private static native void nRenderMeshView(long nativeCtxInfo, long nativeMeshViewInfo);
+    private static native boolean nIsInstancingSupported(long nativeCtxInfo);
+    private static native void nRenderMeshViewInstanced(long nativeCtxInfo, long nativeMeshViewInfo,
+            float[] instanceData, int numInstances);
     private static native void nBlit(long nativeCtxInfo, int srcFBO, int dstFBO,
             int srcX0, int srcY0, int srcX1, int srcY1,
             int dstX0, int dstY0, int dstX1, int dstY1);
@@ -287,7 +318,7 @@ abstract class GLContext {
     }
 
     void blendFunc(int sFactor, int dFactor) {
-        nBlendFunc(sFactor, dFactor);
+        nBlendFunc(nativeCtxInfo, sFactor, dFactor);
     }
 
     boolean canCreateNonPowTwoTextures() {
@@ -386,6 +417,33 @@ abstract class GLContext {
                 attrs.length, attrs, indexs);
     }
 
+    /**
+     * Returns true if linked programs can be retrieved as binaries and
+     * created from them again.
+     */
+    boolean isProgramBinarySupported() {
+        if (programBinaryAvailable == null) {
+            programBinaryAvailable = nIsProgramBinarySupported(nativeCtxInfo);
+        }
+        return programBinaryAvailable.booleanValue();
+    }
+
+    /**
+     * Returns the binary of the given linked program and stores its format
+     * in format[0], or returns null if the driver does not provide one.
+     */
+    byte[] getProgramBinary(int programID, int[] format) {
+        return nGetProgramBinary(nativeCtxInfo, programID, format);
+    }
+
+    /**
+     * Creates a linked program from a binary returned by getProgramBinary.
+     * Returns 0 if the driver rejects the binary.
+     */
+    int createProgramFromBinary(int format, byte[] binary) {
+        return nCreateProgramFromBinary(nativeCtxInfo, format, binary);
+    }
+
     int createTexture(int width, int height) {
         return nCreateTexture(nativeCtxInfo, width, height);
     }
@@ -424,7 +482,7 @@ abstract class GLContext {
     }
 
     int genAndBindTexture() {
-        int texID = nGenAndBindTexture();
+        int texID = nGenAndBindTexture(nativeCtxInfo);
         boundTextures[activeTexUnit] = texID;
         return texID;
     }
@@ -491,6 +549,31 @@ abstract class GLContext {
             setBoundTexture(texid);
         }
     }
+
+    // Makes the given unit active and binds the given texture to it, with
+    // at most one native call.
+    void updateTextureBinding(int unit, int texid) {
+        int length = 0;
+        if (unit != activeTexUnit) {
+            stateOps[length++] = STATE_ACTIVE_TEXTURE;
+            stateOps[length++] = unit;
+            activeTexUnit = unit;
+        }
+        if (texid != boundTextures[unit]) {
+            stateOps[length++] = STATE_BIND_TEXTURE;
+            stateOps[length++] = texid;
+            boundTextures[unit] = texid;
+        }
+        if (length > 0) {
+            nSetState(nativeCtxInfo, stateOps, length);
+        }
+    }
+
+    // Returns the number of GL calls the native state cache left out since
+    // the last reset.
+    int getSkippedStateCalls(boolean reset) {
+        return nGetSkippedStateCalls(nativeCtxInfo, reset);
+    }
     /***********************************************************/
 
     int getIntParam(int param) {
@@ -530,6 +613,11 @@ abstract class GLContext {
     abstract void makeCurrent(GLDrawable drawable);
 
     void pixelStorei(int pname, int param) {
+        if (pname == GL_UNPACK_ALIGNMENT) {
+            unpackAlignment = param;
+        } else if (pname == GL_UNPACK_ROW_LENGTH) {
+            unpackRowLength = param;
+        }
         nPixelStorei(pname, param);
     }
 
@@ -594,14 +682,23 @@ abstract class GLContext {
     void texSubImage2D(int target, int level, int xoffset, int yoffset,
             int width, int height, int format, int type, java.nio.Buffer pixels) {
         boolean direct = BufferFactory.isDirect(pixels);
+        // only timed when the upload statistics are printed
+        boolean trace = PrismTrace.isEnabled();
+        long start = trace ? System.nanoTime() : 0L;
+        int bytes;
         if (direct) {
-            nTexSubImage2D0(target, level, xoffset, yoffset, width, height,
-                    format, type, pixels,
-                    BufferFactory.getDirectBufferByteOffset(pixels));
+            bytes = nTexSubImage2D0(nativeCtxInfo, target, level, xoffset, yoffset,
+                    width, height, format, type, pixels,
+                    BufferFactory.getDirectBufferByteOffset(pixels),
+                    unpackRowLength, unpackAlignment);
         } else {
-            nTexSubImage2D1(target, level, xoffset, yoffset, width, height,
-                    format, type, BufferFactory.getArray(pixels),
-                    BufferFactory.getIndirectBufferByteOffset(pixels));
+            bytes = nTexSubImage2D1(nativeCtxInfo, target, level, xoffset, yoffset,
+                    width, height, format, type, BufferFactory.getArray(pixels),
+                    BufferFactory.getIndirectBufferByteOffset(pixels),
+                    unpackRowLength, unpackAlignment);
+        }
+        if (trace) {
+            PrismTrace.textureUploaded(bytes, System.nanoTime() - start);
         }
     }
 
@@ -820,4 +917,25 @@ abstract class GLContext {
     void renderMeshView(long nativeMeshViewInfo) {
         nRenderMeshView(nativeCtxInfo, nativeMeshViewInfo);
     }
+
+    /**
+     * Returns true if the mesh of a MeshView can be drawn several times with
+     * per instance attributes in a single draw call.
+     */
+    boolean isInstancingSupported() {
+        if (instancingAvailable == null) {
+            instancingAvailable = nIsInstancingSupported(nativeCtxInfo);
+        }
+        return instancingAvailable.booleanValue();
+    }
+
+    /**
+     * Draws the mesh of the given MeshView numInstances times, instanceData
+     * holding FLOATS_PER_INSTANCE floats for each of them.
+     */
+    void renderMeshViewInstanced(long nativeMeshViewInfo, float[] instanceData,
+            int numInstances) {
+        nRenderMeshViewInstanced(nativeCtxInfo, nativeMeshViewInfo, instanceData,
+                numInstances);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -197,6 +197,15 @@ abstract class GLFactory {
                     || isGLExtensionSupported("GL_OES_texture_npot"));
     }
 
+    /**
+     * Returns a string identifying the GL driver, made of the vendor,
+     * renderer and version strings of the shared context.
+     */
+    String getDriverIdentity() {
+        return nGetGLVendor(nativeCtxInfo) + "|" + nGetGLRenderer(nativeCtxInfo)
+                + "|" + nGetGLVersion(nativeCtxInfo);
+    }
+
     abstract int getAdapterCount();
 
     abstract int getAdapterOrdinal(long nativeScreen);
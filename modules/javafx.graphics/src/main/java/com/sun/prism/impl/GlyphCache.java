@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -81,6 +81,10 @@ public class GlyphCache {
 
     private boolean isLCDCache;
 
+    // The glyph list being rendered until its first cache miss, see
+    // prefetchGlyphs()
+    private GlyphList prefetchList;
+
     /* Share a RectanglePacker and its associated texture cache
      * for all uses on a particular screen.
      */
@@ -134,6 +138,7 @@ public class GlyphCache {
         Color currentColor = null;
         Point2D pt = new Point2D();
 
+        prefetchList = gl;
         for (int gi = 0; gi < len; gi++) {
             int gc = gl.getGlyphCode(gi);
 
@@ -146,7 +151,7 @@ public class GlyphCache {
             pt.setLocation(x + gl.getPosX(gi), y + gl.getPosY(gi));
             xform.transform(pt, pt);
             int subPixel = strike.getQuantizedPosition(pt);
-            GlyphData data = getCachedGlyph(gc, subPixel);
+            GlyphData data = getCachedGlyph(gc, subPixel, gi);
             if (data != null) {
                 if (clip != null) {
                     // Always check clipping using user space.
@@ -173,6 +178,25 @@ public class GlyphCache {
                 addDataToQuad(data, vb, tex, pt.x, pt.y, dstw, dsth);
             }
         }
+        prefetchList = null;
+    }
+
+    /* On the first cache miss of a glyph list the strike is given all the
+     * remaining glyphs so that it can rasterize them in a single batch.
+     */
+    private void prefetchGlyphs(GlyphList gl, int start) {
+        int len = gl.getGlyphCount();
+        int[] glyphCodes = new int[len - start];
+        int count = 0;
+        for (int gi = start; gi < len; gi++) {
+            int gc = gl.getGlyphCode(gi);
+            if ((gc & CompositeGlyphMapper.GLYPHMASK) != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                glyphCodes[count++] = gc;
+            }
+        }
+        if (count > 1) {
+            strike.prefetchGlyphs(glyphCodes, count);
+        }
     }
 
     private void addDataToQuad(GlyphData data, VertexBuffer vb,
@@ -238,7 +262,7 @@ public class GlyphCache {
         packer.clear();
     }
 
-    private GlyphData getCachedGlyph(int glyphCode, int subPixel) {
+    private GlyphData getCachedGlyph(int glyphCode, int subPixel, int gi) {
         int segIndex = glyphCode >>> SEGSHIFT;
         int subIndex = glyphCode & SEGMASK;
         segIndex |= (subPixel << SUBPIXEL_SHIFT);
@@ -252,6 +276,11 @@ public class GlyphCache {
             glyphDataMap.put(segIndex, segment);
         }
 
+        if (prefetchList != null) {
+            prefetchGlyphs(prefetchList, gi);
+            prefetchList = null;
+        }
+
         // Render the glyph and insert it in the cache
         GlyphData data = null;
         Glyph glyph = strike.getGlyph(glyphCode);
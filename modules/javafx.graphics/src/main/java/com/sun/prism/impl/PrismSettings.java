@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,6 +84,8 @@ public final class PrismSettings {
     public static final boolean forceUploadingPainter;
     public static final boolean forceAlphaTestShader;
     public static final boolean forceNonAntialiasedShape;
+    public static final boolean meshInstancing;
+    public static final String shaderCacheDir;
 
     public static enum RasterizerType {
         DoubleMarlin("Double Precision Marlin Rasterizer");
@@ -261,6 +263,26 @@ public final class PrismSettings {
         /* Setting for reference type used by Disposer */
         refType = systemProperties.getProperty("prism.reftype");
 
+        /*
+         * Directory linked shader programs are cached in, null if they are
+         * not cached. By default this is next to the native library cache.
+         */
+        String shaderCache = systemProperties.getProperty("prism.shadercache");
+        if ("false".equals(shaderCache)) {
+            shaderCacheDir = null;
+        } else if (shaderCache == null || shaderCache.isEmpty() || "true".equals(shaderCache)) {
+            String userCache = systemProperties.getProperty("javafx.cachedir", "");
+            if (userCache.isEmpty()) {
+                String jfxVersion = systemProperties.getProperty("javafx.runtime.version",
+                                                                 "versionless").replace(":", "-");
+                userCache = systemProperties.getProperty("user.home")
+                        + "/.openjfx/cache/" + jfxVersion;
+            }
+            shaderCacheDir = userCache + "/shaders";
+        } else {
+            shaderCacheDir = shaderCache;
+        }
+
         forcePow2 = getBoolean(systemProperties, "prism.forcepowerof2", false);
         noClampToZero = getBoolean(systemProperties, "prism.noclamptozero", false);
 
@@ -356,6 +378,9 @@ public final class PrismSettings {
         // Force non anti-aliasing (not smooth) shape rendering
         forceNonAntialiasedShape = getBoolean(systemProperties, "prism.forceNonAntialiasedShape", false);
 
+        // Draw consecutive MeshViews sharing a mesh with a single instanced draw call
+        meshInstancing = getBoolean(systemProperties, "prism.meshinstancing", true);
+
     }
 
     private static int parseInt(String s, int dflt, int trueDflt,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,10 @@ public class PrismTrace {
     private static long texBytes;
     private static Map<Long, Long> rttData;
     private static long rttBytes;
+    private static long uploadCount;
+    private static long uploadBytes;
+    // time spent in upload calls, not just waiting for the GPU
+    private static long uploadNanos;
 
     static {
         if (enabled) {
@@ -48,6 +52,7 @@ public class PrismTrace {
                         summary(SummaryType.TYPE_TEX)+
                         summary(SummaryType.TYPE_RTT)+
                         summary(SummaryType.TYPE_ALL));
+                    System.out.println("Texture uploads:" + uploadSummary());
                 }
             });
         }
@@ -70,6 +75,11 @@ public class PrismTrace {
         return "ERROR";
     }
 
+    private static String uploadSummary() {
+        return String.format(" count=%d@%,dKB, upload time %,dms",
+                             uploadCount, uploadBytes >> 10, uploadNanos / 1000000);
+    }
+
     private static long computeSize(int w, int h, int bpp) {
         long size = w;
         size *= h;
@@ -153,6 +163,26 @@ public class PrismTrace {
             summary(SummaryType.TYPE_ALL));
     }
 
+    // Whether texture allocations and uploads are being traced
+    public static boolean isEnabled() {
+        return enabled;
+    }
+
+    /**
+     * Records an upload of pixels into an existing texture.
+     *
+     * @param bytes the number of bytes read from the source buffer
+     * @param nanos the time the render thread spent in the upload call,
+     *        including copying the pixels
+     */
+    public static void textureUploaded(long bytes, long nanos) {
+        if (!enabled) return;
+
+        uploadCount++;
+        uploadBytes += bytes;
+        uploadNanos += nanos;
+    }
+
     private PrismTrace() {
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -72,6 +72,7 @@ final class SWPresentable extends SWRTTexture implements Presentable {
 
     @Override
     public boolean present() {
+        pState.commitFrameDamage(pixels);
         pixelSource.enqueuePixels(pixels);
         pState.uploadPixels(pixelSource);
         return true;
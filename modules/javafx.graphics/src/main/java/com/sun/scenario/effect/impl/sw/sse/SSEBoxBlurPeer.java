@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -83,6 +83,28 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
 
         int finalw = curw + growx;
         int finalh = curh + growy;
+        boolean multipass = horizontal
+            ? (curw + hinc < finalw)
+            : (curh + vinc < finalh);
+        if (multipass) {
+            // More than one pass is needed, run all of them natively into
+            // the final image without any intermediate images.
+            HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(finalw, finalh);
+            int dstscan = dst.getScanlineStride();
+            int[] dstPixels = dst.getPixelArray();
+            if (horizontal) {
+                filterHorizontalPasses(dstPixels, finalw, finalh, dstscan,
+                                       curPixels, curw, curh, curscan,
+                                       hinc);
+            } else {
+                filterVerticalPasses(dstPixels, finalw, finalh, dstscan,
+                                     curPixels, curw, curh, curscan,
+                                     vinc);
+            }
+            cur = dst;
+            curw = finalw;
+            curh = finalh;
+        }
         while (curw < finalw || curh < finalh) {
             int neww = curw + hinc;
             int newh = curh + vinc;
@@ -120,4 +142,14 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
     private static native void
         filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
                        int srcPixels[], int srcw, int srch, int srcscan);
+
+    private static native void
+        filterHorizontalPasses(int dstPixels[], int dstw, int dsth, int dstscan,
+                               int srcPixels[], int srcw, int srch, int srcscan,
+                               int hinc);
+
+    private static native void
+        filterVerticalPasses(int dstPixels[], int dstw, int dsth, int dstscan,
+                             int srcPixels[], int srcw, int srch, int srcscan,
+                             int vinc);
 }
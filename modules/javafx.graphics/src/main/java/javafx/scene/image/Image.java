@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,7 +32,7 @@ import java.net.URL;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.IntBuffer;
-import java.util.LinkedList;
+import java.util.PriorityQueue;
 import java.util.Queue;
 import java.util.concurrent.CancellationException;
 import java.util.regex.Pattern;
@@ -875,6 +875,17 @@ public class Image {
 
     private ImageTask backgroundTask;
 
+    /*
+     * Called by ImageView when this image is shown while it is still
+     * loading in the background, so that it is loaded before the images
+     * nobody is looking at yet.
+     */
+    void setLoadPriority(int priority) {
+        if (backgroundTask != null) {
+            backgroundTask.setPriority(priority);
+        }
+    }
+
     private void initialize(Object externalImage) {
         // we need to check the original values here, because setting placeholder
         // changes platformImage, so wrong branch of if would be used
@@ -1032,7 +1043,10 @@ public class Image {
         // The limit of MAX_RUNNING_TASKS is arbitrary, and was based on initial
         // testing with
         // about 60 2-6 megapixel images.
+        // Pending tasks are started visible images first, otherwise in the
+        // order they were created.
         synchronized (pendingTasks) {
+            backgroundTask.order = taskCount++;
             if (runningTasks >= MAX_RUNNING_TASKS) {
                 pendingTasks.offer(backgroundTask);
             } else {
@@ -1087,16 +1101,25 @@ public class Image {
         platformImage.set(newPlatformImage);
     }
 
-    private static final int MAX_RUNNING_TASKS = 4;
+    // The decoders run on a pool with one thread per core, so allow at
+    // least that many images to load at the same time.
+    private static final int MAX_RUNNING_TASKS =
+            Math.max(4, Runtime.getRuntime().availableProcessors());
     private static int runningTasks = 0;
+    private static long taskCount = 0;
     private static final Queue<ImageTask> pendingTasks =
-            new LinkedList<>();
+            new PriorityQueue<>();
 
     private final class ImageTask
-            implements AsyncOperationListener<ImageLoader> {
+            implements AsyncOperationListener<ImageLoader>, Comparable<ImageTask> {
 
         private final AsyncOperation peer;
 
+        // guarded by pendingTasks
+        private long order;
+        private int priority = AsyncOperation.PRIORITY_NORMAL;
+        private boolean started;
+
         public ImageTask() {
             peer = constructPeer();
         }
@@ -1104,7 +1127,14 @@ public class Image {
         @Override
         public void onCancel() {
             finishImage(new CancellationException("Loading cancelled"));
-            cycleTasks();
+            // a task cancelled while pending never took a running slot
+            boolean wasStarted;
+            synchronized (pendingTasks) {
+                wasStarted = started;
+            }
+            if (wasStarted) {
+                cycleTasks();
+            }
         }
 
         @Override
@@ -1130,13 +1160,44 @@ public class Image {
         }
 
         public void start() {
+            started = true;
+            if (priority != AsyncOperation.PRIORITY_NORMAL) {
+                peer.setPriority(priority);
+            }
             peer.start();
         }
 
         public void cancel() {
+            synchronized (pendingTasks) {
+                pendingTasks.remove(this);
+            }
             peer.cancel();
         }
 
+        public void setPriority(int newPriority) {
+            synchronized (pendingTasks) {
+                if (priority == newPriority) {
+                    return;
+                }
+                // the queue only orders elements as they are inserted
+                if (pendingTasks.remove(this)) {
+                    priority = newPriority;
+                    pendingTasks.offer(this);
+                    return;
+                }
+                priority = newPriority;
+            }
+            peer.setPriority(newPriority);
+        }
+
+        @Override
+        public int compareTo(ImageTask other) {
+            if (priority != other.priority) {
+                return priority > other.priority ? -1 : 1;
+            }
+            return Long.compare(order, other.order);
+        }
+
         private AsyncOperation constructPeer() {
             if(inputSource == null) {
                 return loadImageAsync(this, url, requestedWidth, requestedHeight, preserveRatio, smooth);
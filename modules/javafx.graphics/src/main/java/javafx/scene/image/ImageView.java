@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,7 @@ import com.sun.javafx.css.CssUtil;
 import com.sun.javafx.css.StyleManager;
 import com.sun.javafx.geom.BaseBounds;
 import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.javafx.runtime.async.AsyncOperation;
 import com.sun.javafx.scene.DirtyBits;
 import com.sun.javafx.scene.ImageViewHelper;
 import com.sun.javafx.scene.NodeHelper;
@@ -957,8 +958,14 @@ public non-sealed class ImageView extends Node {
             peer.setSmooth(isSmooth());
         }
         if (NodeHelper.isDirty(this, DirtyBits.NODE_CONTENTS)) {
-            peer.setImage(getImage() != null
-                    ? Toolkit.getImageAccessor().getPlatformImage(getImage()) : null);
+            final Image image = getImage();
+            peer.setImage(image != null
+                    ? Toolkit.getImageAccessor().getPlatformImage(image) : null);
+            // load what is on screen before the rest of a gallery
+            if (image != null && image.getProgress() < 1
+                    && NodeHelper.isTreeVisible(this)) {
+                image.setLoadPriority(AsyncOperation.PRIORITY_VISIBLE);
+            }
         }
         // The NG part expects this to be called when image changes
         if (NodeHelper.isDirty(this, DirtyBits.NODE_VIEWPORT) || NodeHelper.isDirty(this, DirtyBits.NODE_CONTENTS)) {
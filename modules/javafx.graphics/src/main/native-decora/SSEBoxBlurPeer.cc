@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,9 +29,71 @@
  */
 
 #include <jni.h>
+#include <stdlib.h>
 #include "SSEUtils.h"
+#include "SSEBoxUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
 
+/*
+ * Horizontal box of width (dstw - srcw + 1) over one row.
+ * The src and dst rows must not overlap.
+ */
+static void filterRow(jint *dst, jint dstw,
+                      const jint *src, jint srcw,
+                      boxsum_t kscale)
+{
+    jint hsize = dstw - srcw + 1;
+    boxsum_t sum = box_zero();
+    for (jint x = 0; x < dstw; x++) {
+        // Un-accumulate the data for col-hsize location into the sums.
+        if (x >= hsize) {
+            sum = box_sub(sum, box_unpack(src[x - hsize]));
+        }
+        // Accumulate the data for this col location into the sums.
+        if (x < srcw) {
+            sum = box_add(sum, box_unpack(src[x]));
+        }
+        dst[x] = box_pack(sum, kscale);
+    }
+}
+
+/*
+ * Vertical box of height (dsth - srch + 1) over a strip of ncols
+ * (at most BOX_STRIP_WIDTH) adjacent columns.  The whole strip is
+ * advanced one row at a time so that the accesses for each row are
+ * contiguous instead of one cache miss per pixel.
+ */
+static void filterStrip(jint *dst, jint dsth, jint dstscan,
+                        const jint *src, jint srch, jint srcscan,
+                        jint ncols, boxsum_t kscale)
+{
+    boxsum_t sums[BOX_STRIP_WIDTH];
+    for (jint i = 0; i < ncols; i++) {
+        sums[i] = box_zero();
+    }
+    jint vsize = dsth - srch + 1;
+    for (jint y = 0; y < dsth; y++) {
+        // Un-accumulate the data for row-vsize location into the sums.
+        if (y >= vsize) {
+            const jint *old = src + (y - vsize) * srcscan;
+            for (jint i = 0; i < ncols; i++) {
+                sums[i] = box_sub(sums[i], box_unpack(old[i]));
+            }
+        }
+        // Accumulate the data for this row location into the sums.
+        if (y < srch) {
+            const jint *cur = src + y * srcscan;
+            for (jint i = 0; i < ncols; i++) {
+                sums[i] = box_add(sums[i], box_unpack(cur[i]));
+            }
+        }
+        jint *out = dst + y * dstscan;
+        for (jint i = 0; i < ncols; i++) {
+            out[i] = box_pack(sums[i], kscale);
+        }
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
     (JNIEnv *env, jclass klass,
@@ -41,7 +103,8 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
     if ((checkRange(env,
                     dstPixels_arr, dstw, dsth,
                     srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
+        dsth > srch || // We should not move out of source vertical bounds
+        dstw < srcw) {
         return;
     }
 
@@ -53,35 +116,11 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
         return;
     }
 
-    jint hsize = dstw - srcw + 1;
-    jint kscale = 0x7fffffff / (hsize * 255);
+    boxsum_t kscale = box_kscale(dstw - srcw + 1);
     jint srcoff = 0;
     jint dstoff = 0;
     for (jint y = 0; y < dsth; y++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        for (jint x = 0; x < dstw; x++) {
-            jint rgb;
-            // Un-accumulate the data for col-hsize location into the sums.
-            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff + x] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-        }
+        filterRow(dstPixels + dstoff, dstw, srcPixels + srcoff, srcw, kscale);
         srcoff += srcscan;
         dstoff += dstscan;
     }
@@ -99,7 +138,8 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
     if ((checkRange(env,
                     dstPixels_arr, dstw, dsth,
                     srcPixels_arr, srcw, srch)) ||
-        dstw > srcw) { // We should not move out of source horizontal bounds
+        dstw > srcw || // We should not move out of source horizontal bounds
+        dsth < srch) {
         return;
     }
 
@@ -111,42 +151,145 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
         return;
     }
 
-    jint vsize = dsth - srch + 1;
-    jint kscale = 0x7fffffff / (vsize * 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-            srcoff += srcscan;
-            dstoff += dstscan;
+    boxsum_t kscale = box_kscale(dsth - srch + 1);
+    for (jint x = 0; x < dstw; x += BOX_STRIP_WIDTH) {
+        jint ncols = dstw - x;
+        if (ncols > BOX_STRIP_WIDTH) ncols = BOX_STRIP_WIDTH;
+        filterStrip(dstPixels + x, dsth, dstscan,
+                    srcPixels + x, srch, srcscan,
+                    ncols, kscale);
+    }
+
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+}
+
+/*
+ * Performs all of the horizontal passes of a multi-pass box blur in one
+ * call.  Each pass grows the row by up to hinc pixels until it reaches
+ * dstw, exactly as the Java loop in SSEBoxBlurPeer.filter() would do with
+ * one intermediate image per pass.  Intermediate results only live in two
+ * scratch rows, so no intermediate images need to be allocated.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontalPasses
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint hinc)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dsth > srch || // We should not move out of source vertical bounds
+        dstw <= srcw || hinc < 1) {
+        return;
+    }
+
+    jint *scratch = (jint *) malloc(2 * sizeof(jint) * dstw);
+    if (scratch == NULL) return;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) {
+        free(scratch);
+        return;
+    }
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        free(scratch);
+        return;
+    }
+
+    jint srcoff = 0;
+    jint dstoff = 0;
+    for (jint y = 0; y < dsth; y++) {
+        const jint *cur = srcPixels + srcoff;
+        jint curw = srcw;
+        jint *next = scratch;
+        while (curw < dstw) {
+            jint neww = curw + hinc;
+            if (neww >= dstw) {
+                neww = dstw;
+                next = dstPixels + dstoff;
+            }
+            filterRow(next, neww, cur, curw, box_kscale(neww - curw + 1));
+            cur = next;
+            curw = neww;
+            next = (next == scratch) ? scratch + dstw : scratch;
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+
+    env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
+    env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+    free(scratch);
+}
+
+/*
+ * Vertical counterpart of filterHorizontalPasses.  The image is processed
+ * one strip of BOX_STRIP_WIDTH columns at a time and all of the passes for
+ * a strip are run back to back through two strip-sized scratch buffers.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVerticalPasses
+    (JNIEnv *env, jclass klass,
+     jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint vinc)
+{
+    if ((checkRange(env,
+                    dstPixels_arr, dstw, dsth,
+                    srcPixels_arr, srcw, srch)) ||
+        dstw > srcw || // We should not move out of source horizontal bounds
+        dsth <= srch || vinc < 1) {
+        return;
+    }
+
+    jint *scratch = (jint *) malloc(2 * sizeof(jint) * BOX_STRIP_WIDTH * dsth);
+    if (scratch == NULL) return;
+    jint *scratch2 = scratch + BOX_STRIP_WIDTH * dsth;
+
+    jint *srcPixels = (jint *)env->GetPrimitiveArrayCritical(srcPixels_arr, 0);
+    if (srcPixels == NULL) {
+        free(scratch);
+        return;
+    }
+    jint *dstPixels = (jint *)env->GetPrimitiveArrayCritical(dstPixels_arr, 0);
+    if (dstPixels == NULL) {
+        env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+        free(scratch);
+        return;
+    }
+
+    for (jint x = 0; x < dstw; x += BOX_STRIP_WIDTH) {
+        jint ncols = dstw - x;
+        if (ncols > BOX_STRIP_WIDTH) ncols = BOX_STRIP_WIDTH;
+        const jint *cur = srcPixels + x;
+        jint curh = srch;
+        jint curscan = srcscan;
+        jint *next = scratch;
+        jint nextscan = BOX_STRIP_WIDTH;
+        while (curh < dsth) {
+            jint newh = curh + vinc;
+            if (newh >= dsth) {
+                newh = dsth;
+                next = dstPixels + x;
+                nextscan = dstscan;
+            }
+            filterStrip(next, newh, nextscan, cur, curh, curscan,
+                        ncols, box_kscale(newh - curh + 1));
+            cur = next;
+            curh = newh;
+            curscan = nextscan;
+            next = (next == scratch) ? scratch2 : scratch;
         }
     }
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+    free(scratch);
 }
 
 #if 0
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,8 +30,66 @@
 
 #include <jni.h>
 #include "SSEUtils.h"
+#include "SSEBoxUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer.h"
 
+/*
+ * Runs the vertical alpha box over a strip of ncols (a multiple of 4, at
+ * most BOX_STRIP_WIDTH) adjacent columns with one column per vector lane.
+ * Rows of the strip are read and written contiguously.  The alpha sums
+ * are clamped against amin/amax exactly as in the scalar column loops;
+ * sums in between are converted through the per-channel scales in kscales
+ * (lanes B, G, R, A) and channels with a zero scale are left out.
+ */
+static void filterStripAlpha(jint *dst, jint dsth, jint dstscan,
+                             const jint *src, jint srch, jint srcscan,
+                             jint ncols, jint amin, jint amax,
+                             const jint kscales[4], jint maxval)
+{
+    boxsum_t sums[BOX_STRIP_WIDTH / 4];
+    jint ngroups = ncols / 4;
+    for (jint i = 0; i < ngroups; i++) {
+        sums[i] = box_zero();
+    }
+    boxsum_t vamin = box_splat(amin);
+    boxsum_t vamax = box_splat(amax);
+    boxsum_t vmaxval = box_splat(maxval);
+    boxsum_t vkscale[4];
+    for (jint c = 0; c < 4; c++) {
+        vkscale[c] = box_splat(kscales[c]);
+    }
+    jint vsize = dsth - srch + 1;
+    for (jint y = 0; y < dsth; y++) {
+        // Un-accumulate the data for row-vsize location into the sums.
+        if (y >= vsize) {
+            const jint *old = src + (y - vsize) * srcscan;
+            for (jint i = 0; i < ngroups; i++) {
+                sums[i] = box_sub(sums[i], box_load_alpha4(old + i * 4));
+            }
+        }
+        // Accumulate the data for this row location into the sums.
+        if (y < srch) {
+            const jint *cur = src + y * srcscan;
+            for (jint i = 0; i < ngroups; i++) {
+                sums[i] = box_add(sums[i], box_load_alpha4(cur + i * 4));
+            }
+        }
+        // Clamp, scale and convert the sums into colors.
+        jint *out = dst + y * dstscan;
+        for (jint i = 0; i < ngroups; i++) {
+            boxsum_t mid = box_zero();
+            for (jint c = 0; c < 4; c++) {
+                if (kscales[c] != 0) {
+                    mid = box_or(mid, box_shl(box_mulshift(sums[i], vkscale[c]),
+                                              c * 8));
+                }
+            }
+            box_store4(out + i * 4,
+                       box_clamp(sums[i], vamin, vamax, mid, vmaxval));
+        }
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
     (JNIEnv *env, jclass klass,
@@ -115,7 +173,17 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
     jint kscale = 0x7fffffff / amax;
     jint amin = (amax / 255);
     jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
+    // Full groups of 4 columns are done in strips, one column per lane.
+    jint kscales[4] = { 0, 0, 0, kscale };
+    jint xvec = dstw & ~3;
+    for (jint x = 0; x < xvec; x += BOX_STRIP_WIDTH) {
+        jint ncols = xvec - x;
+        if (ncols > BOX_STRIP_WIDTH) ncols = BOX_STRIP_WIDTH;
+        filterStripAlpha(dstPixels + x, dsth, dstscan,
+                         srcPixels + x, srch, srcscan,
+                         ncols, amin, amax, kscales, 0xff000000);
+    }
+    for (jint x = xvec; x < dstw; x++) {
         jint suma = 0;
         jint srcoff = x;
         jint dstoff = x;
@@ -182,7 +250,17 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
         (((jint) (shadowColor[1] * 255)) <<  8) |
         (((jint) (shadowColor[2] * 255))      ) |
         (((jint) (shadowColor[3] * 255)) << 24);
-    for (jint x = 0; x < dstw; x++) {
+    // Full groups of 4 columns are done in strips, one column per lane.
+    jint kscales[4] = { kscaleb, kscaleg, kscaler, kscalea };
+    jint xvec = dstw & ~3;
+    for (jint x = 0; x < xvec; x += BOX_STRIP_WIDTH) {
+        jint ncols = xvec - x;
+        if (ncols > BOX_STRIP_WIDTH) ncols = BOX_STRIP_WIDTH;
+        filterStripAlpha(dstPixels + x, dsth, dstscan,
+                         srcPixels + x, srch, srcscan,
+                         ncols, amin, amax, kscales, shadowRGB);
+    }
+    for (jint x = xvec; x < dstw; x++) {
         jint suma = 0;
         jint srcoff = x;
         jint dstoff = x;
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_SSEBoxUtils
+#define _Included_SSEBoxUtils
+
+#include <jni.h>
+
+/*
+ * Running-sum helpers shared by the box blur and box shadow peers.
+ *
+ * A "boxsum" holds the four per-channel sums of a premultiplied ARGB
+ * pixel in one vector register, lanes ordered B, G, R, A (the little
+ * endian byte order of the packed pixel).  box_pack() computes exactly
+ * the same ((sum * kscale) >> 23) as the scalar loops so that results
+ * are bit for bit identical on every code path.
+ *
+ * The same 4 x 32-bit type is also used with one lane per column by the
+ * single channel shadow passes, see box_load_alpha4() and box_clamp().
+ *
+ * The vertical passes walk the image in strips of BOX_STRIP_WIDTH
+ * columns so that every row access touches whole cache lines instead
+ * of a single pixel per scanline.
+ */
+
+#define BOX_STRIP_WIDTH 16
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BOX_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define BOX_USE_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(BOX_USE_SSE2)
+
+typedef __m128i boxsum_t;
+
+static inline boxsum_t box_zero() {
+    return _mm_setzero_si128();
+}
+
+static inline boxsum_t box_splat(jint v) {
+    return _mm_set1_epi32(v);
+}
+
+static inline boxsum_t box_unpack(jint rgb) {
+    __m128i z = _mm_setzero_si128();
+    __m128i v = _mm_cvtsi32_si128(rgb);
+    v = _mm_unpacklo_epi8(v, z);
+    return _mm_unpacklo_epi16(v, z);
+}
+
+static inline boxsum_t box_add(boxsum_t a, boxsum_t b) {
+    return _mm_add_epi32(a, b);
+}
+
+static inline boxsum_t box_sub(boxsum_t a, boxsum_t b) {
+    return _mm_sub_epi32(a, b);
+}
+
+/*
+ * (a * b) >> 23 per lane.  SSE2 has no 32-bit lane multiply, so the even
+ * and odd lanes go through the 32x32->64 unsigned multiply separately.
+ * All operands are non-negative and the products fit in 31 bits.
+ */
+static inline boxsum_t box_mulshift(boxsum_t a, boxsum_t b) {
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 23);
+    __m128i odd  = _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32),
+                                                _mm_srli_epi64(b, 32)), 23);
+    even = _mm_and_si128(even, _mm_set_epi32(0, -1, 0, -1));
+    return _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+}
+
+static inline jint box_pack(boxsum_t sum, boxsum_t kscale) {
+    __m128i v = box_mulshift(sum, kscale);
+    v = _mm_packs_epi32(v, v);
+    v = _mm_packus_epi16(v, v);
+    return _mm_cvtsi128_si32(v);
+}
+
+static inline boxsum_t box_load_alpha4(const jint *p) {
+    return _mm_srli_epi32(_mm_loadu_si128((const __m128i *) p), 24);
+}
+
+static inline void box_store4(jint *p, boxsum_t v) {
+    _mm_storeu_si128((__m128i *) p, v);
+}
+
+static inline boxsum_t box_shl(boxsum_t v, int n) {
+    return _mm_sll_epi32(v, _mm_cvtsi32_si128(n));
+}
+
+static inline boxsum_t box_or(boxsum_t a, boxsum_t b) {
+    return _mm_or_si128(a, b);
+}
+
+/*
+ * Per lane: (sum < amin) ? 0 : ((sum >= amax) ? maxval : mid)
+ */
+static inline boxsum_t box_clamp(boxsum_t sum, boxsum_t amin, boxsum_t amax,
+                                 boxsum_t mid, boxsum_t maxval)
+{
+    __m128i lt = _mm_cmplt_epi32(sum, amin);
+    __m128i ge = _mm_xor_si128(_mm_cmplt_epi32(sum, amax),
+                               _mm_set1_epi32(-1));
+    __m128i r = _mm_andnot_si128(lt, mid);
+    return _mm_or_si128(_mm_and_si128(ge, maxval), _mm_andnot_si128(ge, r));
+}
+
+#elif defined(BOX_USE_NEON)
+
+typedef uint32x4_t boxsum_t;
+
+static inline boxsum_t box_zero() {
+    return vdupq_n_u32(0);
+}
+
+static inline boxsum_t box_splat(jint v) {
+    return vdupq_n_u32((uint32_t) v);
+}
+
+static inline boxsum_t box_unpack(jint rgb) {
+    uint8x8_t v = vreinterpret_u8_u32(vdup_n_u32((uint32_t) rgb));
+    return vmovl_u16(vget_low_u16(vmovl_u8(v)));
+}
+
+static inline boxsum_t box_add(boxsum_t a, boxsum_t b) {
+    return vaddq_u32(a, b);
+}
+
+static inline boxsum_t box_sub(boxsum_t a, boxsum_t b) {
+    return vsubq_u32(a, b);
+}
+
+static inline boxsum_t box_mulshift(boxsum_t a, boxsum_t b) {
+    return vshrq_n_u32(vmulq_u32(a, b), 23);
+}
+
+static inline jint box_pack(boxsum_t sum, boxsum_t kscale) {
+    uint16x4_t v16 = vmovn_u32(box_mulshift(sum, kscale));
+    uint8x8_t v8 = vmovn_u16(vcombine_u16(v16, v16));
+    return (jint) vget_lane_u32(vreinterpret_u32_u8(v8), 0);
+}
+
+static inline boxsum_t box_load_alpha4(const jint *p) {
+    return vshrq_n_u32(vld1q_u32((const uint32_t *) p), 24);
+}
+
+static inline void box_store4(jint *p, boxsum_t v) {
+    vst1q_u32((uint32_t *) p, v);
+}
+
+static inline boxsum_t box_shl(boxsum_t v, int n) {
+    return vshlq_u32(v, vdupq_n_s32(n));
+}
+
+static inline boxsum_t box_or(boxsum_t a, boxsum_t b) {
+    return vorrq_u32(a, b);
+}
+
+static inline boxsum_t box_clamp(boxsum_t sum, boxsum_t amin, boxsum_t amax,
+                                 boxsum_t mid, boxsum_t maxval)
+{
+    uint32x4_t r = vbicq_u32(mid, vcltq_u32(sum, amin));
+    return vbslq_u32(vcgeq_u32(sum, amax), maxval, r);
+}
+
+#else /* scalar fallback */
+
+typedef struct { jint v[4]; } boxsum_t;
+
+static inline boxsum_t box_zero() {
+    boxsum_t r = {{ 0, 0, 0, 0 }};
+    return r;
+}
+
+static inline boxsum_t box_splat(jint v) {
+    boxsum_t r = {{ v, v, v, v }};
+    return r;
+}
+
+static inline boxsum_t box_unpack(jint rgb) {
+    boxsum_t r = {{ (rgb      ) & 0xff, (rgb >>  8) & 0xff,
+                    (rgb >> 16) & 0xff, (rgb >> 24) & 0xff }};
+    return r;
+}
+
+static inline boxsum_t box_add(boxsum_t a, boxsum_t b) {
+    for (int i = 0; i < 4; i++) a.v[i] += b.v[i];
+    return a;
+}
+
+static inline boxsum_t box_sub(boxsum_t a, boxsum_t b) {
+    for (int i = 0; i < 4; i++) a.v[i] -= b.v[i];
+    return a;
+}
+
+static inline boxsum_t box_mulshift(boxsum_t a, boxsum_t b) {
+    for (int i = 0; i < 4; i++) {
+        a.v[i] = (jint) (((unsigned int) a.v[i] * (unsigned int) b.v[i]) >> 23);
+    }
+    return a;
+}
+
+static inline jint box_pack(boxsum_t sum, boxsum_t kscale) {
+    boxsum_t v = box_mulshift(sum, kscale);
+    return (v.v[3] << 24) + (v.v[2] << 16) + (v.v[1] << 8) + v.v[0];
+}
+
+static inline boxsum_t box_load_alpha4(const jint *p) {
+    boxsum_t r = {{ (p[0] >> 24) & 0xff, (p[1] >> 24) & 0xff,
+                    (p[2] >> 24) & 0xff, (p[3] >> 24) & 0xff }};
+    return r;
+}
+
+static inline void box_store4(jint *p, boxsum_t v) {
+    for (int i = 0; i < 4; i++) p[i] = v.v[i];
+}
+
+static inline boxsum_t box_shl(boxsum_t v, int n) {
+    for (int i = 0; i < 4; i++) v.v[i] = (jint) ((unsigned int) v.v[i] << n);
+    return v;
+}
+
+static inline boxsum_t box_or(boxsum_t a, boxsum_t b) {
+    for (int i = 0; i < 4; i++) a.v[i] |= b.v[i];
+    return a;
+}
+
+static inline boxsum_t box_clamp(boxsum_t sum, boxsum_t amin, boxsum_t amax,
+                                 boxsum_t mid, boxsum_t maxval)
+{
+    for (int i = 0; i < 4; i++) {
+        mid.v[i] = (sum.v[i] < amin.v[i]) ? 0
+            : ((sum.v[i] >= amax.v[i]) ? maxval.v[i] : mid.v[i]);
+    }
+    return mid;
+}
+
+#endif
+
+static inline boxsum_t box_kscale(jint ksize) {
+    return box_splat(0x7fffffff / (ksize * 255));
+}
+
+#endif /* _Included_SSEBoxUtils */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,12 +38,6 @@
 
 #define OS_NATIVE(func) Java_com_sun_javafx_font_freetype_OSFreetype_##func
 
-#define SAFE_FREE(PTR)  \
-    if ((PTR) != NULL) {  \
-        free(PTR);     \
-        (PTR) = NULL;     \
-    }
-
 extern jboolean checkAndClearException(JNIEnv *env);
 #ifdef STATIC_BUILD
 JNIEXPORT jint JNICALL
@@ -374,27 +368,99 @@ JNIEXPORT jobject JNICALL OS_NATIVE(getGlyphSlot)(JNIEnv *env, jclass that, jlon
     return result;
 }
 
-JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that, jlong facePtr)
+/*
+ * Loads and renders up to count glyphs, taken from glyphCodes at start, with
+ * the given load flags and copies
+ * their pixels, one byte per pixel and without row padding, into the direct
+ * buffer starting at dstOffset. The metrics of each glyph are stored in
+ * GLYPH_METRICS_SIZE consecutive ints, see OSFreetype.java for the layout.
+ *
+ * Returns the number of glyphs processed. The batch stops early when the
+ * pixels of a glyph do not fit in the buffer; the width and rows of that
+ * glyph are still stored so the caller can grow the buffer.
+ */
+#define GLYPH_METRICS_SIZE 10
+#define GLYPH_ERROR        0
+#define GLYPH_PIXEL_MODE   1
+#define GLYPH_WIDTH        2
+#define GLYPH_ROWS         3
+#define GLYPH_LEFT         4
+#define GLYPH_TOP          5
+#define GLYPH_ADVANCE_X    6
+#define GLYPH_ADVANCE_Y    7
+#define GLYPH_LINEAR_HORI  8
+#define GLYPH_OFFSET       9
+
+JNIEXPORT jint JNICALL OS_NATIVE(renderGlyphs)
+    (JNIEnv *env, jclass that, jlong arg0, jintArray arg1, jint arg2, jint arg3,
+     jint arg4, jobject arg5, jint arg6, jintArray arg7)
 {
-    if (!facePtr) return NULL;
-    FT_Face face = (FT_Face)facePtr;
-    FT_GlyphSlot slot = face->glyph;
-    if (!slot) return NULL;
-    FT_Bitmap bitmap = slot->bitmap;
-    unsigned char* src = bitmap.buffer;
-    if (!src) return NULL;
-    if (bitmap.pitch <= 0) return NULL;
-    if (bitmap.rows > INT_MAX / bitmap.pitch) return NULL;
-    size_t size = bitmap.pitch * bitmap.rows;
-    jbyteArray result = (*env)->NewByteArray(env, size);
-    if (result) {
-        unsigned char* dst = (*env)->GetPrimitiveArrayCritical(env, result, NULL);
-        if (dst) {
-            memcpy(dst, src, size);
-            (*env)->ReleasePrimitiveArrayCritical(env, result, dst, 0);
+    FT_Face face = (FT_Face)arg0;
+    if (!face || !arg1 || !arg5 || !arg7 || arg2 < 0 || arg3 <= 0) return 0;
+    if (arg3 > (*env)->GetArrayLength(env, arg1) - arg2) return 0;
+    if (arg3 > (*env)->GetArrayLength(env, arg7) / GLYPH_METRICS_SIZE) return 0;
+
+    unsigned char* dst = (unsigned char*)(*env)->GetDirectBufferAddress(env, arg5);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, arg5);
+    if (!dst || arg6 < 0 || arg6 > capacity) return 0;
+
+    jint *lparg1=NULL;
+    jint *lparg7=NULL;
+    jint count = 0;
+    if ((lparg1 = (*env)->GetIntArrayElements(env, arg1, NULL)) == NULL) goto fail;
+    if ((lparg7 = (*env)->GetIntArrayElements(env, arg7, NULL)) == NULL) goto fail;
+
+    jlong offset = arg6;
+    for (; count < arg3; count++) {
+        jint* m = lparg7 + count * GLYPH_METRICS_SIZE;
+        memset(m, 0, GLYPH_METRICS_SIZE * sizeof(jint));
+        m[GLYPH_OFFSET] = -1;
+        FT_Error error = FT_Load_Glyph(face, (FT_UInt)lparg1[arg2 + count], (FT_Int32)arg4);
+        m[GLYPH_ERROR] = (jint)error;
+        if (error) continue;
+
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap* bitmap = &slot->bitmap;
+        jint width = (jint)bitmap->width;
+        jint rows = (jint)bitmap->rows;
+        m[GLYPH_PIXEL_MODE] = (jint)bitmap->pixel_mode;
+        m[GLYPH_WIDTH] = width;
+        m[GLYPH_ROWS] = rows;
+        m[GLYPH_LEFT] = (jint)slot->bitmap_left;
+        m[GLYPH_TOP] = (jint)slot->bitmap_top;
+        m[GLYPH_ADVANCE_X] = (jint)slot->advance.x;
+        m[GLYPH_ADVANCE_Y] = (jint)slot->advance.y;
+        m[GLYPH_LINEAR_HORI] = (jint)slot->linearHoriAdvance;
+
+        /* Only the one byte per pixel modes are copied, see FTFontFile */
+        if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY &&
+            bitmap->pixel_mode != FT_PIXEL_MODE_LCD) continue;
+        if (!bitmap->buffer || width <= 0 || rows <= 0) continue;
+        if (bitmap->pitch < width) continue;
+        jlong size = (jlong)width * rows;
+        if (size > capacity - offset) break;
+
+        unsigned char* src = bitmap->buffer;
+        unsigned char* out = dst + offset;
+        if (bitmap->pitch == width) {
+            memcpy(out, src, (size_t)size);
+        } else {
+            /* Common for LCD glyphs */
+            jint y;
+            for (y = 0; y < rows; y++) {
+                memcpy(out, src, width);
+                out += width;
+                src += bitmap->pitch;
+            }
         }
+        m[GLYPH_OFFSET] = (jint)offset;
+        offset += size;
     }
-    return result;
+
+fail:
+    if (lparg7) (*env)->ReleaseIntArrayElements(env, arg7, lparg7, 0);
+    if (lparg1) (*env)->ReleaseIntArrayElements(env, arg1, lparg1, JNI_ABORT);
+    return count;
 }
 
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
@@ -492,8 +558,12 @@ JNIEXPORT jint JNICALL OS_NATIVE(FT_1Set_1Char_1Size)
 /***********************************************/
 
 #define F26DOT6TOFLOAT(n) (float)n/64.0;
-static const size_t DEFAULT_LEN_TYPES = 10;
-static const size_t DEFAULT_LEN_COORDS = 50;
+
+/*
+ * The outline is written into arrays supplied by the caller. Segments that
+ * do not fit are still counted so that the caller can grow the arrays to
+ * numTypes and numCoords and decompose the outline again.
+ */
 typedef struct _PathData {
     jbyte* pointTypes;
     size_t numTypes;
@@ -503,59 +573,36 @@ typedef struct _PathData {
     size_t lenCoords;
 } PathData;
 
-static PathData* checkSize(void* user, int coordCount)
+static void addSegment(PathData* info, jbyte type, int coordCount, const FT_Vector** points)
 {
-    PathData* info = (PathData *)user;
-
-    if (info->numTypes == info->lenTypes) {
-        if (info->lenTypes > SIZE_MAX - DEFAULT_LEN_TYPES) goto fail;
-        info->lenTypes += DEFAULT_LEN_TYPES;
-
-        jbyte* newPointTypes = (jbyte*)realloc(info->pointTypes, info->lenTypes * sizeof(jbyte));
-        if (newPointTypes == NULL) goto fail;
-        info->pointTypes = newPointTypes;
-    }
-
-    if (info->numCoords + (coordCount * 2) > info->lenCoords) {
-        if (info->lenCoords > SIZE_MAX - DEFAULT_LEN_COORDS) goto fail;
-        info->lenCoords += DEFAULT_LEN_COORDS;
-
-        jfloat* newPointCoords = (jfloat*)realloc(info->pointCoords, info->lenCoords * sizeof(jfloat));
-        if (newPointCoords == NULL) goto fail;
-        info->pointCoords = newPointCoords;
+    if (info->numTypes < info->lenTypes) {
+        info->pointTypes[info->numTypes] = type;
+    }
+    info->numTypes++;
+    if (info->numCoords + (coordCount * 2) <= info->lenCoords) {
+        jfloat* coords = info->pointCoords + info->numCoords;
+        int i;
+        for (i = 0; i < coordCount; i++) {
+            *coords++ = F26DOT6TOFLOAT(points[i]->x);
+            *coords++ = -F26DOT6TOFLOAT(points[i]->y);
+        }
     }
-
-    return info;
-
-fail:
-    SAFE_FREE(info->pointTypes);
-    SAFE_FREE(info->pointCoords);
-    return NULL;
+    info->numCoords += coordCount * 2;
 }
 
 static int JFX_Outline_MoveToFunc(const FT_Vector*   to,
                                   void*              user)
 {
-    PathData *info = checkSize(user, 1);
-    if (info == NULL) {
-        return FT_Err_Array_Too_Large;
-    }
-    info->pointTypes[info->numTypes++] = 0;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    const FT_Vector* points[] = { to };
+    addSegment((PathData *)user, 0, 1, points);
     return 0;
 }
 
 static int JFX_Outline_LineToFunc(const FT_Vector*   to,
                                   void*              user)
 {
-    PathData *info =  checkSize(user, 1);
-    if (info == NULL) {
-        return FT_Err_Array_Too_Large;
-    }
-    info->pointTypes[info->numTypes++] = 1;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    const FT_Vector* points[] = { to };
+    addSegment((PathData *)user, 1, 1, points);
     return 0;
 }
 
@@ -563,15 +610,8 @@ static int JFX_Outline_ConicToFunc(const FT_Vector*  control,
                                    const FT_Vector*  to,
                                    void*             user )
 {
-    PathData *info = checkSize(user, 2);
-    if (info == NULL) {
-        return FT_Err_Array_Too_Large;
-    }
-    info->pointTypes[info->numTypes++] = 2;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(control->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(control->y);
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    const FT_Vector* points[] = { control, to };
+    addSegment((PathData *)user, 2, 2, points);
     return 0;
 }
 
@@ -580,17 +620,8 @@ static int JFX_Outline_CubicToFunc(const FT_Vector*  control1,
                                    const FT_Vector*  to,
                                    void*             user)
 {
-    PathData *info = checkSize(user, 3);
-    if (info == NULL) {
-        return FT_Err_Array_Too_Large;
-    }
-    info->pointTypes[info->numTypes++] = 3;
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(control1->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(control1->y);
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(control2->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(control2->y);
-    info->pointCoords[info->numCoords++] = F26DOT6TOFLOAT(to->x);
-    info->pointCoords[info->numCoords++] = -F26DOT6TOFLOAT(to->y);
+    const FT_Vector* points[] = { control1, control2, to };
+    addSegment((PathData *)user, 3, 3, points);
     return 0;
 }
 
@@ -603,78 +634,39 @@ static const  FT_Outline_Funcs JFX_Outline_Funcs =
     0, 0
 };
 
-JNIEXPORT jobject JNICALL OS_NATIVE(FT_1Outline_1Decompose)
-    (JNIEnv *env, jclass that, jlong arg0)
+JNIEXPORT jint JNICALL OS_NATIVE(decomposeOutline)
+    (JNIEnv *env, jclass that, jlong arg0, jbyteArray arg1, jfloatArray arg2, jintArray arg3)
 {
     FT_Face face = (FT_Face)arg0;
-    if (face == NULL) return NULL;
+    if (face == NULL) return FT_Err_Invalid_Argument;
     FT_GlyphSlot slot = face->glyph;
-    if (slot == NULL) return NULL;
+    if (slot == NULL) return FT_Err_Invalid_Argument;
     FT_Outline* outline = &slot->outline;
-    if (outline == NULL) return NULL;
+    if (!arg1 || !arg2 || !arg3) return FT_Err_Invalid_Argument;
+    if ((*env)->GetArrayLength(env, arg3) < 2) return FT_Err_Invalid_Argument;
 
-    jobject path2D = NULL;
     PathData data;
-    data.pointTypes = (jbyte*)malloc(sizeof(jbyte) * DEFAULT_LEN_TYPES);
     data.numTypes = 0;
-    data.lenTypes = DEFAULT_LEN_TYPES;
-    if (data.pointTypes == NULL) {
-        data.pointCoords = NULL;
-        goto fail;
-    }
-
-    data.pointCoords = (jfloat*)malloc(sizeof(jfloat) * DEFAULT_LEN_COORDS);
+    data.lenTypes = (*env)->GetArrayLength(env, arg1);
+    data.pointTypes = NULL;
     data.numCoords = 0;
-    data.lenCoords = DEFAULT_LEN_COORDS;
-    if (data.pointCoords == NULL) goto fail;
-
-    /* Decompose outline */
-    FT_Error ftError = FT_Outline_Decompose(outline, &JFX_Outline_Funcs, &data);
-    if (ftError != FT_Err_Ok) goto fail;
-
-    static jclass path2DClass = NULL;
-    static jmethodID path2DCtr = NULL;
-    if (path2DClass == NULL) {
-        jclass tmpClass = (*env)->FindClass(env, "com/sun/javafx/geom/Path2D");
-        if ((*env)->ExceptionOccurred(env) || !tmpClass) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception or tmpClass == NULL");
-            goto fail;
-        }
-        path2DClass = (jclass)(*env)->NewGlobalRef(env, tmpClass);
-        path2DCtr = (*env)->GetMethodID(env, path2DClass, "<init>", "(I[BI[FI)V");
-        if ((*env)->ExceptionOccurred(env) || !path2DCtr) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception or path2DCtr == NULL");
-            goto fail;
-        }
-    }
-
-    jbyteArray types = (*env)->NewByteArray(env, data.numTypes);
-    jfloatArray coords = (*env)->NewFloatArray(env, data.numCoords);
-    if (types && coords) {
-        (*env)->SetByteArrayRegion(env, types, 0, data.numTypes, data.pointTypes);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        (*env)->SetFloatArrayRegion(env, coords, 0, data.numCoords, data.pointCoords);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        path2D = (*env)->NewObject(env, path2DClass, path2DCtr,
-                                   0 /*winding rule*/,
-                                   types, data.numTypes,
-                                   coords, data.numCoords);
-        if ((*env)->ExceptionOccurred(env) || !path2D) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception or path2D == NULL");
-            goto fail;
-        }
-    }
-
+    data.lenCoords = (*env)->GetArrayLength(env, arg2);
+    data.pointCoords = NULL;
+
+    /* No JNI calls are made while the outline is decomposed */
+    jint rc = FT_Err_Out_Of_Memory;
+    if ((data.pointTypes = (*env)->GetPrimitiveArrayCritical(env, arg1, NULL)) == NULL) goto fail;
+    if ((data.pointCoords = (*env)->GetPrimitiveArrayCritical(env, arg2, NULL)) == NULL) goto fail;
+    rc = (jint)FT_Outline_Decompose(outline, &JFX_Outline_Funcs, &data);
 fail:
-    SAFE_FREE(data.pointTypes);
-    SAFE_FREE(data.pointCoords);
-    return path2D;
+    if (data.pointCoords) (*env)->ReleasePrimitiveArrayCritical(env, arg2, data.pointCoords, 0);
+    if (data.pointTypes) (*env)->ReleasePrimitiveArrayCritical(env, arg1, data.pointTypes, 0);
+    if (rc == FT_Err_Ok) {
+        if (data.numTypes > INT_MAX || data.numCoords > INT_MAX) return FT_Err_Array_Too_Large;
+        jint counts[2] = { (jint)data.numTypes, (jint)data.numCoords };
+        (*env)->SetIntArrayRegion(env, arg3, 0, 2, counts);
+    }
+    return rc;
 }
 
 JNIEXPORT jboolean JNICALL JNICALL OS_NATIVE(isPangoEnabled)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <vector>
 
 #include "glass_general.h"
 #include "glass_view.h"
@@ -35,6 +36,32 @@
 
 #define JLONG_TO_GLASSVIEW(value) ((GlassView *) JLONG_TO_PTR(value))
 
+/*
+ * Converts the x, y, width, height quadruples passed to the _uploadPixels*
+ * methods. Returns the number of rectangles, -1 for the whole frame (no
+ * array given), or -2 if the arguments are invalid.
+ */
+static int get_dirty_rects(JNIEnv *env, jintArray array, jint count,
+                           std::vector<GdkRectangle> &rects)
+{
+    if (!array) return -1;
+    if (count < 0 || count > env->GetArrayLength(array) / 4) return -2;
+
+    std::vector<jint> coords(count * 4);
+    if (count > 0) {
+        env->GetIntArrayRegion(array, 0, count * 4, coords.data());
+    }
+
+    rects.resize(count);
+    for (jint i = 0; i < count; i++) {
+        rects[i].x = coords[i * 4];
+        rects[i].y = coords[i * 4 + 1];
+        rects[i].width = coords[i * 4 + 2];
+        rects[i].height = coords[i * 4 + 3];
+    }
+    return count;
+}
+
 extern "C" {
 
 /*
@@ -178,31 +205,37 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1scheduleRepaint
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsDirect
- * Signature: (JLjava/nio/Buffer;II)V
+ * Signature: (JLjava/nio/Buffer;II[II)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
-(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height)
+(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height,
+ jintArray dirtyRects, jint dirtyRectCount)
 {
     (void)jView;
 
     if (!ptr) return;
     if (!buffer) return;
 
+    std::vector<GdkRectangle> rects;
+    int nrects = get_dirty_rects(env, dirtyRects, dirtyRectCount, rects);
+    if (nrects < -1) return;
+
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         void *data = env->GetDirectBufferAddress(buffer);
 
-        view->current_window->paint(data, width, height);
+        view->current_window->paint(data, width, height, rects.data(), nrects);
     }
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsIntArray
- * Signature:  (J[IIII)V
+ * Signature:  (J[IIII[II)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
-  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height,
+   jintArray dirtyRects, jint dirtyRectCount)
 {
     (void)obj;
 
@@ -221,12 +254,16 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
         return;
     }
 
+    std::vector<GdkRectangle> rects;
+    int nrects = get_dirty_rects(env, dirtyRects, dirtyRectCount, rects);
+    if (nrects < -1) return;
+
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         int *data = NULL;
         data = (int*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height, rects.data(), nrects);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -235,10 +272,11 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsByteArray
- * Signature:  (J[BIII)V
+ * Signature:  (J[BIII[II)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
-  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height,
+   jintArray dirtyRects, jint dirtyRectCount)
 {
     (void)obj;
 
@@ -257,13 +295,17 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
         return;
     }
 
+    std::vector<GdkRectangle> rects;
+    int nrects = get_dirty_rects(env, dirtyRects, dirtyRectCount, rects);
+    if (nrects < -1) return;
+
     GlassView* view = JLONG_TO_GLASSVIEW(ptr);
     if (view->current_window) {
         unsigned char *data = NULL;
 
         data = (unsigned char*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height, rects.data(), nrects);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#include "glass_shm.h"
+#include "glass_general.h"
+
+#include <gdk/gdkx.h>
+#include <X11/Xutil.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <string.h>
+
+gboolean disableShm = FALSE;
+
+static int native_byte_order() {
+    const unsigned int one = 1;
+    return (*(const unsigned char *) &one) ? LSBFirst : MSBFirst;
+}
+
+ShmPresenter::ShmPresenter(GdkWindow *window)
+    : gdk_window(window), display(NULL), xwindow(0), visual(NULL), depth(0),
+      gc(NULL), completion_type(0), current(0), buffer_width(0), buffer_height(0),
+      initialized(false), failed(false) {
+    memset(buffers, 0, sizeof(buffers));
+}
+
+ShmPresenter::~ShmPresenter() {
+    if (initialized) {
+        gdk_window_remove_filter(gdk_window, filter, this);
+        destroy_buffer(&buffers[0]);
+        destroy_buffer(&buffers[1]);
+        XFreeGC(display, gc);
+    }
+}
+
+bool ShmPresenter::init() {
+    display = gdk_x11_display_get_xdisplay(gdk_window_get_display(gdk_window));
+    if (!XShmQueryExtension(display)) {
+        return false;
+    }
+
+    // Frames are premultiplied ARGB in native byte order, which is only
+    // directly usable with a 24 or 32 bit TrueColor visual.
+    GdkVisual *gdk_visual = gdk_window_get_visual(gdk_window);
+    visual = gdk_x11_visual_get_xvisual(gdk_visual);
+    depth = glass_gdk_visual_get_depth(gdk_visual);
+    if ((depth != 24 && depth != 32)
+            || visual->red_mask != 0xff0000
+            || visual->green_mask != 0xff00
+            || visual->blue_mask != 0xff) {
+        return false;
+    }
+
+    xwindow = gdk_x11_window_get_xid(gdk_window);
+    completion_type = XShmGetEventBase(display) + ShmCompletion;
+    gc = XCreateGC(display, xwindow, 0, NULL);
+    gdk_window_add_filter(gdk_window, filter, this);
+    initialized = true;
+    return true;
+}
+
+bool ShmPresenter::create_buffer(Buffer *buffer, int width, int height) {
+    memset(buffer, 0, sizeof(Buffer));
+
+    XImage *image = XShmCreateImage(display, visual, depth, ZPixmap, NULL,
+                                    &buffer->shminfo, width, height);
+    if (image == NULL) {
+        return false;
+    }
+    if (image->bits_per_pixel != 32 || image->byte_order != native_byte_order()) {
+        XDestroyImage(image);
+        return false;
+    }
+
+    buffer->shminfo.shmid = shmget(IPC_PRIVATE,
+                                   (size_t) image->bytes_per_line * image->height,
+                                   IPC_CREAT | 0600);
+    if (buffer->shminfo.shmid < 0) {
+        XDestroyImage(image);
+        return false;
+    }
+
+    buffer->shminfo.shmaddr = (char *) shmat(buffer->shminfo.shmid, NULL, 0);
+    if (buffer->shminfo.shmaddr == (char *) -1) {
+        shmctl(buffer->shminfo.shmid, IPC_RMID, NULL);
+        XDestroyImage(image);
+        return false;
+    }
+    buffer->shminfo.readOnly = True;
+
+    // XShmAttach fails asynchronously, e.g. for a remote display
+    gdk_error_trap_push();
+    Status attached = XShmAttach(display, &buffer->shminfo);
+    XSync(display, False);
+    gint error = gdk_error_trap_pop();
+
+    // The segment is released as soon as both sides detach from it
+    shmctl(buffer->shminfo.shmid, IPC_RMID, NULL);
+
+    if (!attached || error) {
+        shmdt(buffer->shminfo.shmaddr);
+        XDestroyImage(image);
+        return false;
+    }
+
+    image->data = buffer->shminfo.shmaddr;
+    buffer->image = image;
+    buffer->busy_serial = 0;
+    return true;
+}
+
+void ShmPresenter::destroy_buffer(Buffer *buffer) {
+    if (buffer->image) {
+        // Detach is queued behind any pending XShmPutImage of this buffer
+        XShmDetach(display, &buffer->shminfo);
+        shmdt(buffer->shminfo.shmaddr);
+        buffer->image->data = NULL;
+        XDestroyImage(buffer->image);
+        buffer->image = NULL;
+    }
+}
+
+bool ShmPresenter::ensure_buffers(int width, int height) {
+    if (width == buffer_width && height == buffer_height) {
+        return true;
+    }
+
+    destroy_buffer(&buffers[0]);
+    destroy_buffer(&buffers[1]);
+    buffer_width = buffer_height = 0;
+
+    if (!create_buffer(&buffers[0], width, height)) {
+        return false;
+    }
+    if (!create_buffer(&buffers[1], width, height)) {
+        destroy_buffer(&buffers[0]);
+        return false;
+    }
+
+    buffer_width = width;
+    buffer_height = height;
+    current = 0;
+    return true;
+}
+
+void ShmPresenter::wait_for(Buffer *buffer) {
+    if (buffer->busy_serial != 0) {
+        // The completion event has not arrived yet. Once XSync returns the
+        // server has processed every XShmPutImage, so both buffers are free.
+        XSync(display, False);
+        buffers[0].busy_serial = 0;
+        buffers[1].busy_serial = 0;
+    }
+}
+
+GdkFilterReturn ShmPresenter::filter(GdkXEvent *gdk_xevent, GdkEvent *event, gpointer data) {
+    (void) event;
+
+    ShmPresenter *self = (ShmPresenter *) data;
+    XEvent *xevent = (XEvent *) gdk_xevent;
+    if (xevent->type != self->completion_type) {
+        return GDK_FILTER_CONTINUE;
+    }
+
+    XShmCompletionEvent *completion = (XShmCompletionEvent *) xevent;
+    for (int i = 0; i < 2; i++) {
+        Buffer *buffer = &self->buffers[i];
+        if (buffer->image && buffer->busy_serial != 0
+                && buffer->shminfo.shmseg == completion->shmseg
+                && (long) (completion->serial - buffer->busy_serial) >= 0) {
+            buffer->busy_serial = 0;
+        }
+    }
+    return GDK_FILTER_REMOVE;
+}
+
+bool ShmPresenter::present(const void *data, int width, int height,
+                           const GdkRectangle *rects, int nrects) {
+    if (failed || disableShm) {
+        return false;
+    }
+    if (!initialized && !init()) {
+        failed = true;
+        return false;
+    }
+    if (!ensure_buffers(width, height)) {
+        failed = true;
+        return false;
+    }
+
+    Buffer *buffer = &buffers[current];
+    wait_for(buffer);
+
+    XImage *image = buffer->image;
+    const char *src = (const char *) data;
+    size_t src_stride = (size_t) width * 4;
+    unsigned long serial = 0;
+
+    for (int i = 0; i < nrects; i++) {
+        int x0 = MAX(rects[i].x, 0);
+        int y0 = MAX(rects[i].y, 0);
+        int x1 = MIN(rects[i].x + rects[i].width, width);
+        int y1 = MIN(rects[i].y + rects[i].height, height);
+        if (x0 >= x1 || y0 >= y1) {
+            continue;
+        }
+
+        size_t row_bytes = (size_t) (x1 - x0) * 4;
+        for (int y = y0; y < y1; y++) {
+            memcpy(image->data + (size_t) y * image->bytes_per_line + (size_t) x0 * 4,
+                   src + y * src_stride + (size_t) x0 * 4,
+                   row_bytes);
+        }
+
+        serial = NextRequest(display);
+        XShmPutImage(display, xwindow, gc, image,
+                     x0, y0, x0, y0, x1 - x0, y1 - y0, True);
+    }
+
+    if (serial != 0) {
+        buffer->busy_serial = serial;
+        XFlush(display);
+        current ^= 1;
+    }
+    return true;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+#ifndef GLASS_SHM_H
+#define        GLASS_SHM_H
+
+#include <gtk/gtk.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
+
+extern gboolean disableShm;
+
+/*
+ * Presents software rendered frames to an X11 window through MIT-SHM.
+ *
+ * Frames are copied into one of two shared memory XImages and pushed with
+ * XShmPutImage, so no pixel data goes through the X protocol. While the
+ * server is still reading one buffer the next frame is written into the
+ * other one; ShmCompletion events mark a buffer as reusable. Only the given
+ * dirty rectangles are copied and pushed.
+ *
+ * If the server has no MIT-SHM, or attaching fails (for instance on a
+ * remote display), present() returns false and the caller falls back to
+ * the cairo path.
+ */
+class ShmPresenter {
+public:
+    explicit ShmPresenter(GdkWindow *window);
+    ~ShmPresenter();
+
+    bool present(const void *data, int width, int height,
+                 const GdkRectangle *rects, int nrects);
+private:
+    struct Buffer {
+        XShmSegmentInfo shminfo;
+        XImage *image;
+        unsigned long busy_serial;
+    };
+
+    bool init();
+    bool ensure_buffers(int width, int height);
+    bool create_buffer(Buffer *buffer, int width, int height);
+    void destroy_buffer(Buffer *buffer);
+    void wait_for(Buffer *buffer);
+
+    static GdkFilterReturn filter(GdkXEvent *xevent, GdkEvent *event, gpointer data);
+
+    GdkWindow *gdk_window;
+    Display *display;
+    Window xwindow;
+    Visual *visual;
+    int depth;
+    GC gc;
+    int completion_type;
+
+    Buffer buffers[2];
+    int current;
+    int buffer_width;
+    int buffer_height;
+
+    bool initialized;
+    bool failed;
+
+    ShmPresenter(ShmPresenter&);
+    ShmPresenter& operator= (const ShmPresenter&);
+};
+
+#endif        /* GLASS_SHM_H */
@@ -503,10 +503,32 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
+void WindowContextBase::paint(void* data, jint width, jint height,
+                              const GdkRectangle* rects, int nrects) {
+    GdkRectangle full = {0, 0, width, height};
+    if (nrects < 0) {
+        rects = &full;
+        nrects = 1;
+    }
+    if (nrects == 0) {
+        return;
+    }
+
+    if (!disableShm && gdk_window) {
+        if (!shm_presenter) {
+            shm_presenter = new ShmPresenter(gdk_window);
+        }
+        if (shm_presenter->present(data, width, height, rects, nrects)) {
+            applyShapeMask(data, width, height);
+            return;
+        }
+    }
+
+    cairo_region_t *region = cairo_region_create();
+    for (int i = 0; i < nrects; i++) {
+        cairo_region_union_rectangle(region, &rects[i]);
+    }
 #ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
-    cairo_region_t *region = cairo_region_create_rectangle(&rect);
     gdk_window_begin_paint_region(gdk_window, region);
 #endif
     cairo_t* context = gdk_cairo_create(gdk_window);
@@ -519,14 +541,16 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
 
     applyShapeMask(data, width, height);
 
+    gdk_cairo_region(context, region);
+    cairo_clip(context);
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
     cairo_paint(context);
 
 #ifdef GLASS_GTK3
     gdk_window_end_paint(gdk_window);
-    cairo_region_destroy(region);
 #endif
+    cairo_region_destroy(region);
 
     cairo_destroy(context);
     cairo_surface_destroy(cairo_surface);
@@ -674,6 +698,7 @@ bool WindowContextBase::get_window_edge(int x, int y, GdkWindowEdge* window_edge
 
 WindowContextBase::~WindowContextBase() {
     disableIME();
+    delete shm_presenter;
     gtk_widget_destroy(gtk_widget);
 }
 
@@ -35,6 +35,7 @@
 #include "DeletedMemDebug.h"
 
 #include "glass_view.h"
+#include "glass_shm.h"
 
 enum WindowManager {
     COMPIZ,
@@ -109,7 +110,8 @@ public:
     virtual void setOnPreEdit(bool) = 0;
     virtual void commitIME(gchar *) = 0;
 
-    virtual void paint(void* data, jint width, jint height) = 0;
+    // rects/nrects limit the update to the given areas, nrects < 0 means the whole frame
+    virtual void paint(void* data, jint width, jint height, const GdkRectangle* rects, int nrects) = 0;
     virtual WindowGeometry get_geometry() = 0;
 
     virtual void show_system_menu(int x, int y) = 0;
@@ -200,6 +202,7 @@ protected:
     GdkCursor* gdk_cursor = NULL;
     GdkCursor* gdk_cursor_override = NULL;
     GdkWMFunction gdk_windowManagerFunctions;
+    ShmPresenter* shm_presenter = NULL;
 
     bool is_iconified;
     bool is_maximized;
@@ -233,7 +236,7 @@ public:
     void commitIME(gchar *);
     void updateCaretPos();
     void disableIME();
-    void paint(void*, jint, jint);
+    void paint(void*, jint, jint, const GdkRectangle*, int);
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
@@ -0,0 +1,663 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+// Implementation of native methods in DRMSystem.java
+//
+// The DRM/KMS device is driven with the kernel ioctls directly, so only the
+// uapi headers shipped with libdrm are needed at build time and no library
+// is needed at run time. The library is built along with the other Monocle
+// native libraries for the embedded Linux targets only.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <drm.h>
+#include <drm_mode.h>
+
+#include "com_sun_glass_ui_monocle_DRMSystem.h"
+
+#include "Monocle.h"
+
+#define DRM_BUFFER_COUNT 2
+#define DRM_MAX_DAMAGE_CLIPS 16
+
+typedef struct {
+    uint32_t handle;
+    uint32_t fbId;
+    uint32_t pitch;
+    uint64_t size;
+    void *map;
+} DRMBuffer;
+
+typedef struct {
+    int fd;
+    uint32_t connectorId;
+    uint32_t crtcId;
+    int crtcIndex;
+    struct drm_mode_modeinfo mode;
+    uint32_t mmWidth;
+    uint32_t mmHeight;
+    DRMBuffer buffers[DRM_BUFFER_COUNT];
+    // The CRTC configuration found on opening, restored on closing
+    struct drm_mode_crtc savedCrtc;
+    // Atomic mode setting, used only when the primary plane accepts damage
+    int atomic;
+    uint32_t planeId;
+    uint32_t planeFbIdProp;
+    uint32_t planeCrtcIdProp;
+    uint32_t planeDamageProp;
+    int flipPending;
+} DRMDevice;
+
+static int drm_ioctl(int fd, unsigned long request, void *arg) {
+    int rc;
+    do {
+        rc = ioctl(fd, request, arg);
+    } while (rc == -1 && (errno == EINTR || errno == EAGAIN));
+    return rc;
+}
+
+static void *drm_calloc(uint32_t count, size_t size) {
+    return calloc(count ? count : 1, size);
+}
+
+/*
+ * Finds the id of the named property on a mode object, or 0. If value is not
+ * NULL it receives the current value of the property.
+ */
+static uint32_t drm_find_property(int fd, uint32_t objId, uint32_t objType,
+                                  const char *name, uint64_t *value) {
+    struct drm_mode_obj_get_properties props;
+    memset(&props, 0, sizeof(props));
+    props.obj_id = objId;
+    props.obj_type = objType;
+    if (drm_ioctl(fd, DRM_IOCTL_MODE_OBJ_GETPROPERTIES, &props) != 0) {
+        return 0;
+    }
+    uint32_t count = props.count_props;
+    uint32_t *ids = drm_calloc(count, sizeof(uint32_t));
+    uint64_t *values = drm_calloc(count, sizeof(uint64_t));
+    uint32_t result = 0;
+    if (ids != NULL && values != NULL) {
+        props.props_ptr = (uint64_t) (unsigned long) ids;
+        props.prop_values_ptr = (uint64_t) (unsigned long) values;
+        if (drm_ioctl(fd, DRM_IOCTL_MODE_OBJ_GETPROPERTIES, &props) == 0) {
+            if (props.count_props < count) {
+                count = props.count_props;
+            }
+            for (uint32_t i = 0; i < count && result == 0; i++) {
+                struct drm_mode_get_property prop;
+                memset(&prop, 0, sizeof(prop));
+                prop.prop_id = ids[i];
+                if (drm_ioctl(fd, DRM_IOCTL_MODE_GETPROPERTY, &prop) == 0
+                        && strncmp(prop.name, name, DRM_PROP_NAME_LEN) == 0) {
+                    result = ids[i];
+                    if (value != NULL) {
+                        *value = values[i];
+                    }
+                }
+            }
+        }
+    }
+    free(ids);
+    free(values);
+    return result;
+}
+
+/*
+ * Looks for the primary plane of the CRTC and the plane properties needed to
+ * flip with damage clips. Leaves device->atomic cleared if any is missing.
+ */
+static void drm_init_atomic(DRMDevice *device) {
+    struct drm_set_client_cap cap;
+    cap.capability = DRM_CLIENT_CAP_ATOMIC;
+    cap.value = 1;
+    if (drm_ioctl(device->fd, DRM_IOCTL_SET_CLIENT_CAP, &cap) != 0) {
+        return;
+    }
+    struct drm_mode_get_plane_res res;
+    memset(&res, 0, sizeof(res));
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETPLANERESOURCES, &res) != 0) {
+        return;
+    }
+    uint32_t count = res.count_planes;
+    uint32_t *planes = drm_calloc(count, sizeof(uint32_t));
+    if (planes == NULL) {
+        return;
+    }
+    res.plane_id_ptr = (uint64_t) (unsigned long) planes;
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETPLANERESOURCES, &res) == 0) {
+        if (res.count_planes < count) {
+            count = res.count_planes;
+        }
+        for (uint32_t i = 0; i < count && device->planeId == 0; i++) {
+            struct drm_mode_get_plane plane;
+            uint64_t type = 0;
+            memset(&plane, 0, sizeof(plane));
+            plane.plane_id = planes[i];
+            if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETPLANE, &plane) != 0
+                    || (plane.possible_crtcs & (1u << device->crtcIndex)) == 0) {
+                continue;
+            }
+            if (drm_find_property(device->fd, planes[i], DRM_MODE_OBJECT_PLANE,
+                                  "type", &type) != 0
+                    && type == DRM_PLANE_TYPE_PRIMARY) {
+                device->planeId = planes[i];
+            }
+        }
+    }
+    free(planes);
+    if (device->planeId == 0) {
+        return;
+    }
+    device->planeFbIdProp = drm_find_property(device->fd, device->planeId,
+            DRM_MODE_OBJECT_PLANE, "FB_ID", NULL);
+    device->planeCrtcIdProp = drm_find_property(device->fd, device->planeId,
+            DRM_MODE_OBJECT_PLANE, "CRTC_ID", NULL);
+    device->planeDamageProp = drm_find_property(device->fd, device->planeId,
+            DRM_MODE_OBJECT_PLANE, "FB_DAMAGE_CLIPS", NULL);
+    device->atomic = device->planeFbIdProp != 0
+            && device->planeCrtcIdProp != 0
+            && device->planeDamageProp != 0;
+}
+
+/*
+ * Chooses the first connected connector, its preferred mode and a CRTC that
+ * can drive it.
+ */
+static int drm_find_output(DRMDevice *device) {
+    struct drm_mode_card_res res;
+    memset(&res, 0, sizeof(res));
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETRESOURCES, &res) != 0) {
+        return 0;
+    }
+    uint32_t countCrtcs = res.count_crtcs;
+    uint32_t countConnectors = res.count_connectors;
+    uint32_t *crtcs = drm_calloc(countCrtcs, sizeof(uint32_t));
+    uint32_t *connectors = drm_calloc(countConnectors, sizeof(uint32_t));
+    int found = 0;
+    if (crtcs == NULL || connectors == NULL) {
+        goto done;
+    }
+    memset(&res, 0, sizeof(res));
+    res.crtc_id_ptr = (uint64_t) (unsigned long) crtcs;
+    res.connector_id_ptr = (uint64_t) (unsigned long) connectors;
+    res.count_crtcs = countCrtcs;
+    res.count_connectors = countConnectors;
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETRESOURCES, &res) != 0) {
+        goto done;
+    }
+    if (res.count_crtcs < countCrtcs) {
+        countCrtcs = res.count_crtcs;
+    }
+    if (res.count_connectors < countConnectors) {
+        countConnectors = res.count_connectors;
+    }
+    for (uint32_t i = 0; i < countConnectors && !found; i++) {
+        struct drm_mode_get_connector conn;
+        memset(&conn, 0, sizeof(conn));
+        conn.connector_id = connectors[i];
+        if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETCONNECTOR, &conn) != 0
+                || conn.connection != 1 || conn.count_modes == 0) {
+            continue;
+        }
+        uint32_t countModes = conn.count_modes;
+        uint32_t countEncoders = conn.count_encoders;
+        struct drm_mode_modeinfo *modes =
+                drm_calloc(countModes, sizeof(struct drm_mode_modeinfo));
+        uint32_t *encoders = drm_calloc(countEncoders, sizeof(uint32_t));
+        if (modes != NULL && encoders != NULL) {
+            memset(&conn, 0, sizeof(conn));
+            conn.connector_id = connectors[i];
+            conn.modes_ptr = (uint64_t) (unsigned long) modes;
+            conn.count_modes = countModes;
+            conn.encoders_ptr = (uint64_t) (unsigned long) encoders;
+            conn.count_encoders = countEncoders;
+            if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETCONNECTOR, &conn) == 0
+                    && conn.count_modes > 0) {
+                if (conn.count_modes < countModes) {
+                    countModes = conn.count_modes;
+                }
+                if (conn.count_encoders < countEncoders) {
+                    countEncoders = conn.count_encoders;
+                }
+                device->mode = modes[0];
+                for (uint32_t m = 0; m < countModes; m++) {
+                    if (modes[m].type & DRM_MODE_TYPE_PREFERRED) {
+                        device->mode = modes[m];
+                        break;
+                    }
+                }
+                // Prefer the CRTC already driving the connector
+                for (uint32_t e = 0; e < countEncoders && !found; e++) {
+                    struct drm_mode_get_encoder enc;
+                    memset(&enc, 0, sizeof(enc));
+                    enc.encoder_id = encoders[e];
+                    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_GETENCODER, &enc) != 0) {
+                        continue;
+                    }
+                    for (uint32_t c = 0; c < countCrtcs && !found; c++) {
+                        if ((enc.crtc_id != 0 && enc.crtc_id == crtcs[c])
+                                || (enc.crtc_id == 0 && (enc.possible_crtcs & (1u << c)))) {
+                            device->connectorId = connectors[i];
+                            device->crtcId = crtcs[c];
+                            device->crtcIndex = (int) c;
+                            device->mmWidth = conn.mm_width;
+                            device->mmHeight = conn.mm_height;
+                            found = 1;
+                        }
+                    }
+                }
+            }
+        }
+        free(modes);
+        free(encoders);
+    }
+done:
+    free(crtcs);
+    free(connectors);
+    return found;
+}
+
+static void drm_destroy_buffer(DRMDevice *device, DRMBuffer *buffer) {
+    if (buffer->map != NULL) {
+        munmap(buffer->map, (size_t) buffer->size);
+        buffer->map = NULL;
+    }
+    if (buffer->fbId != 0) {
+        drm_ioctl(device->fd, DRM_IOCTL_MODE_RMFB, &buffer->fbId);
+        buffer->fbId = 0;
+    }
+    if (buffer->handle != 0) {
+        struct drm_mode_destroy_dumb destroy;
+        memset(&destroy, 0, sizeof(destroy));
+        destroy.handle = buffer->handle;
+        drm_ioctl(device->fd, DRM_IOCTL_MODE_DESTROY_DUMB, &destroy);
+        buffer->handle = 0;
+    }
+}
+
+/*
+ * Allocates a 32-bit XRGB dumb buffer the size of the mode, adds a frame
+ * buffer for it and maps it into our address space.
+ */
+static int drm_create_buffer(DRMDevice *device, DRMBuffer *buffer) {
+    struct drm_mode_create_dumb create;
+    memset(&create, 0, sizeof(create));
+    create.width = device->mode.hdisplay;
+    create.height = device->mode.vdisplay;
+    create.bpp = 32;
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_CREATE_DUMB, &create) != 0) {
+        return 0;
+    }
+    buffer->handle = create.handle;
+    buffer->pitch = create.pitch;
+    buffer->size = create.size;
+
+    struct drm_mode_fb_cmd fb;
+    memset(&fb, 0, sizeof(fb));
+    fb.width = create.width;
+    fb.height = create.height;
+    fb.pitch = create.pitch;
+    fb.bpp = 32;
+    fb.depth = 24;
+    fb.handle = create.handle;
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_ADDFB, &fb) != 0) {
+        drm_destroy_buffer(device, buffer);
+        return 0;
+    }
+    buffer->fbId = fb.fb_id;
+
+    struct drm_mode_map_dumb map;
+    memset(&map, 0, sizeof(map));
+    map.handle = create.handle;
+    if (drm_ioctl(device->fd, DRM_IOCTL_MODE_MAP_DUMB, &map) != 0) {
+        drm_destroy_buffer(device, buffer);
+        return 0;
+    }
+    void *addr = mmap(NULL, (size_t) create.size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED, device->fd, (off_t) map.offset);
+    if (addr == MAP_FAILED) {
+        drm_destroy_buffer(device, buffer);
+        return 0;
+    }
+    memset(addr, 0, (size_t) create.size);
+    buffer->map = addr;
+    return 1;
+}
+
+static void drm_close(DRMDevice *device) {
+    if (device->savedCrtc.crtc_id != 0) {
+        // Put back whatever was displayed before, typically the console
+        device->savedCrtc.set_connectors_ptr =
+                (uint64_t) (unsigned long) &device->connectorId;
+        device->savedCrtc.count_connectors = 1;
+        drm_ioctl(device->fd, DRM_IOCTL_MODE_SETCRTC, &device->savedCrtc);
+    }
+    for (int i = 0; i < DRM_BUFFER_COUNT; i++) {
+        drm_destroy_buffer(device, &device->buffers[i]);
+    }
+    close(device->fd);
+    free(device);
+}
+
+/*
+ * Reads events from the device until the pending page flip has completed.
+ */
+static int drm_wait_for_flip(DRMDevice *device) {
+    char buf[1024];
+    while (device->flipPending) {
+        struct pollfd pfd;
+        pfd.fd = device->fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        // A vblank is at most a few tens of milliseconds away; give up after
+        // a second so that a stuck driver cannot hang the renderer
+        int rc = poll(&pfd, 1, 1000);
+        if (rc < 0 && errno == EINTR) {
+            continue;
+        }
+        if (rc <= 0) {
+            device->flipPending = 0;
+            return rc == 0 ? ETIMEDOUT : errno;
+        }
+        ssize_t len = read(device->fd, buf, sizeof(buf));
+        if (len < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                continue;
+            }
+            device->flipPending = 0;
+            return errno;
+        }
+        ssize_t i = 0;
+        while (i + (ssize_t) sizeof(struct drm_event) <= len) {
+            struct drm_event *e = (struct drm_event *) &buf[i];
+            if (e->length < sizeof(struct drm_event)) {
+                break;
+            }
+            if (e->type == DRM_EVENT_FLIP_COMPLETE) {
+                device->flipPending = 0;
+            }
+            i += e->length;
+        }
+    }
+    return 0;
+}
+
+static int drm_atomic_flip(DRMDevice *device, DRMBuffer *buffer,
+                           struct drm_mode_rect *clips, int count) {
+    uint32_t blobId = 0;
+    if (count > 0) {
+        struct drm_mode_create_blob blob;
+        memset(&blob, 0, sizeof(blob));
+        blob.data = (uint64_t) (unsigned long) clips;
+        blob.length = (uint32_t) (count * sizeof(struct drm_mode_rect));
+        if (drm_ioctl(device->fd, DRM_IOCTL_MODE_CREATEPROPBLOB, &blob) == 0) {
+            blobId = blob.blob_id;
+        }
+    }
+    uint32_t objs[1] = { device->planeId };
+    uint32_t countProps[1] = { 3 };
+    uint32_t props[3] = {
+        device->planeFbIdProp, device->planeCrtcIdProp, device->planeDamageProp
+    };
+    // Setting CRTC_ID pulls the CRTC into the commit so that it delivers
+    // the flip event; with no damage blob the whole plane is updated
+    uint64_t values[3] = { buffer->fbId, device->crtcId, blobId };
+
+    struct drm_mode_atomic atomic;
+    memset(&atomic, 0, sizeof(atomic));
+    atomic.flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
+    atomic.count_objs = 1;
+    atomic.objs_ptr = (uint64_t) (unsigned long) objs;
+    atomic.count_props_ptr = (uint64_t) (unsigned long) countProps;
+    atomic.props_ptr = (uint64_t) (unsigned long) props;
+    atomic.prop_values_ptr = (uint64_t) (unsigned long) values;
+    int rc = drm_ioctl(device->fd, DRM_IOCTL_MODE_ATOMIC, &atomic) == 0 ? 0 : errno;
+    if (blobId != 0) {
+        // The commit holds its own reference to the blob
+        struct drm_mode_destroy_blob destroy;
+        destroy.blob_id = blobId;
+        drm_ioctl(device->fd, DRM_IOCTL_MODE_DESTROYPROPBLOB, &destroy);
+    }
+    return rc;
+}
+
+static int drm_legacy_flip(DRMDevice *device, DRMBuffer *buffer,
+                           struct drm_mode_rect *clips, int count) {
+    if (count > 0) {
+        // Drivers that track damage turn this into damage clips for the plane
+        struct drm_clip_rect rects[DRM_MAX_DAMAGE_CLIPS];
+        for (int i = 0; i < count; i++) {
+            rects[i].x1 = (unsigned short) clips[i].x1;
+            rects[i].y1 = (unsigned short) clips[i].y1;
+            rects[i].x2 = (unsigned short) clips[i].x2;
+            rects[i].y2 = (unsigned short) clips[i].y2;
+        }
+        struct drm_mode_fb_dirty_cmd dirty;
+        memset(&dirty, 0, sizeof(dirty));
+        dirty.fb_id = buffer->fbId;
+        dirty.num_clips = (uint32_t) count;
+        dirty.clips_ptr = (uint64_t) (unsigned long) rects;
+        drm_ioctl(device->fd, DRM_IOCTL_MODE_DIRTYFB, &dirty);
+    }
+    struct drm_mode_crtc_page_flip flip;
+    memset(&flip, 0, sizeof(flip));
+    flip.crtc_id = device->crtcId;
+    flip.fb_id = buffer->fbId;
+    flip.flags = DRM_MODE_PAGE_FLIP_EVENT;
+    return drm_ioctl(device->fd, DRM_IOCTL_MODE_PAGE_FLIP, &flip) == 0 ? 0 : errno;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_openDevice
+  (JNIEnv *env, jobject UNUSED(obj), jstring pathS) {
+    const char *path = (*env)->GetStringUTFChars(env, pathS, NULL);
+    if (path == NULL) {
+        return 0;
+    }
+    int fd = open(path, O_RDWR | O_CLOEXEC);
+    (*env)->ReleaseStringUTFChars(env, pathS, path);
+    if (fd < 0) {
+        return 0;
+    }
+    DRMDevice *device = calloc(1, sizeof(DRMDevice));
+    if (device == NULL) {
+        close(fd);
+        return 0;
+    }
+    device->fd = fd;
+
+    struct drm_get_cap cap;
+    memset(&cap, 0, sizeof(cap));
+    cap.capability = DRM_CAP_DUMB_BUFFER;
+    if (drm_ioctl(fd, DRM_IOCTL_GET_CAP, &cap) != 0 || cap.value == 0
+            || !drm_find_output(device)) {
+        int err = errno;
+        drm_close(device);
+        errno = err ? err : ENODEV;
+        return 0;
+    }
+    for (int i = 0; i < DRM_BUFFER_COUNT; i++) {
+        if (!drm_create_buffer(device, &device->buffers[i])) {
+            int err = errno;
+            drm_close(device);
+            errno = err;
+            return 0;
+        }
+    }
+    device->savedCrtc.crtc_id = device->crtcId;
+    if (drm_ioctl(fd, DRM_IOCTL_MODE_GETCRTC, &device->savedCrtc) != 0
+            || device->savedCrtc.fb_id == 0) {
+        device->savedCrtc.crtc_id = 0;
+    }
+    drm_init_atomic(device);
+    return asJLong(device);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_closeDevice
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    DRMDevice *device = (DRMDevice *) asPtr(deviceL);
+    drm_wait_for_flip(device);
+    drm_close(device);
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getWidth
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return (jint) ((DRMDevice *) asPtr(deviceL))->mode.hdisplay;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getHeight
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return (jint) ((DRMDevice *) asPtr(deviceL))->mode.vdisplay;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getPhysicalWidth
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return (jint) ((DRMDevice *) asPtr(deviceL))->mmWidth;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getRefreshRate
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    DRMDevice *device = (DRMDevice *) asPtr(deviceL);
+    struct drm_mode_modeinfo *mode = &device->mode;
+    if (mode->htotal != 0 && mode->vtotal != 0) {
+        // Millihertz, since many modes are not a whole number of hertz
+        return (jint) (((uint64_t) mode->clock * 1000000u)
+                / ((uint64_t) mode->htotal * mode->vtotal));
+    }
+    return (jint) mode->vrefresh * 1000;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getPitch
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return (jint) ((DRMDevice *) asPtr(deviceL))->buffers[0].pitch;
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getBufferAddress
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL, jint index) {
+    return asJLong(((DRMDevice *) asPtr(deviceL))->buffers[index].map);
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_getBufferSize
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return (jlong) ((DRMDevice *) asPtr(deviceL))->buffers[0].size;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_hasDamageClips
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return ((DRMDevice *) asPtr(deviceL))->atomic ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_setMode
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL, jint index) {
+    DRMDevice *device = (DRMDevice *) asPtr(deviceL);
+    struct drm_mode_crtc crtc;
+    memset(&crtc, 0, sizeof(crtc));
+    crtc.crtc_id = device->crtcId;
+    crtc.fb_id = device->buffers[index].fbId;
+    crtc.set_connectors_ptr = (uint64_t) (unsigned long) &device->connectorId;
+    crtc.count_connectors = 1;
+    crtc.mode = device->mode;
+    crtc.mode_valid = 1;
+    return drm_ioctl(device->fd, DRM_IOCTL_MODE_SETCRTC, &crtc) == 0 ? 0 : errno;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_pageFlip
+  (JNIEnv *env, jobject UNUSED(obj), jlong deviceL, jint index,
+   jintArray rectsA, jint count) {
+    DRMDevice *device = (DRMDevice *) asPtr(deviceL);
+    struct drm_mode_rect clips[DRM_MAX_DAMAGE_CLIPS];
+    int n = 0;
+    if (rectsA != NULL && count > 0) {
+        jint rects[DRM_MAX_DAMAGE_CLIPS * 4];
+        if (count > DRM_MAX_DAMAGE_CLIPS) {
+            count = DRM_MAX_DAMAGE_CLIPS;
+        }
+        (*env)->GetIntArrayRegion(env, rectsA, 0, count * 4, rects);
+        if ((*env)->ExceptionCheck(env)) {
+            return EINVAL;
+        }
+        for (int i = 0; i < count; i++) {
+            jint *r = &rects[i * 4];
+            if (r[2] > 0 && r[3] > 0) {
+                clips[n].x1 = r[0];
+                clips[n].y1 = r[1];
+                clips[n].x2 = r[0] + r[2];
+                clips[n].y2 = r[1] + r[3];
+                n++;
+            }
+        }
+    }
+    int rc = drm_wait_for_flip(device);
+    if (rc != 0) {
+        return rc;
+    }
+    DRMBuffer *buffer = &device->buffers[index];
+    if (device->atomic) {
+        rc = drm_atomic_flip(device, buffer, clips, n);
+        if (rc == EINVAL) {
+            // Some drivers reject atomic commits after a legacy mode set
+            device->atomic = 0;
+        }
+    }
+    if (!device->atomic) {
+        rc = drm_legacy_flip(device, buffer, clips, n);
+    }
+    if (rc == 0) {
+        device->flipPending = 1;
+    }
+    return rc;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_waitForFlip
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    return drm_wait_for_flip((DRMDevice *) asPtr(deviceL));
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMSystem_waitForVBlank
+  (JNIEnv *UNUSED(env), jobject UNUSED(obj), jlong deviceL) {
+    DRMDevice *device = (DRMDevice *) asPtr(deviceL);
+    union drm_wait_vblank vbl;
+    memset(&vbl, 0, sizeof(vbl));
+    vbl.request.type = _DRM_VBLANK_RELATIVE;
+    if (device->crtcIndex == 1) {
+        vbl.request.type |= _DRM_VBLANK_SECONDARY;
+    } else if (device->crtcIndex > 1) {
+        vbl.request.type |= (device->crtcIndex << _DRM_VBLANK_HIGH_CRTC_SHIFT)
+                & _DRM_VBLANK_HIGH_CRTC_MASK;
+    }
+    vbl.request.sequence = 1;
+    int rc;
+    do {
+        rc = ioctl(device->fd, DRM_IOCTL_WAIT_VBLANK, &vbl);
+    } while (rc == -1 && errno == EINTR);
+    return rc == 0 ? 0 : errno;
+}
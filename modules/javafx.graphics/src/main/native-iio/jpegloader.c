@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1405,19 +1405,36 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
         (PTR) = NULL;     \
     }
 
+/*
+ * Rows are decoded into a scratch buffer of about this many bytes and copied
+ * to the Java array one batch at a time, rather than a row at a time.
+ */
+#define DECODE_BATCH_BYTES (64 * 1024)
+
+/*
+ * Number of progress updates sent while decoding, not counting the final one.
+ */
+#define PROGRESS_STEPS 4
+
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
-(JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
+(JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray,
+ jint offset) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
     j_decompress_ptr cinfo = (j_decompress_ptr) data->jpegObj;
     struct jpeg_source_mgr *src = cinfo->src;
     sun_jpeg_error_ptr jerr;
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
-    int offset = 0;
-    JSAMPROW scanline_ptr = NULL;
+    int batch_rows;
+    int i;
+    JDIMENSION next_progress = 0;
+    /* volatile: freed again after error_exit() longjmps back to setjmp */
+    JSAMPLE * volatile batch_buf = NULL;
+    JSAMPARRAY volatile batch_ptrs = NULL;
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
-        ((*env)->GetArrayLength(env, barray) <
+        offset < 0 ||
+        ((*env)->GetArrayLength(env, barray) - offset <
          (bytes_per_row * cinfo->output_height)))
      {
         unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
@@ -1427,6 +1444,36 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
+    /*
+     * jpeg_read_scanlines() returns at most rec_outbuf_height rows per call,
+     * so the batch is a multiple of it. It never needs to exceed the image.
+     */
+    batch_rows = DECODE_BATCH_BYTES / bytes_per_row;
+    if (batch_rows > (int) cinfo->output_height) {
+        batch_rows = cinfo->output_height;
+    }
+    if (batch_rows < cinfo->rec_outbuf_height) {
+        batch_rows = cinfo->rec_outbuf_height;
+    }
+    batch_rows -= batch_rows % cinfo->rec_outbuf_height;
+
+    if (SAFE_TO_MULT(bytes_per_row, batch_rows)) {
+        batch_buf = (JSAMPLE *) malloc(bytes_per_row * batch_rows * sizeof(JSAMPLE));
+        batch_ptrs = (JSAMPARRAY) malloc(batch_rows * sizeof(JSAMPROW));
+    }
+    if (batch_buf == NULL || batch_ptrs == NULL) {
+        unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Reading JPEG Stream");
+        SAFE_FREE(batch_buf);
+        SAFE_FREE(batch_ptrs);
+        return JNI_FALSE;
+    }
+    for (i = 0; i < batch_rows; i++) {
+        batch_ptrs[i] = batch_buf + i * bytes_per_row;
+    }
+
     /* Establish the setjmp return context for sun_jpeg_error_exit to use. */
     jerr = (sun_jpeg_error_ptr) cinfo->err;
 
@@ -1440,45 +1487,55 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                     buffer);
             ThrowByName(env, "java/io/IOException", buffer);
         }
-        SAFE_FREE(scanline_ptr);
-        return JNI_FALSE;
-    }
-
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
-    if (scanline_ptr == NULL) {
-        unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
-        ThrowByName(env,
-                "java/lang/OutOfMemoryError",
-                "Reading JPEG Stream");
+        SAFE_FREE(batch_buf);
+        SAFE_FREE(batch_ptrs);
         return JNI_FALSE;
     }
 
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
-        if (report_progress == JNI_TRUE) {
+        int filled = 0;
+        if (report_progress == JNI_TRUE &&
+                cinfo->output_scanline >= next_progress) {
             (*env)->CallVoidMethod(env, this,
                     JPEGImageLoader_updateImageProgressID,
                     cinfo->output_scanline);
             if ((*env)->ExceptionCheck(env)) {
                 cinfo->err->error_exit((j_common_ptr) cinfo);
             }
+            next_progress = cinfo->output_scanline +
+                    (cinfo->output_height + PROGRESS_STEPS - 1) / PROGRESS_STEPS;
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
-            jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
-            if (body == NULL) {
-                unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
-                fprintf(stderr, "decompressIndirect: GetPrimitiveArrayCritical returns NULL: out of memory\n");
-                SAFE_FREE(scanline_ptr);
-                return JNI_FALSE;
+        while (filled < batch_rows &&
+                cinfo->output_scanline < cinfo->output_height) {
+            JDIMENSION num_scanlines = jpeg_read_scanlines(cinfo,
+                    batch_ptrs + filled, batch_rows - filled);
+            if (num_scanlines == 0) {
+                /* Suspended: cannot happen with our blocking source. */
+                break;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
-            (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            filled += num_scanlines;
+        }
+        if (filled == 0) {
+            /* The image ended before its last scanline. */
+            unpinStreamBuffer(env, &data->streamBuf, src->next_input_byte);
+            ThrowByName(env,
+                    "java/io/IOException",
+                    "Premature end of JPEG data");
+            SAFE_FREE(batch_buf);
+            SAFE_FREE(batch_ptrs);
+            return JNI_FALSE;
+        }
+
+        (*env)->SetByteArrayRegion(env, barray, offset,
+                filled * bytes_per_row, (const jbyte *) batch_buf);
+        if ((*env)->ExceptionCheck(env)) {
+            cinfo->err->error_exit((j_common_ptr) cinfo);
         }
+        offset += filled * bytes_per_row;
     }
-    SAFE_FREE(scanline_ptr);
+    SAFE_FREE(batch_buf);
+    SAFE_FREE(batch_ptrs);
 
     if (report_progress == JNI_TRUE) {
         (*env)->CallVoidMethod(env, this,
@@ -20,6 +20,7 @@
 #include "jinclude.h"
 #include "jpeglib.h"
 #include "jdct.h"        /* Private declarations for DCT subsystem */
+#include "jsimd.h"        /* SIMD versions of the IDCTs, added for JavaFX */
 
 
 /*
@@ -153,7 +154,9 @@ start_pass (j_decompress_ptr cinfo)
       method = JDCT_ISLOW;    /* jidctint uses islow-style table */
       break;
     case ((16 << 8) + 16):
-      method_ptr = jpeg_idct_16x16;
+      method_ptr = jsimd_idct_16x16_method();
+      if (method_ptr == NULL)
+        method_ptr = jpeg_idct_16x16;
       method = JDCT_ISLOW;    /* jidctint uses islow-style table */
       break;
     case ((16 << 8) + 8):
@@ -228,7 +231,9 @@ start_pass (j_decompress_ptr cinfo)
 #ifndef PROVIDE_ISLOW_TABLES
 #define PROVIDE_ISLOW_TABLES
 #endif
-    method_ptr = jpeg_idct_islow;
+    method_ptr = jsimd_idct_islow_method();
+    if (method_ptr == NULL)
+      method_ptr = jpeg_idct_islow;
     method = JDCT_ISLOW;
     break;
 #endif
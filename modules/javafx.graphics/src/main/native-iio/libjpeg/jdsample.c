@@ -22,6 +22,7 @@
 #define JPEG_INTERNALS
 #include "jinclude.h"
 #include "jpeglib.h"
+#include "jsimd.h"        /* SIMD upsamplers, added for JavaFX */
 
 
 /* Pointer to routine to upsample a single component */
@@ -319,11 +320,15 @@ jinit_upsampler (j_decompress_ptr cinfo)
     }
     if (h_in_group * 2 == h_out_group && v_in_group == v_out_group) {
       /* Special case for 2h1v upsampling */
-      upsample->methods[ci] = h2v1_upsample;
+      upsample->methods[ci] = jsimd_h2v1_upsample_method();
+      if (upsample->methods[ci] == NULL)
+        upsample->methods[ci] = h2v1_upsample;
     } else if (h_in_group * 2 == h_out_group &&
            v_in_group * 2 == v_out_group) {
       /* Special case for 2h2v upsampling */
-      upsample->methods[ci] = h2v2_upsample;
+      upsample->methods[ci] = jsimd_h2v2_upsample_method();
+      if (upsample->methods[ci] == NULL)
+        upsample->methods[ci] = h2v2_upsample;
     } else if ((h_out_group % h_in_group) == 0 &&
            (v_out_group % v_in_group) == 0) {
       /* Generic integral-factors upsampling method */
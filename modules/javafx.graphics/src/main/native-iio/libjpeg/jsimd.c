@@ -0,0 +1,975 @@
+/*
+ * jsimd.c
+ *
+ * This file is not part of the Independent JPEG Group's software.
+ * It was added for JavaFX, see UPDATING.txt.
+ * For conditions of distribution and use, see the accompanying README file.
+ *
+ * This file contains SIMD versions of the integer IDCTs, YCbCr=>RGB color
+ * conversion and the simple upsamplers, for SSE2 and AVX2 on x86 and for
+ * NEON on ARM, together with the run time selection between them.
+ * The IDCT kernels themselves are in jsimdint.h.
+ *
+ * Every routine here produces output identical to the C routine it
+ * replaces; see the notes with each of them.
+ */
+
+#define JPEG_INTERNALS
+#include "jinclude.h"
+#include "jpeglib.h"
+#include "jdct.h"        /* Private declarations for DCT subsystem */
+#include "jsimd.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JSIMD_USE_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) || (defined(__GNUC__) && \
+    (defined(__clang__) || __GNUC__ > 4 || \
+     (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define JSIMD_USE_AVX2
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define JSIMD_AVX2_ATTR
+#else
+#include <cpuid.h>
+#define JSIMD_AVX2_ATTR __attribute__((target("avx2")))
+#endif
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define JSIMD_USE_NEON
+#include <arm_neon.h>
+#endif
+
+/* The kernels assume 8-bit samples, 8-bit data precision and the default
+ * range limit table layout, as well as JavaFX's RGB output ordering.
+ */
+#if BITS_IN_JSAMPLE == 8 && JPEG_DATA_PRECISION == 8 && RANGE_BITS == 2
+#define JSIMD_SUPPORTED
+#endif
+
+#if RGB_RED == 0 && RGB_GREEN == 1 && RGB_BLUE == 2 && RGB_PIXELSIZE == 3
+#define JSIMD_RGB_SUPPORTED
+#endif
+
+
+#define JSIMD_NONE  0
+#define JSIMD_SSE2  1
+#define JSIMD_AVX2  2
+#define JSIMD_NEON  3
+
+static int simd_support = -1;    /* not yet initialized */
+
+
+#if defined(JSIMD_SUPPORTED) && \
+    (defined(JSIMD_USE_SSE2) || defined(JSIMD_USE_NEON))
+
+/* Same scaling and constants as in jidctint.c */
+
+#define CONST_BITS  13
+#define PASS1_BITS  2
+#define PASS2_BITS  5
+
+#define FIX_0_298631336  ((INT32)  2446)    /* FIX(0.298631336) */
+#define FIX_0_390180644  ((INT32)  3196)    /* FIX(0.390180644) */
+#define FIX_0_541196100  ((INT32)  4433)    /* FIX(0.541196100) */
+#define FIX_0_765366865  ((INT32)  6270)    /* FIX(0.765366865) */
+#define FIX_0_899976223  ((INT32)  7373)    /* FIX(0.899976223) */
+#define FIX_1_175875602  ((INT32)  9633)    /* FIX(1.175875602) */
+#define FIX_1_501321110  ((INT32)  12299)    /* FIX(1.501321110) */
+#define FIX_1_847759065  ((INT32)  15137)    /* FIX(1.847759065) */
+#define FIX_1_961570560  ((INT32)  16069)    /* FIX(1.961570560) */
+#define FIX_2_053119869  ((INT32)  16819)    /* FIX(2.053119869) */
+#define FIX_2_562915447  ((INT32)  20995)    /* FIX(2.562915447) */
+#define FIX_3_072711026  ((INT32)  25172)    /* FIX(3.072711026) */
+
+#define PASS2_OFFSET  \
+    ((((INT32) RANGE_CENTER) << PASS2_BITS) + (ONE << (PASS2_BITS-1)))
+
+/* Largest dequantized coefficient for which no intermediate result of
+ * pass 1 of either IDCT exceeds 32 bits.
+ */
+#define JSIMD_IDCT_LIMIT  8191
+
+/* Same scaling and constants as in jdcolor.c.  The vector code splits
+ * each multiplier into a multiple of 65536, which is applied exactly by
+ * adding the shifted input, and a 16-bit remainder.
+ */
+
+#define SCALEBITS    16
+#define ONE_HALF     ((INT32) 1 << (SCALEBITS-1))
+#define FIX_CR_R     ((INT32) 91881)    /* FIX(1.402) */
+#define FIX_CB_B     ((INT32) 116130)   /* FIX(1.772) */
+#define FIX_CR_G     ((INT32) 46802)    /* FIX(0.714136286) */
+#define FIX_CB_G     ((INT32) 22553)    /* FIX(0.344136286) */
+
+#define K_CR_R  ((int) (FIX_CR_R - 65536))     /*  1.402 * x = x + ... */
+#define K_CB_B  ((int) (FIX_CB_B - 131072))    /*  1.772 * x = 2x + ... */
+#define K_CR_G  ((int) (65536 - FIX_CR_G))     /* -0.714 * x = -x + ... */
+#define K_CB_G  ((int) (- FIX_CB_G))
+
+
+/*
+ * Convert the pixels of one row that are left over after the vector loop.
+ * This is ycc_rgb_convert() with the table entries computed inline.
+ */
+
+LOCAL(void)
+ycc_rgb_row_tail (j_decompress_ptr cinfo,
+          JSAMPROW inptr0, JSAMPROW inptr1, JSAMPROW inptr2,
+          JSAMPROW outptr, JDIMENSION col)
+{
+  register int y, cb, cr;
+  register JSAMPLE * range_limit = cinfo->sample_range_limit;
+  JDIMENSION num_cols = cinfo->output_width;
+  SHIFT_TEMPS
+
+  outptr += col * RGB_PIXELSIZE;
+  for (; col < num_cols; col++) {
+    y  = GETJSAMPLE(inptr0[col]);
+    cb = GETJSAMPLE(inptr1[col]) - CENTERJSAMPLE;
+    cr = GETJSAMPLE(inptr2[col]) - CENTERJSAMPLE;
+    outptr[RGB_RED]   = range_limit[y +
+                  (int) RIGHT_SHIFT(FIX_CR_R * cr + ONE_HALF, SCALEBITS)];
+    outptr[RGB_GREEN] = range_limit[y +
+                  (int) RIGHT_SHIFT((- FIX_CB_G) * cb + ONE_HALF +
+                                    (- FIX_CR_G) * cr, SCALEBITS)];
+    outptr[RGB_BLUE]  = range_limit[y +
+                  (int) RIGHT_SHIFT(FIX_CB_B * cb + ONE_HALF, SCALEBITS)];
+    outptr += RGB_PIXELSIZE;
+  }
+}
+
+#endif
+
+
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_SSE2)
+
+/*
+ * SSE2 has no 32-bit lane multiply, so the even and odd lanes go through
+ * the 32x32->64 multiply separately.  The low halves of the products are
+ * the same for signed and unsigned operands.
+ */
+
+LOCAL(__m128i)
+mullo_sse2 (__m128i a, __m128i b)
+{
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+LOCAL(void)
+transpose_sse2 (const int * src, int sstride, int * dst, int dstride)
+{
+  __m128i r0 = _mm_loadu_si128((const __m128i *) (src + sstride*0));
+  __m128i r1 = _mm_loadu_si128((const __m128i *) (src + sstride*1));
+  __m128i r2 = _mm_loadu_si128((const __m128i *) (src + sstride*2));
+  __m128i r3 = _mm_loadu_si128((const __m128i *) (src + sstride*3));
+  __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+  __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+  __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+  __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+  _mm_storeu_si128((__m128i *) (dst + dstride*0), _mm_unpacklo_epi64(t0, t1));
+  _mm_storeu_si128((__m128i *) (dst + dstride*1), _mm_unpackhi_epi64(t0, t1));
+  _mm_storeu_si128((__m128i *) (dst + dstride*2), _mm_unpacklo_epi64(t2, t3));
+  _mm_storeu_si128((__m128i *) (dst + dstride*3), _mm_unpackhi_epi64(t2, t3));
+}
+
+#define JSV             __m128i
+#define JSV_LANES       4
+#define JSV_FN(name)    name##_sse2
+#define JSV_ATTR
+#define JSV_SET1(c)     _mm_set1_epi32((int) (c))
+#define JSV_LOAD(p)     _mm_loadu_si128((const __m128i *) (p))
+#define JSV_STORE(p,v)  _mm_storeu_si128((__m128i *) (p), v)
+#define JSV_LOADCOEF(p) \
+    _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), \
+                   _mm_loadl_epi64((const __m128i *) (p))), 16)
+#define JSV_LOADQ(p)    _mm_loadu_si128((const __m128i *) (p))
+#define JSV_ADD(a,b)    _mm_add_epi32(a, b)
+#define JSV_SUB(a,b)    _mm_sub_epi32(a, b)
+#define JSV_MUL(a,b)    mullo_sse2(a, b)
+#define JSV_AND(a,b)    _mm_and_si128(a, b)
+#define JSV_OR(a,b)     _mm_or_si128(a, b)
+#define JSV_SHL(v,n)    _mm_slli_epi32(v, n)
+#define JSV_SRA(v,n)    _mm_srai_epi32(v, n)
+#define JSV_OUTSIDE(v,lim) \
+    _mm_or_si128(_mm_cmpgt_epi32(v, _mm_set1_epi32(lim)), \
+                 _mm_cmplt_epi32(v, _mm_set1_epi32(-(lim))))
+#define JSV_ANY(m)      (_mm_movemask_epi8(m) != 0)
+#define JSV_PACKSTORE(p,v) \
+  do { \
+    __m128i packed_ = _mm_packs_epi32(v, v); \
+    int samples_ = _mm_cvtsi128_si32(_mm_packus_epi16(packed_, packed_)); \
+    memcpy(p, &samples_, 4); \
+  } while (0)
+
+#include "jsimdint.h"
+
+#undef JSV
+#undef JSV_LANES
+#undef JSV_FN
+#undef JSV_ATTR
+#undef JSV_SET1
+#undef JSV_LOAD
+#undef JSV_STORE
+#undef JSV_LOADCOEF
+#undef JSV_LOADQ
+#undef JSV_ADD
+#undef JSV_SUB
+#undef JSV_MUL
+#undef JSV_AND
+#undef JSV_OR
+#undef JSV_SHL
+#undef JSV_SRA
+#undef JSV_OUTSIDE
+#undef JSV_ANY
+#undef JSV_PACKSTORE
+
+
+/*
+ * YCbCr=>RGB conversion, 16 pixels per step in 16-bit lanes.
+ * Each product of the C code is formed exactly as a 32-bit multiply-add of
+ * (x, 2) or (cb, cr) pairs, see the K_* constants above.
+ */
+
+#define YCC_MADD(x,s,k) \
+    _mm_packs_epi32( \
+      _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(x, s), k), 16), \
+      _mm_srai_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(x, s), k), 16))
+
+#define YCC_MADD_G(cb,cr,k,half) \
+    _mm_packs_epi32( \
+      _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16( \
+                     _mm_unpacklo_epi16(cb, cr), k), half), 16), \
+      _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16( \
+                     _mm_unpackhi_epi16(cb, cr), k), half), 16))
+
+LOCAL(void)
+ycc_rgb_convert_sse2 (j_decompress_ptr cinfo,
+              JSAMPIMAGE input_buf, JDIMENSION input_row,
+              JSAMPARRAY output_buf, int num_rows)
+{
+  JSAMPROW outptr, inptr0, inptr1, inptr2;
+  JDIMENSION col, i;
+  JDIMENSION num_cols = cinfo->output_width;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i center = _mm_set1_epi16(CENTERJSAMPLE);
+  const __m128i two = _mm_set1_epi16(2);
+  const __m128i k_r = _mm_set_epi16(16384, K_CR_R, 16384, K_CR_R,
+                                    16384, K_CR_R, 16384, K_CR_R);
+  const __m128i k_b = _mm_set_epi16(16384, K_CB_B, 16384, K_CB_B,
+                                    16384, K_CB_B, 16384, K_CB_B);
+  const __m128i k_g = _mm_set_epi16(K_CR_G, K_CB_G, K_CR_G, K_CB_G,
+                                    K_CR_G, K_CB_G, K_CR_G, K_CB_G);
+  const __m128i half = _mm_set1_epi32(ONE_HALF);
+  __m128i y, cb, cr, r, g, b, rgb[6];
+  unsigned char samples[3][16];
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col + 16 <= num_cols; col += 16) {
+      __m128i y8 = _mm_loadu_si128((const __m128i *) (inptr0 + col));
+      __m128i cb8 = _mm_loadu_si128((const __m128i *) (inptr1 + col));
+      __m128i cr8 = _mm_loadu_si128((const __m128i *) (inptr2 + col));
+      for (i = 0; i < 2; i++) {
+        y = i ? _mm_unpackhi_epi8(y8, zero) : _mm_unpacklo_epi8(y8, zero);
+        cb = _mm_sub_epi16(i ? _mm_unpackhi_epi8(cb8, zero)
+                             : _mm_unpacklo_epi8(cb8, zero), center);
+        cr = _mm_sub_epi16(i ? _mm_unpackhi_epi8(cr8, zero)
+                             : _mm_unpacklo_epi8(cr8, zero), center);
+        r = _mm_add_epi16(_mm_add_epi16(YCC_MADD(cr, two, k_r), cr), y);
+        g = _mm_add_epi16(_mm_sub_epi16(YCC_MADD_G(cb, cr, k_g, half), cr), y);
+        b = _mm_add_epi16(_mm_add_epi16(YCC_MADD(cb, two, k_b),
+                                        _mm_add_epi16(cb, cb)), y);
+        rgb[i] = r;
+        rgb[2 + i] = g;
+        rgb[4 + i] = b;
+      }
+      /* Saturation does the range limiting. */
+      _mm_storeu_si128((__m128i *) samples[0], _mm_packus_epi16(rgb[0], rgb[1]));
+      _mm_storeu_si128((__m128i *) samples[1], _mm_packus_epi16(rgb[2], rgb[3]));
+      _mm_storeu_si128((__m128i *) samples[2], _mm_packus_epi16(rgb[4], rgb[5]));
+      for (i = 0; i < 16; i++) {
+        outptr[RGB_RED]   = samples[0][i];
+        outptr[RGB_GREEN] = samples[1][i];
+        outptr[RGB_BLUE]  = samples[2][i];
+        outptr += RGB_PIXELSIZE;
+      }
+    }
+    ycc_rgb_row_tail(cinfo, inptr0, inptr1, inptr2,
+                     outptr - col * RGB_PIXELSIZE, col);
+  }
+}
+
+
+/*
+ * Replicating upsamplers.  Only whole 32-sample steps are done here so
+ * that nothing beyond output_width is touched; the rest is done as in
+ * h2v1_upsample().
+ */
+
+LOCAL(void)
+h2v1_upsample_row_sse2 (JSAMPROW inptr, JSAMPROW outptr, JDIMENSION width)
+{
+  JSAMPROW outend = outptr + width;
+  register JSAMPLE invalue;
+
+  for (; width >= 32; width -= 32) {
+    __m128i v = _mm_loadu_si128((const __m128i *) inptr);
+    _mm_storeu_si128((__m128i *) outptr, _mm_unpacklo_epi8(v, v));
+    _mm_storeu_si128((__m128i *) (outptr + 16), _mm_unpackhi_epi8(v, v));
+    inptr += 16;
+    outptr += 32;
+  }
+  while (outptr < outend) {
+    invalue = *inptr++;    /* don't need GETJSAMPLE() here */
+    *outptr++ = invalue;
+    *outptr++ = invalue;
+  }
+}
+
+LOCAL(void)
+h2v1_upsample_sse2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+            JSAMPARRAY input_data, JSAMPIMAGE output_data_ptr)
+{
+  JSAMPARRAY output_data = *output_data_ptr;
+  int outrow;
+
+  for (outrow = 0; outrow < cinfo->max_v_samp_factor; outrow++)
+    h2v1_upsample_row_sse2(input_data[outrow], output_data[outrow],
+                           cinfo->output_width);
+}
+
+LOCAL(void)
+h2v2_upsample_sse2 (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+            JSAMPARRAY input_data, JSAMPIMAGE output_data_ptr)
+{
+  JSAMPARRAY output_data, output_end;
+
+  output_data = *output_data_ptr;
+  output_end = output_data + cinfo->max_v_samp_factor;
+  for (; output_data < output_end; output_data += 2) {
+    h2v1_upsample_row_sse2(*input_data++, *output_data, cinfo->output_width);
+    jcopy_sample_rows(output_data, output_data + 1,
+              1, cinfo->output_width);
+  }
+}
+
+#endif /* JSIMD_USE_SSE2 */
+
+
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_AVX2)
+
+JSIMD_AVX2_ATTR LOCAL(void)
+transpose_avx2 (const int * src, int sstride, int * dst, int dstride)
+{
+  __m256i r0 = _mm256_loadu_si256((const __m256i *) (src + sstride*0));
+  __m256i r1 = _mm256_loadu_si256((const __m256i *) (src + sstride*1));
+  __m256i r2 = _mm256_loadu_si256((const __m256i *) (src + sstride*2));
+  __m256i r3 = _mm256_loadu_si256((const __m256i *) (src + sstride*3));
+  __m256i r4 = _mm256_loadu_si256((const __m256i *) (src + sstride*4));
+  __m256i r5 = _mm256_loadu_si256((const __m256i *) (src + sstride*5));
+  __m256i r6 = _mm256_loadu_si256((const __m256i *) (src + sstride*6));
+  __m256i r7 = _mm256_loadu_si256((const __m256i *) (src + sstride*7));
+  __m256i t0 = _mm256_unpacklo_epi32(r0, r1);
+  __m256i t1 = _mm256_unpackhi_epi32(r0, r1);
+  __m256i t2 = _mm256_unpacklo_epi32(r2, r3);
+  __m256i t3 = _mm256_unpackhi_epi32(r2, r3);
+  __m256i t4 = _mm256_unpacklo_epi32(r4, r5);
+  __m256i t5 = _mm256_unpackhi_epi32(r4, r5);
+  __m256i t6 = _mm256_unpacklo_epi32(r6, r7);
+  __m256i t7 = _mm256_unpackhi_epi32(r6, r7);
+
+  r0 = _mm256_unpacklo_epi64(t0, t2);
+  r1 = _mm256_unpackhi_epi64(t0, t2);
+  r2 = _mm256_unpacklo_epi64(t1, t3);
+  r3 = _mm256_unpackhi_epi64(t1, t3);
+  r4 = _mm256_unpacklo_epi64(t4, t6);
+  r5 = _mm256_unpackhi_epi64(t4, t6);
+  r6 = _mm256_unpacklo_epi64(t5, t7);
+  r7 = _mm256_unpackhi_epi64(t5, t7);
+
+  _mm256_storeu_si256((__m256i *) (dst + dstride*0),
+                      _mm256_permute2x128_si256(r0, r4, 0x20));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*1),
+                      _mm256_permute2x128_si256(r1, r5, 0x20));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*2),
+                      _mm256_permute2x128_si256(r2, r6, 0x20));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*3),
+                      _mm256_permute2x128_si256(r3, r7, 0x20));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*4),
+                      _mm256_permute2x128_si256(r0, r4, 0x31));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*5),
+                      _mm256_permute2x128_si256(r1, r5, 0x31));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*6),
+                      _mm256_permute2x128_si256(r2, r6, 0x31));
+  _mm256_storeu_si256((__m256i *) (dst + dstride*7),
+                      _mm256_permute2x128_si256(r3, r7, 0x31));
+}
+
+#define JSV             __m256i
+#define JSV_LANES       8
+#define JSV_FN(name)    name##_avx2
+#define JSV_ATTR        JSIMD_AVX2_ATTR
+#define JSV_SET1(c)     _mm256_set1_epi32((int) (c))
+#define JSV_LOAD(p)     _mm256_loadu_si256((const __m256i *) (p))
+#define JSV_STORE(p,v)  _mm256_storeu_si256((__m256i *) (p), v)
+#define JSV_LOADCOEF(p) \
+    _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) (p)))
+#define JSV_LOADQ(p)    _mm256_loadu_si256((const __m256i *) (p))
+#define JSV_ADD(a,b)    _mm256_add_epi32(a, b)
+#define JSV_SUB(a,b)    _mm256_sub_epi32(a, b)
+#define JSV_MUL(a,b)    _mm256_mullo_epi32(a, b)
+#define JSV_AND(a,b)    _mm256_and_si256(a, b)
+#define JSV_OR(a,b)     _mm256_or_si256(a, b)
+#define JSV_SHL(v,n)    _mm256_slli_epi32(v, n)
+#define JSV_SRA(v,n)    _mm256_srai_epi32(v, n)
+#define JSV_OUTSIDE(v,lim) \
+    _mm256_or_si256(_mm256_cmpgt_epi32(v, _mm256_set1_epi32(lim)), \
+                    _mm256_cmpgt_epi32(_mm256_set1_epi32(-(lim)), v))
+#define JSV_ANY(m)      (_mm256_movemask_epi8(m) != 0)
+#define JSV_PACKSTORE(p,v) \
+  do { \
+    __m128i packed_ = _mm_packs_epi32(_mm256_castsi256_si128(v), \
+                                      _mm256_extracti128_si256(v, 1)); \
+    _mm_storel_epi64((__m128i *) (p), _mm_packus_epi16(packed_, packed_)); \
+  } while (0)
+
+#include "jsimdint.h"
+
+#undef JSV
+#undef JSV_LANES
+#undef JSV_FN
+#undef JSV_ATTR
+#undef JSV_SET1
+#undef JSV_LOAD
+#undef JSV_STORE
+#undef JSV_LOADCOEF
+#undef JSV_LOADQ
+#undef JSV_ADD
+#undef JSV_SUB
+#undef JSV_MUL
+#undef JSV_AND
+#undef JSV_OR
+#undef JSV_SHL
+#undef JSV_SRA
+#undef JSV_OUTSIDE
+#undef JSV_ANY
+#undef JSV_PACKSTORE
+
+
+/*
+ * YCbCr=>RGB conversion as in ycc_rgb_convert_sse2(), but with the 16
+ * pixels of a step in one register and the interleaving to RGB done with
+ * byte shuffles.  The 256-bit unpack and pack instructions work within
+ * 128-bit halves, so each unpack/pack pair keeps the pixel order.
+ */
+
+#define YCC_MADD_AVX2(x,s,k) \
+    _mm256_packs_epi32( \
+      _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(x, s), k), 16), \
+      _mm256_srai_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(x, s), k), 16))
+
+#define YCC_MADD_G_AVX2(cb,cr,k,half) \
+    _mm256_packs_epi32( \
+      _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16( \
+                        _mm256_unpacklo_epi16(cb, cr), k), half), 16), \
+      _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16( \
+                        _mm256_unpackhi_epi16(cb, cr), k), half), 16))
+
+/* Pack 16 words to 16 samples, range limiting by saturation */
+#define YCC_PACK_AVX2(v) \
+    _mm256_castsi256_si128(_mm256_permute4x64_epi64( \
+      _mm256_packus_epi16(v, v), _MM_SHUFFLE(3, 1, 2, 0)))
+
+JSIMD_AVX2_ATTR LOCAL(void)
+ycc_rgb_convert_avx2 (j_decompress_ptr cinfo,
+              JSAMPIMAGE input_buf, JDIMENSION input_row,
+              JSAMPARRAY output_buf, int num_rows)
+{
+  JSAMPROW outptr, inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  const __m256i center = _mm256_set1_epi16(CENTERJSAMPLE);
+  const __m256i two = _mm256_set1_epi16(2);
+  const __m256i k_r = _mm256_set1_epi32((int) ((16384u << 16) |
+                                               (K_CR_R & 0xffff)));
+  const __m256i k_b = _mm256_set1_epi32((int) ((16384u << 16) |
+                                               (K_CB_B & 0xffff)));
+  const __m256i k_g = _mm256_set1_epi32((int) (((unsigned) K_CR_G << 16) |
+                                               (K_CB_G & 0xffff)));
+  const __m256i half = _mm256_set1_epi32(ONE_HALF);
+  /* Byte shuffles interleaving 16 R, G and B samples into 48 bytes */
+  const __m128i r0 = _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1,
+                                   -1, 3, -1, -1, 4, -1, -1, 5);
+  const __m128i g0 = _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2,
+                                   -1, -1, 3, -1, -1, 4, -1, -1);
+  const __m128i b0 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1,
+                                   2, -1, -1, 3, -1, -1, 4, -1);
+  const __m128i r1 = _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1,
+                                   8, -1, -1, 9, -1, -1, 10, -1);
+  const __m128i g1 = _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1,
+                                   -1, 8, -1, -1, 9, -1, -1, 10);
+  const __m128i b1 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7,
+                                   -1, -1, 8, -1, -1, 9, -1, -1);
+  const __m128i r2 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13,
+                                   -1, -1, 14, -1, -1, 15, -1, -1);
+  const __m128i g2 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1,
+                                   13, -1, -1, 14, -1, -1, 15, -1);
+  const __m128i b2 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1,
+                                   -1, 13, -1, -1, 14, -1, -1, 15);
+  __m256i y, cb, cr;
+  __m128i r, g, b;
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col + 16 <= num_cols; col += 16) {
+      y = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)
+                                               (inptr0 + col)));
+      cb = _mm256_sub_epi16(_mm256_cvtepu8_epi16(
+             _mm_loadu_si128((const __m128i *) (inptr1 + col))), center);
+      cr = _mm256_sub_epi16(_mm256_cvtepu8_epi16(
+             _mm_loadu_si128((const __m128i *) (inptr2 + col))), center);
+      r = YCC_PACK_AVX2(_mm256_add_epi16(
+            _mm256_add_epi16(YCC_MADD_AVX2(cr, two, k_r), cr), y));
+      g = YCC_PACK_AVX2(_mm256_add_epi16(
+            _mm256_sub_epi16(YCC_MADD_G_AVX2(cb, cr, k_g, half), cr), y));
+      b = YCC_PACK_AVX2(_mm256_add_epi16(
+            _mm256_add_epi16(YCC_MADD_AVX2(cb, two, k_b),
+                             _mm256_add_epi16(cb, cb)), y));
+      _mm_storeu_si128((__m128i *) outptr,
+                       _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, r0),
+                                                 _mm_shuffle_epi8(g, g0)),
+                                    _mm_shuffle_epi8(b, b0)));
+      _mm_storeu_si128((__m128i *) (outptr + 16),
+                       _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, r1),
+                                                 _mm_shuffle_epi8(g, g1)),
+                                    _mm_shuffle_epi8(b, b1)));
+      _mm_storeu_si128((__m128i *) (outptr + 32),
+                       _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(r, r2),
+                                                 _mm_shuffle_epi8(g, g2)),
+                                    _mm_shuffle_epi8(b, b2)));
+      outptr += 16 * RGB_PIXELSIZE;
+    }
+    ycc_rgb_row_tail(cinfo, inptr0, inptr1, inptr2,
+                     outptr - col * RGB_PIXELSIZE, col);
+  }
+}
+
+#endif /* JSIMD_USE_AVX2 */
+
+
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_NEON)
+
+LOCAL(void)
+transpose_neon (const int * src, int sstride, int * dst, int dstride)
+{
+  int32x4x2_t t0 = vtrnq_s32(vld1q_s32(src + sstride*0),
+                             vld1q_s32(src + sstride*1));
+  int32x4x2_t t1 = vtrnq_s32(vld1q_s32(src + sstride*2),
+                             vld1q_s32(src + sstride*3));
+
+  vst1q_s32(dst + dstride*0, vcombine_s32(vget_low_s32(t0.val[0]),
+                                          vget_low_s32(t1.val[0])));
+  vst1q_s32(dst + dstride*1, vcombine_s32(vget_low_s32(t0.val[1]),
+                                          vget_low_s32(t1.val[1])));
+  vst1q_s32(dst + dstride*2, vcombine_s32(vget_high_s32(t0.val[0]),
+                                          vget_high_s32(t1.val[0])));
+  vst1q_s32(dst + dstride*3, vcombine_s32(vget_high_s32(t0.val[1]),
+                                          vget_high_s32(t1.val[1])));
+}
+
+LOCAL(int)
+any_neon (uint32x4_t m)
+{
+  uint32x2_t t = vorr_u32(vget_low_u32(m), vget_high_u32(m));
+  return (vget_lane_u32(t, 0) | vget_lane_u32(t, 1)) != 0;
+}
+
+#define JSV             int32x4_t
+#define JSV_LANES       4
+#define JSV_FN(name)    name##_neon
+#define JSV_ATTR
+#define JSV_SET1(c)     vdupq_n_s32((int) (c))
+#define JSV_LOAD(p)     vld1q_s32(p)
+#define JSV_STORE(p,v)  vst1q_s32(p, v)
+#define JSV_LOADCOEF(p) vmovl_s16(vld1_s16(p))
+#define JSV_LOADQ(p)    vld1q_s32((const int32_t *) (p))
+#define JSV_ADD(a,b)    vaddq_s32(a, b)
+#define JSV_SUB(a,b)    vsubq_s32(a, b)
+#define JSV_MUL(a,b)    vmulq_s32(a, b)
+#define JSV_AND(a,b)    vandq_s32(a, b)
+#define JSV_OR(a,b)     vorrq_s32(a, b)
+#define JSV_SHL(v,n)    vshlq_n_s32(v, n)
+#define JSV_SRA(v,n)    vshrq_n_s32(v, n)
+#define JSV_OUTSIDE(v,lim) \
+    vreinterpretq_s32_u32(vorrq_u32(vcgtq_s32(v, vdupq_n_s32(lim)), \
+                                    vcltq_s32(v, vdupq_n_s32(-(lim)))))
+#define JSV_ANY(m)      any_neon(vreinterpretq_u32_s32(m))
+#define JSV_PACKSTORE(p,v) \
+  do { \
+    int16x4_t packed_ = vqmovn_s32(v); \
+    uint32_t samples_ = vget_lane_u32(vreinterpret_u32_u8( \
+      vqmovun_s16(vcombine_s16(packed_, packed_))), 0); \
+    memcpy(p, &samples_, 4); \
+  } while (0)
+
+#include "jsimdint.h"
+
+#undef JSV
+#undef JSV_LANES
+#undef JSV_FN
+#undef JSV_ATTR
+#undef JSV_SET1
+#undef JSV_LOAD
+#undef JSV_STORE
+#undef JSV_LOADCOEF
+#undef JSV_LOADQ
+#undef JSV_ADD
+#undef JSV_SUB
+#undef JSV_MUL
+#undef JSV_AND
+#undef JSV_OR
+#undef JSV_SHL
+#undef JSV_SRA
+#undef JSV_OUTSIDE
+#undef JSV_ANY
+#undef JSV_PACKSTORE
+
+
+/*
+ * YCbCr=>RGB conversion, 8 pixels per half step, using widening
+ * multiply-accumulate for the exact products and vst3 for interleaving.
+ */
+
+LOCAL(uint8x8_t)
+ycc_rgb_half_neon (int16x8_t y, int16x8_t cb, int16x8_t cr, int channel)
+{
+  const int32x4_t half = vdupq_n_s32(ONE_HALF);
+  int16x4_t lo, hi;
+  int16x8_t v;
+
+  switch (channel) {
+  case 0:
+    lo = vshrn_n_s32(vmlal_n_s16(half, vget_low_s16(cr), K_CR_R), 16);
+    hi = vshrn_n_s32(vmlal_n_s16(half, vget_high_s16(cr), K_CR_R), 16);
+    v = vaddq_s16(vcombine_s16(lo, hi), cr);
+    break;
+  case 1:
+    lo = vshrn_n_s32(vmlal_n_s16(vmlal_n_s16(half, vget_low_s16(cb), K_CB_G),
+                                 vget_low_s16(cr), K_CR_G), 16);
+    hi = vshrn_n_s32(vmlal_n_s16(vmlal_n_s16(half, vget_high_s16(cb), K_CB_G),
+                                 vget_high_s16(cr), K_CR_G), 16);
+    v = vsubq_s16(vcombine_s16(lo, hi), cr);
+    break;
+  default:
+    lo = vshrn_n_s32(vmlal_n_s16(half, vget_low_s16(cb), K_CB_B), 16);
+    hi = vshrn_n_s32(vmlal_n_s16(half, vget_high_s16(cb), K_CB_B), 16);
+    v = vaddq_s16(vcombine_s16(lo, hi), vaddq_s16(cb, cb));
+    break;
+  }
+  /* Saturation does the range limiting. */
+  return vqmovun_s16(vaddq_s16(v, y));
+}
+
+LOCAL(void)
+ycc_rgb_convert_neon (j_decompress_ptr cinfo,
+              JSAMPIMAGE input_buf, JDIMENSION input_row,
+              JSAMPARRAY output_buf, int num_rows)
+{
+  JSAMPROW outptr, inptr0, inptr1, inptr2;
+  JDIMENSION col;
+  JDIMENSION num_cols = cinfo->output_width;
+  const int16x8_t center = vdupq_n_s16(CENTERJSAMPLE);
+  uint8x16x3_t rgb;
+  int c;
+
+  while (--num_rows >= 0) {
+    inptr0 = input_buf[0][input_row];
+    inptr1 = input_buf[1][input_row];
+    inptr2 = input_buf[2][input_row];
+    input_row++;
+    outptr = *output_buf++;
+    for (col = 0; col + 16 <= num_cols; col += 16) {
+      uint8x16_t y8 = vld1q_u8(inptr0 + col);
+      uint8x16_t cb8 = vld1q_u8(inptr1 + col);
+      uint8x16_t cr8 = vld1q_u8(inptr2 + col);
+      int16x8_t ylo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y8)));
+      int16x8_t yhi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y8)));
+      int16x8_t cblo = vsubq_s16(vreinterpretq_s16_u16(
+                         vmovl_u8(vget_low_u8(cb8))), center);
+      int16x8_t cbhi = vsubq_s16(vreinterpretq_s16_u16(
+                         vmovl_u8(vget_high_u8(cb8))), center);
+      int16x8_t crlo = vsubq_s16(vreinterpretq_s16_u16(
+                         vmovl_u8(vget_low_u8(cr8))), center);
+      int16x8_t crhi = vsubq_s16(vreinterpretq_s16_u16(
+                         vmovl_u8(vget_high_u8(cr8))), center);
+      for (c = 0; c < 3; c++)
+        rgb.val[c] = vcombine_u8(ycc_rgb_half_neon(ylo, cblo, crlo, c),
+                                 ycc_rgb_half_neon(yhi, cbhi, crhi, c));
+      vst3q_u8(outptr, rgb);
+      outptr += 16 * RGB_PIXELSIZE;
+    }
+    ycc_rgb_row_tail(cinfo, inptr0, inptr1, inptr2,
+                     outptr - col * RGB_PIXELSIZE, col);
+  }
+}
+
+
+/*
+ * Replicating upsamplers, see h2v1_upsample_row_sse2().
+ */
+
+LOCAL(void)
+h2v1_upsample_row_neon (JSAMPROW inptr, JSAMPROW outptr, JDIMENSION width)
+{
+  JSAMPROW outend = outptr + width;
+  register JSAMPLE invalue;
+
+  for (; width >= 32; width -= 32) {
+    uint8x16_t v = vld1q_u8(inptr);
+    uint8x16x2_t pairs;
+    pairs.val[0] = v;
+    pairs.val[1] = v;
+    vst2q_u8(outptr, pairs);
+    inptr += 16;
+    outptr += 32;
+  }
+  while (outptr < outend) {
+    invalue = *inptr++;    /* don't need GETJSAMPLE() here */
+    *outptr++ = invalue;
+    *outptr++ = invalue;
+  }
+}
+
+LOCAL(void)
+h2v1_upsample_neon (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+            JSAMPARRAY input_data, JSAMPIMAGE output_data_ptr)
+{
+  JSAMPARRAY output_data = *output_data_ptr;
+  int outrow;
+
+  for (outrow = 0; outrow < cinfo->max_v_samp_factor; outrow++)
+    h2v1_upsample_row_neon(input_data[outrow], output_data[outrow],
+                           cinfo->output_width);
+}
+
+LOCAL(void)
+h2v2_upsample_neon (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+            JSAMPARRAY input_data, JSAMPIMAGE output_data_ptr)
+{
+  JSAMPARRAY output_data, output_end;
+
+  output_data = *output_data_ptr;
+  output_end = output_data + cinfo->max_v_samp_factor;
+  for (; output_data < output_end; output_data += 2) {
+    h2v1_upsample_row_neon(*input_data++, *output_data, cinfo->output_width);
+    jcopy_sample_rows(output_data, output_data + 1,
+              1, cinfo->output_width);
+  }
+}
+
+#endif /* JSIMD_USE_NEON */
+
+
+/*
+ * Run time selection.
+ */
+
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_AVX2)
+
+LOCAL(boolean)
+cpu_has_avx2 (void)
+{
+  unsigned int eax, ebx, ecx, edx, unused, xcr0;
+
+#ifdef _MSC_VER
+  int regs[4];
+  __cpuid(regs, 0);
+  if (regs[0] < 7)
+    return FALSE;
+  __cpuid(regs, 1);
+  ecx = (unsigned int) regs[2];
+  __cpuidex(regs, 7, 0);
+  ebx = (unsigned int) regs[1];
+#else
+  if (__get_cpuid_max(0, NULL) < 7)
+    return FALSE;
+  __cpuid(1, eax, ebx, ecx, edx);
+  __cpuid_count(7, 0, eax, ebx, unused, edx);
+#endif
+  /* OSXSAVE and AVX, then AVX2 */
+  if ((ecx & (1u << 27)) == 0 || (ecx & (1u << 28)) == 0 ||
+      (ebx & (1u << 5)) == 0)
+    return FALSE;
+  /* The OS must save the YMM registers. */
+#ifdef _MSC_VER
+  xcr0 = (unsigned int) _xgetbv(0);
+#else
+  __asm__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+  xcr0 = eax;
+#endif
+  return (xcr0 & 6) == 6;
+}
+
+#endif
+
+#ifdef JSIMD_SUPPORTED
+
+LOCAL(boolean)
+env_set (const char * name)
+{
+  const char * value = getenv(name);
+  return value != NULL && value[0] == '1' && value[1] == '\0';
+}
+
+#endif
+
+LOCAL(int)
+init_simd (void)
+{
+  int support = JSIMD_NONE;
+
+#ifdef JSIMD_SUPPORTED
+  /* The IDCT kernels load the multiplier table as ints. */
+  if (SIZEOF(ISLOW_MULT_TYPE) != SIZEOF(int) || env_set("JSIMD_FORCENONE"))
+    return JSIMD_NONE;
+#if defined(JSIMD_USE_SSE2)
+  support = JSIMD_SSE2;
+#if defined(JSIMD_USE_AVX2)
+  if (! env_set("JSIMD_FORCESSE2") && cpu_has_avx2())
+    support = JSIMD_AVX2;
+#endif
+#elif defined(JSIMD_USE_NEON)
+  support = JSIMD_NEON;
+#endif
+#endif
+  return support;
+}
+
+LOCAL(int)
+get_simd_support (void)
+{
+  /* Racing initializations all store the same value. */
+  if (simd_support < 0)
+    simd_support = init_simd();
+  return simd_support;
+}
+
+
+GLOBAL(inverse_DCT_method_ptr)
+jsimd_idct_islow_method (void)
+{
+  switch (get_simd_support()) {
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_SSE2)
+  case JSIMD_SSE2:
+    return idct_islow_sse2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_AVX2)
+  case JSIMD_AVX2:
+    return idct_islow_avx2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_NEON)
+  case JSIMD_NEON:
+    return idct_islow_neon;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+GLOBAL(inverse_DCT_method_ptr)
+jsimd_idct_16x16_method (void)
+{
+  switch (get_simd_support()) {
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_SSE2)
+  case JSIMD_SSE2:
+    return idct_16x16_sse2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_AVX2)
+  case JSIMD_AVX2:
+    return idct_16x16_avx2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_NEON)
+  case JSIMD_NEON:
+    return idct_16x16_neon;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+GLOBAL(jsimd_color_convert_ptr)
+jsimd_ycc_rgb_method (void)
+{
+#ifdef JSIMD_RGB_SUPPORTED
+  switch (get_simd_support()) {
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_SSE2)
+  case JSIMD_SSE2:
+    return ycc_rgb_convert_sse2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_AVX2)
+  case JSIMD_AVX2:
+    return ycc_rgb_convert_avx2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_NEON)
+  case JSIMD_NEON:
+    return ycc_rgb_convert_neon;
+#endif
+  default:
+    break;
+  }
+#endif
+  return NULL;
+}
+
+GLOBAL(jsimd_upsample1_ptr)
+jsimd_h2v1_upsample_method (void)
+{
+  switch (get_simd_support()) {
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_SSE2)
+  case JSIMD_SSE2:
+  case JSIMD_AVX2:    /* memory bound, SSE2 is as fast */
+    return h2v1_upsample_sse2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_NEON)
+  case JSIMD_NEON:
+    return h2v1_upsample_neon;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+GLOBAL(jsimd_upsample1_ptr)
+jsimd_h2v2_upsample_method (void)
+{
+  switch (get_simd_support()) {
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_SSE2)
+  case JSIMD_SSE2:
+  case JSIMD_AVX2:    /* memory bound, SSE2 is as fast */
+    return h2v2_upsample_sse2;
+#endif
+#if defined(JSIMD_SUPPORTED) && defined(JSIMD_USE_NEON)
+  case JSIMD_NEON:
+    return h2v2_upsample_neon;
+#endif
+  default:
+    return NULL;
+  }
+}
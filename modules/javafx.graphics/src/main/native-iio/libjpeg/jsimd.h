@@ -0,0 +1,50 @@
+/*
+ * jsimd.h
+ *
+ * This file is not part of the Independent JPEG Group's software.
+ * It was added for JavaFX, see UPDATING.txt.
+ * For conditions of distribution and use, see the accompanying README file.
+ *
+ * This include file declares the SIMD versions of the hot decoder kernels:
+ * the 8x8 and 16x16 integer IDCTs (the latter doing the chroma upsampling
+ * when fancy upsampling selects DCT scaling), YCbCr=>RGB color conversion
+ * and the 2h1v/2h2v replicating upsamplers.
+ *
+ * Every kernel produces exactly the same samples as the C routine it
+ * replaces.  The best instruction set supported by the CPU is selected at
+ * run time; each function below returns NULL if no SIMD version can be
+ * used, in which case the caller keeps the portable C routine.
+ *
+ * Setting the environment variable JSIMD_FORCENONE=1 disables all SIMD
+ * kernels, JSIMD_FORCESSE2=1 disables the AVX2 kernels on x86.
+ */
+
+/* Same signature as the color_convert method of jpeg_color_deconverter */
+typedef JMETHOD(void, jsimd_color_convert_ptr,
+        (j_decompress_ptr cinfo, JSAMPIMAGE input_buf,
+         JDIMENSION input_row, JSAMPARRAY output_buf, int num_rows));
+
+/* Same signature as the per-component methods of jdsample.c */
+typedef JMETHOD(void, jsimd_upsample1_ptr,
+        (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+         JSAMPARRAY input_data, JSAMPIMAGE output_data_ptr));
+
+/* Short forms of external names for systems with brain-damaged linkers. */
+
+#ifdef NEED_SHORT_EXTERNAL_NAMES
+#define jsimd_idct_islow_method    jSislow
+#define jsimd_idct_16x16_method    jS16x16
+#define jsimd_ycc_rgb_method       jSyccrgb
+#define jsimd_h2v1_upsample_method jSh2v1
+#define jsimd_h2v2_upsample_method jSh2v2
+#endif /* NEED_SHORT_EXTERNAL_NAMES */
+
+/* Replacement for jpeg_idct_islow() */
+EXTERN(inverse_DCT_method_ptr) jsimd_idct_islow_method JPP((void));
+/* Replacement for jpeg_idct_16x16() */
+EXTERN(inverse_DCT_method_ptr) jsimd_idct_16x16_method JPP((void));
+/* Replacement for ycc_rgb_convert() with the sYCC tables */
+EXTERN(jsimd_color_convert_ptr) jsimd_ycc_rgb_method JPP((void));
+/* Replacements for h2v1_upsample() and h2v2_upsample() */
+EXTERN(jsimd_upsample1_ptr) jsimd_h2v1_upsample_method JPP((void));
+EXTERN(jsimd_upsample1_ptr) jsimd_h2v2_upsample_method JPP((void));
@@ -0,0 +1,531 @@
+/*
+ * jsimdint.h
+ *
+ * This file is not part of the Independent JPEG Group's software.
+ * It was added for JavaFX, see UPDATING.txt.
+ * For conditions of distribution and use, see the accompanying README file.
+ *
+ * This file contains the vector versions of jpeg_idct_islow() and
+ * jpeg_idct_16x16() from jidctint.c.  It is included by jsimd.c once for
+ * every instruction set, after the JSV_* macros below have been defined:
+ *
+ *   JSV                 vector of JSV_LANES signed 32-bit lanes
+ *   JSV_FN(name)        decorates a function name for the instruction set
+ *   JSV_ATTR            function attribute enabling the instruction set
+ *   JSV_SET1(c)         broadcast an int
+ *   JSV_LOAD(p)         load JSV_LANES ints
+ *   JSV_STORE(p, v)     store JSV_LANES ints
+ *   JSV_LOADCOEF(p)     load and sign extend JSV_LANES JCOEFs
+ *   JSV_LOADQ(p)        load JSV_LANES ISLOW_MULT_TYPEs
+ *   JSV_ADD, JSV_SUB, JSV_MUL, JSV_AND, JSV_OR
+ *                       lane wise, JSV_MUL keeps the low 32 bits
+ *   JSV_SHL(v, n), JSV_SRA(v, n)
+ *                       shifts by a constant, JSV_SRA is arithmetic
+ *   JSV_OUTSIDE(v, lim) all ones in the lanes where |v| > lim
+ *   JSV_ANY(m)          nonzero if any lane of m is set
+ *   JSV_PACKSTORE(p, v) store JSV_LANES samples, saturating to 0..255
+ *
+ * and JSV_FN(transpose)(src, sstride, dst, dstride) has been defined to
+ * transpose one JSV_LANES x JSV_LANES block of ints.
+ *
+ * Both passes do exactly the arithmetic of the C code, one column (pass 1)
+ * or one row (pass 2) per lane, on 32-bit lanes.  The C code computes in
+ * INT32, which is wider than 32 bits on LP64 systems, so the results can
+ * only be guaranteed identical where no intermediate of pass 1 overflows
+ * 32 bits.  That holds for all dequantized inputs within +-JSIMD_IDCT_LIMIT
+ * (valid 8-bit data stays below +-2^12); blocks with larger inputs, which
+ * only occur in corrupt files, are handed to the C routine.  Pass 2 needs
+ * no such check: its results are masked with RANGE_MASK, so only the low
+ * bits of each sum matter, and those are the same with wraparound.
+ * The mask-and-table-lookup range limiting of the C code is equivalent to
+ * ((x & RANGE_MASK) - RANGE_SUBSET) clamped to 0..MAXJSAMPLE, which is
+ * what JSV_PACKSTORE does with saturation.
+ */
+
+#define JSV_MULC(v,c)   JSV_MUL(v, JSV_SET1((int) (c)))
+#define JSV_DEQUANT(k)  JSV_MUL(JSV_LOADCOEF(inptr + DCTSIZE*(k)), \
+                                JSV_LOADQ(quantptr + DCTSIZE*(k)))
+#define JSV_DESCALE2(v) JSV_SUB(JSV_AND(JSV_SRA(v, CONST_BITS+PASS2_BITS), \
+                                        range_mask), range_subset)
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients.
+ * See jpeg_idct_islow() for the algorithm.
+ */
+
+JSV_ATTR LOCAL(void)
+JSV_FN(idct_islow) (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+            JCOEFPTR coef_block,
+            JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  JSV tmp0, tmp1, tmp2, tmp3;
+  JSV tmp10, tmp11, tmp12, tmp13;
+  JSV z1, z2, z3;
+  JSV in0, in1, in2, in3, in4, in5, in6, in7;
+  JSV over, range_mask, range_subset;
+  JCOEFPTR inptr;
+  ISLOW_MULT_TYPE * quantptr;
+  int * wsptr;
+  int row, col;
+  int workspace[DCTSIZE2];    /* buffers data between passes */
+  int transposed[DCTSIZE2];
+
+  /* Pass 1: process columns from input, store into work array. */
+
+  over = JSV_SET1(0);
+  for (col = 0; col < DCTSIZE; col += JSV_LANES) {
+    inptr = coef_block + col;
+    quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table + col;
+    wsptr = workspace + col;
+
+    in0 = JSV_DEQUANT(0);
+    in1 = JSV_DEQUANT(1);
+    in2 = JSV_DEQUANT(2);
+    in3 = JSV_DEQUANT(3);
+    in4 = JSV_DEQUANT(4);
+    in5 = JSV_DEQUANT(5);
+    in6 = JSV_DEQUANT(6);
+    in7 = JSV_DEQUANT(7);
+    over = JSV_OR(over, JSV_OR(JSV_OR(JSV_OUTSIDE(in0, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in1, JSIMD_IDCT_LIMIT)),
+                               JSV_OR(JSV_OUTSIDE(in2, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in3, JSIMD_IDCT_LIMIT))));
+    over = JSV_OR(over, JSV_OR(JSV_OR(JSV_OUTSIDE(in4, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in5, JSIMD_IDCT_LIMIT)),
+                               JSV_OR(JSV_OUTSIDE(in6, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in7, JSIMD_IDCT_LIMIT))));
+
+    /* Even part.  No DC-only shortcut here: with all AC terms zero the
+     * full computation yields the same DC value in every output.
+     */
+
+    z2 = JSV_SHL(in0, CONST_BITS);
+    z3 = JSV_SHL(in4, CONST_BITS);
+    /* Add fudge factor here for final descale. */
+    z2 = JSV_ADD(z2, JSV_SET1(ONE << (CONST_BITS-PASS1_BITS-1)));
+
+    tmp0 = JSV_ADD(z2, z3);
+    tmp1 = JSV_SUB(z2, z3);
+
+    z1 = JSV_MULC(JSV_ADD(in2, in6), FIX_0_541196100);
+    tmp2 = JSV_ADD(z1, JSV_MULC(in2, FIX_0_765366865));
+    tmp3 = JSV_SUB(z1, JSV_MULC(in6, FIX_1_847759065));
+
+    tmp10 = JSV_ADD(tmp0, tmp2);
+    tmp13 = JSV_SUB(tmp0, tmp2);
+    tmp11 = JSV_ADD(tmp1, tmp3);
+    tmp12 = JSV_SUB(tmp1, tmp3);
+
+    /* Odd part */
+
+    z2 = JSV_ADD(in7, in3);
+    z3 = JSV_ADD(in5, in1);
+
+    z1 = JSV_MULC(JSV_ADD(z2, z3), FIX_1_175875602);
+    z2 = JSV_ADD(JSV_MULC(z2, - FIX_1_961570560), z1);
+    z3 = JSV_ADD(JSV_MULC(z3, - FIX_0_390180644), z1);
+
+    z1 = JSV_MULC(JSV_ADD(in7, in1), - FIX_0_899976223);
+    tmp0 = JSV_ADD(JSV_MULC(in7, FIX_0_298631336), JSV_ADD(z1, z2));
+    tmp3 = JSV_ADD(JSV_MULC(in1, FIX_1_501321110), JSV_ADD(z1, z3));
+
+    z1 = JSV_MULC(JSV_ADD(in5, in3), - FIX_2_562915447);
+    tmp1 = JSV_ADD(JSV_MULC(in5, FIX_2_053119869), JSV_ADD(z1, z3));
+    tmp2 = JSV_ADD(JSV_MULC(in3, FIX_3_072711026), JSV_ADD(z1, z2));
+
+    /* Final output stage: inputs are tmp10..tmp13, tmp0..tmp3 */
+
+    JSV_STORE(wsptr + DCTSIZE*0,
+              JSV_SRA(JSV_ADD(tmp10, tmp3), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*7,
+              JSV_SRA(JSV_SUB(tmp10, tmp3), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*1,
+              JSV_SRA(JSV_ADD(tmp11, tmp2), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*6,
+              JSV_SRA(JSV_SUB(tmp11, tmp2), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*2,
+              JSV_SRA(JSV_ADD(tmp12, tmp1), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*5,
+              JSV_SRA(JSV_SUB(tmp12, tmp1), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*3,
+              JSV_SRA(JSV_ADD(tmp13, tmp0), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + DCTSIZE*4,
+              JSV_SRA(JSV_SUB(tmp13, tmp0), CONST_BITS-PASS1_BITS));
+  }
+
+  if (JSV_ANY(over)) {
+    jpeg_idct_islow(cinfo, compptr, coef_block, output_buf, output_col);
+    return;
+  }
+
+  /* Pass 2 works on one row per lane, so turn the work array around. */
+
+  for (row = 0; row < DCTSIZE; row += JSV_LANES)
+    for (col = 0; col < DCTSIZE; col += JSV_LANES)
+      JSV_FN(transpose)(workspace + row*DCTSIZE + col, DCTSIZE,
+                        transposed + col*DCTSIZE + row, DCTSIZE);
+
+  /* Pass 2: process rows from work array, store results by column. */
+
+  range_mask = JSV_SET1(RANGE_MASK);
+  range_subset = JSV_SET1(RANGE_SUBSET);
+  for (row = 0; row < DCTSIZE; row += JSV_LANES) {
+    wsptr = transposed + row;
+
+    /* Even part */
+
+    /* Add range center and fudge factor for final descale and range-limit. */
+    z2 = JSV_ADD(JSV_LOAD(wsptr + DCTSIZE*0), JSV_SET1(PASS2_OFFSET));
+    z3 = JSV_LOAD(wsptr + DCTSIZE*4);
+    z2 = JSV_SHL(z2, CONST_BITS);
+    z3 = JSV_SHL(z3, CONST_BITS);
+
+    tmp0 = JSV_ADD(z2, z3);
+    tmp1 = JSV_SUB(z2, z3);
+
+    z2 = JSV_LOAD(wsptr + DCTSIZE*2);
+    z3 = JSV_LOAD(wsptr + DCTSIZE*6);
+
+    z1 = JSV_MULC(JSV_ADD(z2, z3), FIX_0_541196100);
+    tmp2 = JSV_ADD(z1, JSV_MULC(z2, FIX_0_765366865));
+    tmp3 = JSV_SUB(z1, JSV_MULC(z3, FIX_1_847759065));
+
+    tmp10 = JSV_ADD(tmp0, tmp2);
+    tmp13 = JSV_SUB(tmp0, tmp2);
+    tmp11 = JSV_ADD(tmp1, tmp3);
+    tmp12 = JSV_SUB(tmp1, tmp3);
+
+    /* Odd part */
+
+    in7 = JSV_LOAD(wsptr + DCTSIZE*7);
+    in5 = JSV_LOAD(wsptr + DCTSIZE*5);
+    in3 = JSV_LOAD(wsptr + DCTSIZE*3);
+    in1 = JSV_LOAD(wsptr + DCTSIZE*1);
+
+    z2 = JSV_ADD(in7, in3);
+    z3 = JSV_ADD(in5, in1);
+
+    z1 = JSV_MULC(JSV_ADD(z2, z3), FIX_1_175875602);
+    z2 = JSV_ADD(JSV_MULC(z2, - FIX_1_961570560), z1);
+    z3 = JSV_ADD(JSV_MULC(z3, - FIX_0_390180644), z1);
+
+    z1 = JSV_MULC(JSV_ADD(in7, in1), - FIX_0_899976223);
+    tmp0 = JSV_ADD(JSV_MULC(in7, FIX_0_298631336), JSV_ADD(z1, z2));
+    tmp3 = JSV_ADD(JSV_MULC(in1, FIX_1_501321110), JSV_ADD(z1, z3));
+
+    z1 = JSV_MULC(JSV_ADD(in5, in3), - FIX_2_562915447);
+    tmp1 = JSV_ADD(JSV_MULC(in5, FIX_2_053119869), JSV_ADD(z1, z3));
+    tmp2 = JSV_ADD(JSV_MULC(in3, FIX_3_072711026), JSV_ADD(z1, z2));
+
+    /* Final output stage: inputs are tmp10..tmp13, tmp0..tmp3 */
+
+    wsptr = workspace + row;
+    JSV_STORE(wsptr + DCTSIZE*0, JSV_DESCALE2(JSV_ADD(tmp10, tmp3)));
+    JSV_STORE(wsptr + DCTSIZE*7, JSV_DESCALE2(JSV_SUB(tmp10, tmp3)));
+    JSV_STORE(wsptr + DCTSIZE*1, JSV_DESCALE2(JSV_ADD(tmp11, tmp2)));
+    JSV_STORE(wsptr + DCTSIZE*6, JSV_DESCALE2(JSV_SUB(tmp11, tmp2)));
+    JSV_STORE(wsptr + DCTSIZE*2, JSV_DESCALE2(JSV_ADD(tmp12, tmp1)));
+    JSV_STORE(wsptr + DCTSIZE*5, JSV_DESCALE2(JSV_SUB(tmp12, tmp1)));
+    JSV_STORE(wsptr + DCTSIZE*3, JSV_DESCALE2(JSV_ADD(tmp13, tmp0)));
+    JSV_STORE(wsptr + DCTSIZE*4, JSV_DESCALE2(JSV_SUB(tmp13, tmp0)));
+  }
+
+  /* Turn the results back into rows and range-limit them to samples. */
+
+  for (row = 0; row < DCTSIZE; row += JSV_LANES)
+    for (col = 0; col < DCTSIZE; col += JSV_LANES)
+      JSV_FN(transpose)(workspace + col*DCTSIZE + row, DCTSIZE,
+                        transposed + row*DCTSIZE + col, DCTSIZE);
+
+  for (row = 0; row < DCTSIZE; row++)
+    for (col = 0; col < DCTSIZE; col += JSV_LANES)
+      JSV_PACKSTORE(output_buf[row] + output_col + col,
+                    JSV_LOAD(transposed + row*DCTSIZE + col));
+}
+
+
+/*
+ * Perform dequantization and inverse DCT on one block of coefficients,
+ * producing a 16x16 output block.  See jpeg_idct_16x16() for the algorithm.
+ */
+
+JSV_ATTR LOCAL(void)
+JSV_FN(idct_16x16) (j_decompress_ptr cinfo, jpeg_component_info * compptr,
+            JCOEFPTR coef_block,
+            JSAMPARRAY output_buf, JDIMENSION output_col)
+{
+  JSV tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+  JSV tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27;
+  JSV z1, z2, z3, z4;
+  JSV in0, in1, in2, in3, in4, in5, in6, in7;
+  JSV over, range_mask, range_subset;
+  JCOEFPTR inptr;
+  ISLOW_MULT_TYPE * quantptr;
+  int * wsptr;
+  int row, col;
+  int workspace[16*16];    /* buffers data between passes */
+  int transposed[16*16];
+
+  /* Pass 1: process columns from input, store into work array. */
+
+  over = JSV_SET1(0);
+  for (col = 0; col < 8; col += JSV_LANES) {
+    inptr = coef_block + col;
+    quantptr = (ISLOW_MULT_TYPE *) compptr->dct_table + col;
+    wsptr = workspace + col;
+
+    in0 = JSV_DEQUANT(0);
+    in1 = JSV_DEQUANT(1);
+    in2 = JSV_DEQUANT(2);
+    in3 = JSV_DEQUANT(3);
+    in4 = JSV_DEQUANT(4);
+    in5 = JSV_DEQUANT(5);
+    in6 = JSV_DEQUANT(6);
+    in7 = JSV_DEQUANT(7);
+    over = JSV_OR(over, JSV_OR(JSV_OR(JSV_OUTSIDE(in0, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in1, JSIMD_IDCT_LIMIT)),
+                               JSV_OR(JSV_OUTSIDE(in2, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in3, JSIMD_IDCT_LIMIT))));
+    over = JSV_OR(over, JSV_OR(JSV_OR(JSV_OUTSIDE(in4, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in5, JSIMD_IDCT_LIMIT)),
+                               JSV_OR(JSV_OUTSIDE(in6, JSIMD_IDCT_LIMIT),
+                                      JSV_OUTSIDE(in7, JSIMD_IDCT_LIMIT))));
+
+    /* Even part */
+
+    tmp0 = JSV_SHL(in0, CONST_BITS);
+    /* Add fudge factor here for final descale. */
+    tmp0 = JSV_ADD(tmp0, JSV_SET1(ONE << (CONST_BITS-PASS1_BITS-1)));
+
+    tmp1 = JSV_MULC(in4, FIX(1.306562965));
+    tmp2 = JSV_MULC(in4, FIX_0_541196100);
+
+    tmp10 = JSV_ADD(tmp0, tmp1);
+    tmp11 = JSV_SUB(tmp0, tmp1);
+    tmp12 = JSV_ADD(tmp0, tmp2);
+    tmp13 = JSV_SUB(tmp0, tmp2);
+
+    z3 = JSV_SUB(in2, in6);
+    z4 = JSV_MULC(z3, FIX(0.275899379));
+    z3 = JSV_MULC(z3, FIX(1.387039845));
+
+    tmp0 = JSV_ADD(z3, JSV_MULC(in6, FIX_2_562915447));
+    tmp1 = JSV_ADD(z4, JSV_MULC(in2, FIX_0_899976223));
+    tmp2 = JSV_SUB(z3, JSV_MULC(in2, FIX(0.601344887)));
+    tmp3 = JSV_SUB(z4, JSV_MULC(in6, FIX(0.509795579)));
+
+    tmp20 = JSV_ADD(tmp10, tmp0);
+    tmp27 = JSV_SUB(tmp10, tmp0);
+    tmp21 = JSV_ADD(tmp12, tmp1);
+    tmp26 = JSV_SUB(tmp12, tmp1);
+    tmp22 = JSV_ADD(tmp13, tmp2);
+    tmp25 = JSV_SUB(tmp13, tmp2);
+    tmp23 = JSV_ADD(tmp11, tmp3);
+    tmp24 = JSV_SUB(tmp11, tmp3);
+
+    /* Odd part */
+
+    z1 = in1;
+    z2 = in3;
+    z3 = in5;
+    z4 = in7;
+
+    tmp11 = JSV_ADD(z1, z3);
+
+    tmp1  = JSV_MULC(JSV_ADD(z1, z2), FIX(1.353318001));
+    tmp2  = JSV_MULC(tmp11, FIX(1.247225013));
+    tmp3  = JSV_MULC(JSV_ADD(z1, z4), FIX(1.093201867));
+    tmp10 = JSV_MULC(JSV_SUB(z1, z4), FIX(0.897167586));
+    tmp11 = JSV_MULC(tmp11, FIX(0.666655658));
+    tmp12 = JSV_MULC(JSV_SUB(z1, z2), FIX(0.410524528));
+    tmp0  = JSV_SUB(JSV_ADD(JSV_ADD(tmp1, tmp2), tmp3),
+                    JSV_MULC(z1, FIX(2.286341144)));
+    tmp13 = JSV_SUB(JSV_ADD(JSV_ADD(tmp10, tmp11), tmp12),
+                    JSV_MULC(z1, FIX(1.835730603)));
+    z1    = JSV_MULC(JSV_ADD(z2, z3), FIX(0.138617169));
+    tmp1  = JSV_ADD(tmp1, JSV_ADD(z1, JSV_MULC(z2, FIX(0.071888074))));
+    tmp2  = JSV_ADD(tmp2, JSV_SUB(z1, JSV_MULC(z3, FIX(1.125726048))));
+    z1    = JSV_MULC(JSV_SUB(z3, z2), FIX(1.407403738));
+    tmp11 = JSV_ADD(tmp11, JSV_SUB(z1, JSV_MULC(z3, FIX(0.766367282))));
+    tmp12 = JSV_ADD(tmp12, JSV_ADD(z1, JSV_MULC(z2, FIX(1.971951411))));
+    z2    = JSV_ADD(z2, z4);
+    z1    = JSV_MULC(z2, - FIX(0.666655658));
+    tmp1  = JSV_ADD(tmp1, z1);
+    tmp3  = JSV_ADD(tmp3, JSV_ADD(z1, JSV_MULC(z4, FIX(1.065388962))));
+    z2    = JSV_MULC(z2, - FIX(1.247225013));
+    tmp10 = JSV_ADD(tmp10, JSV_ADD(z2, JSV_MULC(z4, FIX(3.141271809))));
+    tmp12 = JSV_ADD(tmp12, z2);
+    z2    = JSV_MULC(JSV_ADD(z3, z4), - FIX(1.353318001));
+    tmp2  = JSV_ADD(tmp2, z2);
+    tmp3  = JSV_ADD(tmp3, z2);
+    z2    = JSV_MULC(JSV_SUB(z4, z3), FIX(0.410524528));
+    tmp10 = JSV_ADD(tmp10, z2);
+    tmp11 = JSV_ADD(tmp11, z2);
+
+    /* Final output stage */
+
+    JSV_STORE(wsptr + 8*0,
+              JSV_SRA(JSV_ADD(tmp20, tmp0), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*15,
+              JSV_SRA(JSV_SUB(tmp20, tmp0), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*1,
+              JSV_SRA(JSV_ADD(tmp21, tmp1), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*14,
+              JSV_SRA(JSV_SUB(tmp21, tmp1), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*2,
+              JSV_SRA(JSV_ADD(tmp22, tmp2), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*13,
+              JSV_SRA(JSV_SUB(tmp22, tmp2), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*3,
+              JSV_SRA(JSV_ADD(tmp23, tmp3), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*12,
+              JSV_SRA(JSV_SUB(tmp23, tmp3), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*4,
+              JSV_SRA(JSV_ADD(tmp24, tmp10), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*11,
+              JSV_SRA(JSV_SUB(tmp24, tmp10), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*5,
+              JSV_SRA(JSV_ADD(tmp25, tmp11), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*10,
+              JSV_SRA(JSV_SUB(tmp25, tmp11), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*6,
+              JSV_SRA(JSV_ADD(tmp26, tmp12), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*9,
+              JSV_SRA(JSV_SUB(tmp26, tmp12), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*7,
+              JSV_SRA(JSV_ADD(tmp27, tmp13), CONST_BITS-PASS1_BITS));
+    JSV_STORE(wsptr + 8*8,
+              JSV_SRA(JSV_SUB(tmp27, tmp13), CONST_BITS-PASS1_BITS));
+  }
+
+  if (JSV_ANY(over)) {
+    jpeg_idct_16x16(cinfo, compptr, coef_block, output_buf, output_col);
+    return;
+  }
+
+  /* Pass 2 works on one row per lane, so turn the work array around. */
+
+  for (row = 0; row < 16; row += JSV_LANES)
+    for (col = 0; col < 8; col += JSV_LANES)
+      JSV_FN(transpose)(workspace + row*8 + col, 8,
+                        transposed + col*16 + row, 16);
+
+  /* Pass 2: process 16 rows from work array, store results by column. */
+
+  range_mask = JSV_SET1(RANGE_MASK);
+  range_subset = JSV_SET1(RANGE_SUBSET);
+  for (row = 0; row < 16; row += JSV_LANES) {
+    wsptr = transposed + row;
+
+    /* Even part */
+
+    /* Add range center and fudge factor for final descale and range-limit. */
+    tmp0 = JSV_ADD(JSV_LOAD(wsptr + 16*0), JSV_SET1(PASS2_OFFSET));
+    tmp0 = JSV_SHL(tmp0, CONST_BITS);
+
+    z1 = JSV_LOAD(wsptr + 16*4);
+    tmp1 = JSV_MULC(z1, FIX(1.306562965));
+    tmp2 = JSV_MULC(z1, FIX_0_541196100);
+
+    tmp10 = JSV_ADD(tmp0, tmp1);
+    tmp11 = JSV_SUB(tmp0, tmp1);
+    tmp12 = JSV_ADD(tmp0, tmp2);
+    tmp13 = JSV_SUB(tmp0, tmp2);
+
+    z1 = JSV_LOAD(wsptr + 16*2);
+    z2 = JSV_LOAD(wsptr + 16*6);
+    z3 = JSV_SUB(z1, z2);
+    z4 = JSV_MULC(z3, FIX(0.275899379));
+    z3 = JSV_MULC(z3, FIX(1.387039845));
+
+    tmp0 = JSV_ADD(z3, JSV_MULC(z2, FIX_2_562915447));
+    tmp1 = JSV_ADD(z4, JSV_MULC(z1, FIX_0_899976223));
+    tmp2 = JSV_SUB(z3, JSV_MULC(z1, FIX(0.601344887)));
+    tmp3 = JSV_SUB(z4, JSV_MULC(z2, FIX(0.509795579)));
+
+    tmp20 = JSV_ADD(tmp10, tmp0);
+    tmp27 = JSV_SUB(tmp10, tmp0);
+    tmp21 = JSV_ADD(tmp12, tmp1);
+    tmp26 = JSV_SUB(tmp12, tmp1);
+    tmp22 = JSV_ADD(tmp13, tmp2);
+    tmp25 = JSV_SUB(tmp13, tmp2);
+    tmp23 = JSV_ADD(tmp11, tmp3);
+    tmp24 = JSV_SUB(tmp11, tmp3);
+
+    /* Odd part */
+
+    z1 = JSV_LOAD(wsptr + 16*1);
+    z2 = JSV_LOAD(wsptr + 16*3);
+    z3 = JSV_LOAD(wsptr + 16*5);
+    z4 = JSV_LOAD(wsptr + 16*7);
+
+    tmp11 = JSV_ADD(z1, z3);
+
+    tmp1  = JSV_MULC(JSV_ADD(z1, z2), FIX(1.353318001));
+    tmp2  = JSV_MULC(tmp11, FIX(1.247225013));
+    tmp3  = JSV_MULC(JSV_ADD(z1, z4), FIX(1.093201867));
+    tmp10 = JSV_MULC(JSV_SUB(z1, z4), FIX(0.897167586));
+    tmp11 = JSV_MULC(tmp11, FIX(0.666655658));
+    tmp12 = JSV_MULC(JSV_SUB(z1, z2), FIX(0.410524528));
+    tmp0  = JSV_SUB(JSV_ADD(JSV_ADD(tmp1, tmp2), tmp3),
+                    JSV_MULC(z1, FIX(2.286341144)));
+    tmp13 = JSV_SUB(JSV_ADD(JSV_ADD(tmp10, tmp11), tmp12),
+                    JSV_MULC(z1, FIX(1.835730603)));
+    z1    = JSV_MULC(JSV_ADD(z2, z3), FIX(0.138617169));
+    tmp1  = JSV_ADD(tmp1, JSV_ADD(z1, JSV_MULC(z2, FIX(0.071888074))));
+    tmp2  = JSV_ADD(tmp2, JSV_SUB(z1, JSV_MULC(z3, FIX(1.125726048))));
+    z1    = JSV_MULC(JSV_SUB(z3, z2), FIX(1.407403738));
+    tmp11 = JSV_ADD(tmp11, JSV_SUB(z1, JSV_MULC(z3, FIX(0.766367282))));
+    tmp12 = JSV_ADD(tmp12, JSV_ADD(z1, JSV_MULC(z2, FIX(1.971951411))));
+    z2    = JSV_ADD(z2, z4);
+    z1    = JSV_MULC(z2, - FIX(0.666655658));
+    tmp1  = JSV_ADD(tmp1, z1);
+    tmp3  = JSV_ADD(tmp3, JSV_ADD(z1, JSV_MULC(z4, FIX(1.065388962))));
+    z2    = JSV_MULC(z2, - FIX(1.247225013));
+    tmp10 = JSV_ADD(tmp10, JSV_ADD(z2, JSV_MULC(z4, FIX(3.141271809))));
+    tmp12 = JSV_ADD(tmp12, z2);
+    z2    = JSV_MULC(JSV_ADD(z3, z4), - FIX(1.353318001));
+    tmp2  = JSV_ADD(tmp2, z2);
+    tmp3  = JSV_ADD(tmp3, z2);
+    z2    = JSV_MULC(JSV_SUB(z4, z3), FIX(0.410524528));
+    tmp10 = JSV_ADD(tmp10, z2);
+    tmp11 = JSV_ADD(tmp11, z2);
+
+    /* Final output stage */
+
+    wsptr = workspace + row;
+    JSV_STORE(wsptr + 16*0,  JSV_DESCALE2(JSV_ADD(tmp20, tmp0)));
+    JSV_STORE(wsptr + 16*15, JSV_DESCALE2(JSV_SUB(tmp20, tmp0)));
+    JSV_STORE(wsptr + 16*1,  JSV_DESCALE2(JSV_ADD(tmp21, tmp1)));
+    JSV_STORE(wsptr + 16*14, JSV_DESCALE2(JSV_SUB(tmp21, tmp1)));
+    JSV_STORE(wsptr + 16*2,  JSV_DESCALE2(JSV_ADD(tmp22, tmp2)));
+    JSV_STORE(wsptr + 16*13, JSV_DESCALE2(JSV_SUB(tmp22, tmp2)));
+    JSV_STORE(wsptr + 16*3,  JSV_DESCALE2(JSV_ADD(tmp23, tmp3)));
+    JSV_STORE(wsptr + 16*12, JSV_DESCALE2(JSV_SUB(tmp23, tmp3)));
+    JSV_STORE(wsptr + 16*4,  JSV_DESCALE2(JSV_ADD(tmp24, tmp10)));
+    JSV_STORE(wsptr + 16*11, JSV_DESCALE2(JSV_SUB(tmp24, tmp10)));
+    JSV_STORE(wsptr + 16*5,  JSV_DESCALE2(JSV_ADD(tmp25, tmp11)));
+    JSV_STORE(wsptr + 16*10, JSV_DESCALE2(JSV_SUB(tmp25, tmp11)));
+    JSV_STORE(wsptr + 16*6,  JSV_DESCALE2(JSV_ADD(tmp26, tmp12)));
+    JSV_STORE(wsptr + 16*9,  JSV_DESCALE2(JSV_SUB(tmp26, tmp12)));
+    JSV_STORE(wsptr + 16*7,  JSV_DESCALE2(JSV_ADD(tmp27, tmp13)));
+    JSV_STORE(wsptr + 16*8,  JSV_DESCALE2(JSV_SUB(tmp27, tmp13)));
+  }
+
+  /* Turn the results back into rows and range-limit them to samples. */
+
+  for (row = 0; row < 16; row += JSV_LANES)
+    for (col = 0; col < 16; col += JSV_LANES)
+      JSV_FN(transpose)(workspace + col*16 + row, 16,
+                        transposed + row*16 + col, 16);
+
+  for (row = 0; row < 16; row++)
+    for (col = 0; col < 16; col += JSV_LANES)
+      JSV_PACKSTORE(output_buf[row] + output_col + col,
+                    JSV_LOAD(transposed + row*16 + col));
+}
+
+#undef JSV_MULC
+#undef JSV_DEQUANT
+#undef JSV_DESCALE2
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <string.h>
+
+#include "pngfilter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PNG_USE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PNG_USE_NEON
+#include <arm_neon.h>
+#endif
+
+/*
+ * Portable versions.  row[i - bpp] and prior[i - bpp] read the zero
+ * padding for the first pixel of the row.
+ */
+
+#if !defined(PNG_USE_SSE2) && !defined(PNG_USE_NEON)
+
+static void sub_c(unsigned char *row, int rowBytes, int bpp) {
+    int i;
+    for (i = 0; i < rowBytes; i++) {
+        row[i] = (unsigned char) (row[i] + row[i - bpp]);
+    }
+}
+
+static void up_c(unsigned char *row, const unsigned char *prior, int rowBytes) {
+    int i;
+    for (i = 0; i < rowBytes; i++) {
+        row[i] = (unsigned char) (row[i] + prior[i]);
+    }
+}
+
+#endif
+
+static void avg_c(unsigned char *row, const unsigned char *prior,
+                  int rowBytes, int bpp)
+{
+    int i;
+    for (i = 0; i < rowBytes; i++) {
+        row[i] = (unsigned char) (row[i] + ((row[i - bpp] + prior[i]) >> 1));
+    }
+}
+
+static void paeth_c(unsigned char *row, const unsigned char *prior,
+                    int rowBytes, int bpp)
+{
+    int i;
+    for (i = 0; i < rowBytes; i++) {
+        int a = row[i - bpp], b = prior[i], c = prior[i - bpp];
+        int pa = b - c, pb = a - c, pc = pa + pb;
+        if (pa < 0) pa = -pa;
+        if (pb < 0) pb = -pb;
+        if (pc < 0) pc = -pc;
+        row[i] = (unsigned char) (row[i]
+                + ((pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c));
+    }
+}
+
+#if defined(PNG_USE_SSE2)
+
+/*
+ * Up has no dependency between bytes and runs 16 at a time.
+ *
+ * Sub is a running sum over pixels.  For 1, 2, 4 and 8 bytes per pixel a
+ * register of 16 bytes is summed in log2(16 / bpp) shift-and-add steps and
+ * the last pixel of the previous register is added to all of them.  The
+ * other filters depend on the reconstructed pixel to the left, so they
+ * process a pixel at a time with every channel in its own lane, which
+ * still saves most of the work for RGB and RGBA images.  The bytes of a
+ * register beyond the pixel are never stored.
+ */
+
+static void up_sse2(unsigned char *row, const unsigned char *prior,
+                    int rowBytes)
+{
+    int i;
+    for (i = 0; i < rowBytes; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (row + i));
+        __m128i b = _mm_loadu_si128((const __m128i *) (prior + i));
+        _mm_storeu_si128((__m128i *) (row + i), _mm_add_epi8(x, b));
+    }
+}
+
+static inline __m128i prefix_sum_sse2(__m128i x, int bpp) {
+    switch (bpp) {
+        case 1:
+            x = _mm_add_epi8(x, _mm_slli_si128(x, 1));
+            /* FALLTHROUGH */
+        case 2:
+            x = _mm_add_epi8(x, _mm_slli_si128(x, 2));
+            /* FALLTHROUGH */
+        case 4:
+            x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+            /* FALLTHROUGH */
+        default:
+            return _mm_add_epi8(x, _mm_slli_si128(x, 8));
+    }
+}
+
+/* Copies the last pixel of x to every pixel position */
+static inline __m128i last_pixel_sse2(__m128i x, int bpp) {
+    switch (bpp) {
+        case 1:
+            x = _mm_unpackhi_epi8(x, x);
+            /* FALLTHROUGH */
+        case 2:
+            x = _mm_shufflehi_epi16(x, 0xFF);
+            return _mm_unpackhi_epi64(x, x);
+        case 4:
+            return _mm_shuffle_epi32(x, 0xFF);
+        default:
+            return _mm_unpackhi_epi64(x, x);
+    }
+}
+
+static inline __m128i load_pixel_sse2(const unsigned char *p) {
+    return _mm_loadl_epi64((const __m128i *) p);
+}
+
+static inline void store_pixel_sse2(unsigned char *p, __m128i v, int bpp) {
+    int lo = _mm_cvtsi128_si32(v);
+    switch (bpp) {
+        case 3:
+            memcpy(p, &lo, 3);
+            break;
+        case 4:
+            memcpy(p, &lo, 4);
+            break;
+        case 6: {
+            short hi = (short) _mm_extract_epi16(v, 2);
+            memcpy(p, &lo, 4);
+            memcpy(p + 4, &hi, 2);
+            break;
+        }
+        default:
+            _mm_storel_epi64((__m128i *) p, v);
+            break;
+    }
+}
+
+static void sub_sse2(unsigned char *row, int rowBytes, int bpp) {
+    int i;
+    __m128i a = _mm_setzero_si128();
+    if (bpp == 3 || bpp == 6) {
+        for (i = 0; i < rowBytes; i += bpp) {
+            a = _mm_add_epi8(a, load_pixel_sse2(row + i));
+            store_pixel_sse2(row + i, a, bpp);
+        }
+        return;
+    }
+    for (i = 0; i < rowBytes; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (row + i));
+        x = _mm_add_epi8(prefix_sum_sse2(x, bpp), a);
+        _mm_storeu_si128((__m128i *) (row + i), x);
+        a = last_pixel_sse2(x, bpp);
+    }
+}
+
+static void avg_sse2(unsigned char *row, const unsigned char *prior,
+                     int rowBytes, int bpp)
+{
+    int i;
+    __m128i one = _mm_set1_epi8(1);
+    __m128i a = _mm_setzero_si128();
+    for (i = 0; i < rowBytes; i += bpp) {
+        __m128i b = load_pixel_sse2(prior + i);
+        // _mm_avg_epu8 rounds up, take the carry back off
+        __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b),
+                                   _mm_and_si128(_mm_xor_si128(a, b), one));
+        a = _mm_add_epi8(load_pixel_sse2(row + i), avg);
+        store_pixel_sse2(row + i, a, bpp);
+    }
+}
+
+static inline __m128i abs_epi16_sse2(__m128i v) {
+    return _mm_max_epi16(v, _mm_sub_epi16(_mm_setzero_si128(), v));
+}
+
+static void paeth_sse2(unsigned char *row, const unsigned char *prior,
+                       int rowBytes, int bpp)
+{
+    int i;
+    __m128i zero = _mm_setzero_si128();
+    __m128i a = zero, c = zero;
+    for (i = 0; i < rowBytes; i += bpp) {
+        __m128i b = _mm_unpacklo_epi8(load_pixel_sse2(prior + i), zero);
+        __m128i bc = _mm_sub_epi16(b, c);
+        __m128i ac = _mm_sub_epi16(a, c);
+        __m128i pa = abs_epi16_sse2(bc);
+        __m128i pb = abs_epi16_sse2(ac);
+        __m128i pc = abs_epi16_sse2(_mm_add_epi16(bc, ac));
+        // (pb <= pc) ? b : c
+        __m128i m = _mm_cmpgt_epi16(pb, pc);
+        __m128i pred = _mm_or_si128(_mm_and_si128(m, c), _mm_andnot_si128(m, b));
+        // (pa <= pb && pa <= pc) ? a : pred
+        m = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+        pred = _mm_or_si128(_mm_and_si128(m, pred), _mm_andnot_si128(m, a));
+
+        a = _mm_add_epi8(load_pixel_sse2(row + i), _mm_packus_epi16(pred, pred));
+        store_pixel_sse2(row + i, a, bpp);
+        a = _mm_unpacklo_epi8(a, zero);
+        c = b;
+    }
+}
+
+#elif defined(PNG_USE_NEON)
+
+/* See the SSE2 versions above for how the filters are vectorized */
+
+static void up_neon(unsigned char *row, const unsigned char *prior,
+                    int rowBytes)
+{
+    int i;
+    for (i = 0; i < rowBytes; i += 16) {
+        vst1q_u8(row + i, vaddq_u8(vld1q_u8(row + i), vld1q_u8(prior + i)));
+    }
+}
+
+static inline uint8x16_t prefix_sum_neon(uint8x16_t x, int bpp) {
+    uint8x16_t z = vdupq_n_u8(0);
+    switch (bpp) {
+        case 1:
+            x = vaddq_u8(x, vextq_u8(z, x, 15));
+            /* FALLTHROUGH */
+        case 2:
+            x = vaddq_u8(x, vextq_u8(z, x, 14));
+            /* FALLTHROUGH */
+        case 4:
+            x = vaddq_u8(x, vextq_u8(z, x, 12));
+            /* FALLTHROUGH */
+        default:
+            return vaddq_u8(x, vextq_u8(z, x, 8));
+    }
+}
+
+static inline uint8x16_t last_pixel_neon(uint8x16_t x, int bpp) {
+    switch (bpp) {
+        case 1:
+            return vdupq_n_u8(vgetq_lane_u8(x, 15));
+        case 2:
+            return vreinterpretq_u8_u16(vdupq_n_u16(
+                    vgetq_lane_u16(vreinterpretq_u16_u8(x), 7)));
+        case 4:
+            return vreinterpretq_u8_u32(vdupq_n_u32(
+                    vgetq_lane_u32(vreinterpretq_u32_u8(x), 3)));
+        default:
+            return vreinterpretq_u8_u64(vdupq_n_u64(
+                    vgetq_lane_u64(vreinterpretq_u64_u8(x), 1)));
+    }
+}
+
+static inline void store_pixel_neon(unsigned char *p, uint8x8_t v, int bpp) {
+    uint32_t lo = vget_lane_u32(vreinterpret_u32_u8(v), 0);
+    switch (bpp) {
+        case 3:
+            memcpy(p, &lo, 3);
+            break;
+        case 4:
+            memcpy(p, &lo, 4);
+            break;
+        case 6: {
+            uint16_t hi = vget_lane_u16(vreinterpret_u16_u8(v), 2);
+            memcpy(p, &lo, 4);
+            memcpy(p + 4, &hi, 2);
+            break;
+        }
+        default:
+            vst1_u8(p, v);
+            break;
+    }
+}
+
+static void sub_neon(unsigned char *row, int rowBytes, int bpp) {
+    int i;
+    uint8x16_t a = vdupq_n_u8(0);
+    if (bpp == 3 || bpp == 6) {
+        uint8x8_t p = vget_low_u8(a);
+        for (i = 0; i < rowBytes; i += bpp) {
+            p = vadd_u8(p, vld1_u8(row + i));
+            store_pixel_neon(row + i, p, bpp);
+        }
+        return;
+    }
+    for (i = 0; i < rowBytes; i += 16) {
+        uint8x16_t x = vaddq_u8(prefix_sum_neon(vld1q_u8(row + i), bpp), a);
+        vst1q_u8(row + i, x);
+        a = last_pixel_neon(x, bpp);
+    }
+}
+
+static void avg_neon(unsigned char *row, const unsigned char *prior,
+                     int rowBytes, int bpp)
+{
+    int i;
+    uint8x8_t a = vdup_n_u8(0);
+    for (i = 0; i < rowBytes; i += bpp) {
+        a = vadd_u8(vld1_u8(row + i), vhadd_u8(a, vld1_u8(prior + i)));
+        store_pixel_neon(row + i, a, bpp);
+    }
+}
+
+static void paeth_neon(unsigned char *row, const unsigned char *prior,
+                       int rowBytes, int bpp)
+{
+    int i;
+    uint8x8_t a = vdup_n_u8(0), c = a;
+    for (i = 0; i < rowBytes; i += bpp) {
+        uint8x8_t b = vld1_u8(prior + i);
+        uint16x8_t pa = vmovl_u8(vabd_u8(b, c));
+        uint16x8_t pb = vmovl_u8(vabd_u8(a, c));
+        uint16x8_t pc = vabdq_u16(vaddl_u8(a, b), vshll_n_u8(c, 1));
+        // (pb <= pc) ? b : c
+        uint8x8_t pred = vbsl_u8(vmovn_u16(vcleq_u16(pb, pc)), b, c);
+        // (pa <= pb && pa <= pc) ? a : pred
+        uint8x8_t m = vmovn_u16(vandq_u16(vcleq_u16(pa, pb), vcleq_u16(pa, pc)));
+        pred = vbsl_u8(m, a, pred);
+
+        a = vadd_u8(vld1_u8(row + i), pred);
+        store_pixel_neon(row + i, a, bpp);
+        c = b;
+    }
+}
+
+#endif
+
+void png_unfilter_row(int filter, unsigned char *row,
+                      const unsigned char *prior, int rowBytes, int bpp)
+{
+    switch (filter) {
+        case PNG_FILTER_SUB:
+#if defined(PNG_USE_SSE2)
+            sub_sse2(row, rowBytes, bpp);
+#elif defined(PNG_USE_NEON)
+            sub_neon(row, rowBytes, bpp);
+#else
+            sub_c(row, rowBytes, bpp);
+#endif
+            break;
+        case PNG_FILTER_UP:
+#if defined(PNG_USE_SSE2)
+            up_sse2(row, prior, rowBytes);
+#elif defined(PNG_USE_NEON)
+            up_neon(row, prior, rowBytes);
+#else
+            up_c(row, prior, rowBytes);
+#endif
+            break;
+        case PNG_FILTER_AVERAGE:
+#if defined(PNG_USE_SSE2)
+            if (bpp >= 3) {
+                avg_sse2(row, prior, rowBytes, bpp);
+                break;
+            }
+#elif defined(PNG_USE_NEON)
+            if (bpp >= 3) {
+                avg_neon(row, prior, rowBytes, bpp);
+                break;
+            }
+#endif
+            avg_c(row, prior, rowBytes, bpp);
+            break;
+        case PNG_FILTER_PAETH:
+#if defined(PNG_USE_SSE2)
+            if (bpp >= 3) {
+                paeth_sse2(row, prior, rowBytes, bpp);
+                break;
+            }
+#elif defined(PNG_USE_NEON)
+            if (bpp >= 3) {
+                paeth_neon(row, prior, rowBytes, bpp);
+                break;
+            }
+#endif
+            paeth_c(row, prior, rowBytes, bpp);
+            break;
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_pngfilter
+#define _Included_pngfilter
+
+/*
+ * PNG scanline unfiltering (PNG specification, section 9).
+ *
+ * Every row buffer handed to png_unfilter_row() must be preceded by
+ * PNG_ROW_PAD zero bytes and followed by PNG_ROW_PAD bytes of slack:
+ * the leading zeros stand in for the pixel left of the first one, so the
+ * kernels need no special case for it, and the trailing slack lets the
+ * vector loops run over whole registers.  A prior row of all zeros is
+ * used for the first row of every pass.
+ *
+ * The reconstructed bytes are exactly those of the Java implementation
+ * in PNGImageLoader2; only the instruction set differs.  SSE2 is used on
+ * x86 and NEON on ARM when the compiler targets them, other platforms
+ * use the portable C loops.
+ */
+
+#define PNG_ROW_PAD 16
+
+#define PNG_FILTER_NONE    0
+#define PNG_FILTER_SUB     1
+#define PNG_FILTER_UP      2
+#define PNG_FILTER_AVERAGE 3
+#define PNG_FILTER_PAETH   4
+
+/*
+ * Reconstructs rowBytes bytes of row in place.  bpp is the number of
+ * bytes per complete pixel, rounded up to one, and must not exceed 8.
+ * Unknown filter types leave the row untouched, as the Java decoder does.
+ */
+void png_unfilter_row(int filter, unsigned char *row,
+                      const unsigned char *prior, int rowBytes, int bpp);
+
+#endif /* _Included_pngfilter */
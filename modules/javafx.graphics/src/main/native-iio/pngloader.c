@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Native row decoder for PNGImageLoader2.
+ *
+ * The Java loader parses the chunks and inflates the IDAT stream, then
+ * hands the inflated bytes to decodeRows() in large batches.  This file
+ * splits them into scanlines, unfilters them with the kernels of
+ * pngfilter.c and stores the pixels at their final place in the image,
+ * doing the bit depth conversion, tRNS expansion, palette lookup and
+ * Adam7 placement on the way.  Rows may be split across batches.
+ *
+ * The output is byte for byte what the Java implementation produces,
+ * except that palette images are expanded to RGB or RGBA right away.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "jni.h"
+
+#include "com_sun_javafx_iio_png_PNGImageLoader2.h"
+
+#include "pngfilter.h"
+
+#if defined (_LP64) || defined(_WIN64)
+#define jlong_to_ptr(a) ((void*)(a))
+#define ptr_to_jlong(a) ((jlong)(a))
+#else
+#define jlong_to_ptr(a) ((void*)(int)(a))
+#define ptr_to_jlong(a) ((jlong)(int)(a))
+#endif
+
+/* Defined in jpegloader.c */
+JNIEXPORT void JNICALL
+ThrowByName(JNIEnv *env, const char *name, const char *msg);
+
+/* Must match the color types in PNGImageLoader2 */
+#define PNG_COLOR_GRAY       0
+#define PNG_COLOR_RGB        2
+#define PNG_COLOR_PALETTE    3
+#define PNG_COLOR_GRAY_ALPHA 4
+#define PNG_COLOR_RGB_ALPHA  6
+
+/* Adam7 passes 0 - 6, pass 7 stands for a non-interlaced image */
+static const int starting_y[] = {0, 0, 4, 0, 2, 0, 1, 0};
+static const int starting_x[] = {0, 4, 0, 2, 0, 1, 0, 0};
+static const int increment_y[] = {8, 8, 8, 4, 4, 2, 2, 1};
+static const int increment_x[] = {8, 8, 4, 4, 2, 2, 1, 1};
+
+typedef struct pngDecoderStruct {
+    int width, height;
+    int bitDepth, colorType;
+    jboolean interlaced;
+    int channels;        /* samples per pixel in the stream */
+    int filterBpp;       /* bytes per complete pixel, at least 1 */
+    int outBpp;          /* bytes per pixel in the image */
+    jboolean trnsPresent; /* tRNS for gray and RGB images */
+    jint trnsR, trnsG, trnsB;
+    unsigned char palette[256 * 4];
+    unsigned char grayScale[16]; /* bit depth < 8 gray => 8 bit */
+
+    /* Position in the data stream */
+    jboolean done;
+    int pass;
+    int passWidth, passHeight;
+    int rowBytes;
+    int y;
+    int filter;
+    int filled;          /* bytes of the row received, -1 before its filter byte */
+
+    unsigned char *buffer;
+    unsigned char *row, *prior;
+} pngDecoder, *pngDecoderPtr;
+
+static void nextPass(pngDecoderPtr d) {
+    int last = d->interlaced ? 6 : 7;
+    while (++d->pass <= last) {
+        if (d->width > starting_x[d->pass] && d->height > starting_y[d->pass]) {
+            int sx = starting_x[d->pass], ix = increment_x[d->pass];
+            int sy = starting_y[d->pass], iy = increment_y[d->pass];
+            d->passWidth = (d->width - sx + ix - 1) / ix;
+            d->passHeight = (d->height - sy + iy - 1) / iy;
+            d->rowBytes = (int) (((size_t) d->passWidth * d->bitDepth
+                    * d->channels + 7) / 8);
+            d->y = 0;
+            d->filled = -1;
+            // the first row of a pass has no prior row
+            memset(d->prior, 0, d->rowBytes);
+            return;
+        }
+    }
+    d->done = JNI_TRUE;
+}
+
+/*
+ * Stores the reconstructed row d->row, the only sample conversions are
+ * those of PNGImageLoader2.
+ */
+static void storeRow(pngDecoderPtr d, unsigned char *image) {
+    int pass = d->pass;
+    int y = starting_y[pass] + d->y * increment_y[pass];
+    int w = d->passWidth, outBpp = d->outBpp;
+    size_t step = (size_t) increment_x[pass] * outBpp;
+    const unsigned char *in = d->row;
+    unsigned char *out = image
+            + ((size_t) y * d->width + starting_x[pass]) * outBpp;
+    int x, b;
+
+    if (d->bitDepth < 8) {
+        int bits = d->bitDepth, maxV = (1 << bits) - 1;
+        for (x = 0; x < w; x++, out += step) {
+            int bit = x * bits;
+            int v = (in[bit >> 3] >> (8 - bits - (bit & 7))) & maxV;
+            if (d->colorType == PNG_COLOR_PALETTE) {
+                memcpy(out, d->palette + v * outBpp, outBpp);
+            } else {
+                out[0] = d->grayScale[v];
+                if (d->trnsPresent) {
+                    out[1] = (v == d->trnsG) ? 0 : 255;
+                }
+            }
+        }
+    } else if (d->colorType == PNG_COLOR_PALETTE) {
+        for (x = 0; x < w; x++, out += step) {
+            memcpy(out, d->palette + in[x] * outBpp, outBpp);
+        }
+    } else if (d->bitDepth == 16) {
+        int channels = d->channels;
+        for (x = 0; x < w; x++, out += step, in += 2 * channels) {
+            for (b = 0; b < channels; b++) {
+                out[b] = in[2 * b];
+            }
+            if (d->trnsPresent) {
+                // compared as signed shorts, like the Java code
+                jint g = (jshort) ((in[0] << 8) | in[1]);
+                if (channels == 1) {
+                    out[1] = (g == d->trnsG) ? 0 : 255;
+                } else {
+                    jint r = g;
+                    g = (jshort) ((in[2] << 8) | in[3]);
+                    out[3] = (r == d->trnsR && g == d->trnsG
+                            && (jshort) ((in[4] << 8) | in[5]) == d->trnsB)
+                            ? 0 : 255;
+                }
+            }
+        }
+    } else if (!d->trnsPresent) {
+        if (step == (size_t) outBpp) {
+            memcpy(out, in, d->rowBytes);
+        } else {
+            for (x = 0; x < w; x++, out += step, in += outBpp) {
+                memcpy(out, in, outBpp);
+            }
+        }
+    } else if (d->channels == 1) {
+        unsigned char tG = (unsigned char) d->trnsG;
+        for (x = 0; x < w; x++, out += step) {
+            out[0] = in[x];
+            out[1] = (in[x] == tG) ? 0 : 255;
+        }
+    } else {
+        unsigned char tR = (unsigned char) d->trnsR;
+        unsigned char tG = (unsigned char) d->trnsG;
+        unsigned char tB = (unsigned char) d->trnsB;
+        for (x = 0; x < w; x++, out += step, in += 3) {
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+            out[3] = (in[0] == tR && in[1] == tG && in[2] == tB) ? 0 : 255;
+        }
+    }
+}
+
+static void disposeDecoder(pngDecoderPtr d) {
+    if (d != NULL) {
+        free(d->buffer);
+        free(d);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_javafx_iio_png_PNGImageLoader2_initDecoder
+(JNIEnv *env, jclass cls, jint width, jint height, jint bitDepth,
+        jint colorType, jboolean interlaced, jbyteArray palette, jintArray trns) {
+    static const int channelsPerColorType[] = {1, -1, 3, 1, 2, -1, 4};
+    pngDecoderPtr d;
+    size_t maxRowBytes, rowSize;
+
+    if (width <= 0 || height <= 0 || colorType < 0 || colorType > 6
+            || channelsPerColorType[colorType] < 0
+            || (bitDepth != 1 && bitDepth != 2 && bitDepth != 4
+                && bitDepth != 8 && bitDepth != 16)) {
+        ThrowByName(env, "java/io/IOException", "Bad PNG header!");
+        return 0;
+    }
+
+    d = (pngDecoderPtr) calloc(1, sizeof(pngDecoder));
+    if (d == NULL) {
+        ThrowByName(env, "java/lang/OutOfMemoryError", "Initializing PNG decoder");
+        return 0;
+    }
+
+    d->width = width;
+    d->height = height;
+    d->bitDepth = bitDepth;
+    d->colorType = colorType;
+    d->interlaced = interlaced;
+    d->channels = channelsPerColorType[colorType];
+    d->filterBpp = (d->channels * bitDepth + 7) / 8;
+    d->outBpp = d->channels;
+
+    if (colorType == PNG_COLOR_PALETTE) {
+        jsize entries = 1 << bitDepth;
+        jsize length = palette != NULL ? (*env)->GetArrayLength(env, palette) : 0;
+        if (bitDepth > 8 || (length != entries * 3 && length != entries * 4)) {
+            disposeDecoder(d);
+            ThrowByName(env, "java/io/IOException", "Bad PNG palette!");
+            return 0;
+        }
+        d->outBpp = length / entries;
+        (*env)->GetByteArrayRegion(env, palette, 0, length, (jbyte *) d->palette);
+    } else if (trns != NULL && (colorType == PNG_COLOR_GRAY || colorType == PNG_COLOR_RGB)) {
+        jint values[3];
+        if ((*env)->GetArrayLength(env, trns) != 3) {
+            disposeDecoder(d);
+            ThrowByName(env, "java/io/IOException", "Bad PNG transparency!");
+            return 0;
+        }
+        (*env)->GetIntArrayRegion(env, trns, 0, 3, values);
+        d->trnsPresent = JNI_TRUE;
+        d->trnsR = values[0];
+        d->trnsG = values[1];
+        d->trnsB = values[2];
+        d->outBpp++;
+    }
+
+    if (bitDepth < 8) {
+        int v, maxV = (1 << bitDepth) - 1;
+        for (v = 0; v <= maxV; v++) {
+            d->grayScale[v] = (unsigned char) ((v * 255 + maxV / 2) / maxV);
+        }
+    }
+
+    // two rows, each with PNG_ROW_PAD bytes of zeros in front and
+    // PNG_ROW_PAD bytes of slack behind, see pngfilter.h
+    maxRowBytes = ((size_t) width * bitDepth * d->channels + 7) / 8;
+    if (maxRowBytes > (size_t) 0x7fffffff / 2 - 2 * PNG_ROW_PAD) {
+        disposeDecoder(d);
+        ThrowByName(env, "java/io/IOException", "Bad PNG image size!");
+        return 0;
+    }
+    rowSize = maxRowBytes + 2 * PNG_ROW_PAD;
+    d->buffer = (unsigned char *) calloc(2, rowSize);
+    if (d->buffer == NULL) {
+        disposeDecoder(d);
+        ThrowByName(env, "java/lang/OutOfMemoryError", "Initializing PNG decoder");
+        return 0;
+    }
+    d->row = d->buffer + PNG_ROW_PAD;
+    d->prior = d->row + rowSize;
+
+    d->pass = interlaced ? -1 : 6;
+    nextPass(d);
+
+    return ptr_to_jlong(d);
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_png_PNGImageLoader2_decodeRows
+(JNIEnv *env, jclass cls, jlong ptr, jbyteArray data, jint length, jbyteArray image) {
+    pngDecoderPtr d = (pngDecoderPtr) jlong_to_ptr(ptr);
+    const unsigned char *src, *in;
+    unsigned char *out;
+
+    if (d == NULL) {
+        ThrowByName(env, "java/lang/NullPointerException", "PNG decoder disposed");
+        return JNI_TRUE;
+    }
+    if (d->done || length <= 0) {
+        return d->done;
+    }
+    if (length > (*env)->GetArrayLength(env, data)
+            || (size_t) (*env)->GetArrayLength(env, image)
+                < (size_t) d->width * d->height * d->outBpp) {
+        ThrowByName(env, "java/lang/ArrayIndexOutOfBoundsException", "PNG row data");
+        return JNI_TRUE;
+    }
+
+    in = (const unsigned char *) (*env)->GetPrimitiveArrayCritical(env, data, NULL);
+    if (in == NULL) {
+        ThrowByName(env, "java/io/IOException", "Unable to pin PNG data array");
+        return JNI_TRUE;
+    }
+    out = (unsigned char *) (*env)->GetPrimitiveArrayCritical(env, image, NULL);
+    if (out == NULL) {
+        (*env)->ReleasePrimitiveArrayCritical(env, data, (void *) in, JNI_ABORT);
+        ThrowByName(env, "java/io/IOException", "Unable to pin PNG image array");
+        return JNI_TRUE;
+    }
+
+    src = in;
+    while (length > 0 && !d->done) {
+        int n;
+        if (d->filled < 0) {
+            d->filter = *src++;
+            length--;
+            d->filled = 0;
+            continue;
+        }
+
+        n = d->rowBytes - d->filled;
+        if (n > length) {
+            n = length;
+        }
+        memcpy(d->row + d->filled, src, n);
+        src += n;
+        length -= n;
+        d->filled += n;
+
+        if (d->filled == d->rowBytes) {
+            unsigned char *tmp;
+
+            png_unfilter_row(d->filter, d->row, d->prior, d->rowBytes, d->filterBpp);
+            storeRow(d, out);
+
+            tmp = d->prior;
+            d->prior = d->row;
+            d->row = tmp;
+            d->filled = -1;
+            if (++d->y == d->passHeight) {
+                nextPass(d);
+            }
+        }
+    }
+
+    (*env)->ReleasePrimitiveArrayCritical(env, image, out, 0);
+    (*env)->ReleasePrimitiveArrayCritical(env, data, (void *) in, JNI_ABORT);
+
+    return d->done;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_javafx_iio_png_PNGImageLoader2_disposeDecoder
+(JNIEnv *env, jclass cls, jlong ptr) {
+    disposeDecoder((pngDecoderPtr) jlong_to_ptr(ptr));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -71,11 +71,34 @@ void initializeCtxInfo(ContextInfo *ctxInfo) {
     memset(ctxInfo, 0, sizeof (ContextInfo));
 }
 
+/*
+ * Deletes the buffer object and the fences of a stream ring. Must be
+ * called while the context the ring belongs to is current.
+ */
+static void deleteStreamRing(ContextInfo *ctxInfo, StreamRing *ring) {
+    int i;
+
+    for (i = 0; i < STREAM_RING_SEGMENTS; i++) {
+        if ((ring->fences[i] != NULL) && (ctxInfo->glDeleteSync != NULL)) {
+            ctxInfo->glDeleteSync(ring->fences[i]);
+        }
+        ring->fences[i] = NULL;
+    }
+    if ((ring->buffer != 0) && (ctxInfo->glDeleteBuffers != NULL)) {
+        ctxInfo->glDeleteBuffers(1, &ring->buffer);
+    }
+    ring->buffer = 0;
+}
+
 void deleteCtxInfo(ContextInfo *ctxInfo) {
     if (ctxInfo == NULL) {
         return;
     }
 
+    // Before the context they belong to is destroyed below
+    deleteStreamRing(ctxInfo, &ctxInfo->vertexRing);
+    deleteStreamRing(ctxInfo, &ctxInfo->pixelRing);
+
     if (ctxInfo->versionStr != NULL) {
         free(ctxInfo->versionStr);
     }
@@ -123,6 +146,8 @@ void initState(ContextInfo *ctxInfo) {
 
     glEnable(GL_BLEND);
     glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    ctxInfo->state.blendSrc = GL_ONE;
+    ctxInfo->state.blendDst = GL_ONE_MINUS_SRC_ALPHA;
 
     // initialize states and properties to
     // match cached states and properties
@@ -151,6 +176,14 @@ void initState(ContextInfo *ctxInfo) {
     ctxInfo->state.cullEnable = JNI_FALSE;
     ctxInfo->state.cullMode = GL_BACK;
     ctxInfo->state.fbo = 0;
+
+    // a new context has texture unit 0 active, no textures bound and no
+    // program in use
+    ctxInfo->state.activeTexture = 0;
+    memset(ctxInfo->state.boundTextures, 0, sizeof(ctxInfo->state.boundTextures));
+    ctxInfo->state.program = 0;
+    ctxInfo->state.scissorBox[2] = -1;
+    ctxInfo->state.skippedCalls = 0;
 }
 
 void clearBuffers(ContextInfo *ctxInfo,
@@ -210,6 +243,85 @@ void bindFBO(ContextInfo *ctxInfo, GLuint fboId) {
     ctxInfo->state.fbo = fboId;
 }
 
+/*
+ * The functions below only call GL if that changes the state cached in
+ * ctxInfo->state, and count the calls they leave out. Calls that repeat
+ * the current state still cost a driver round trip, which is expensive
+ * with software GL implementations in particular.
+ */
+static void setActiveTexture(ContextInfo *ctxInfo, GLuint unit) {
+    if (ctxInfo->glActiveTexture == NULL) {
+        return;
+    }
+    if (ctxInfo->state.activeTexture == unit) {
+        ctxInfo->state.skippedCalls++;
+        return;
+    }
+    ctxInfo->glActiveTexture(GL_TEXTURE0 + unit);
+    ctxInfo->state.activeTexture = unit;
+}
+
+static void bindTexture(ContextInfo *ctxInfo, GLuint texID) {
+    GLuint unit = ctxInfo->state.activeTexture;
+
+    if (unit < NUM_CACHED_TEXTURE_UNITS) {
+        if (ctxInfo->state.boundTextures[unit] == texID) {
+            ctxInfo->state.skippedCalls++;
+            return;
+        }
+        ctxInfo->state.boundTextures[unit] = texID;
+    }
+    glBindTexture(GL_TEXTURE_2D, texID);
+}
+
+static void useProgram(ContextInfo *ctxInfo, GLuint program) {
+    if (ctxInfo->glUseProgram == NULL) {
+        return;
+    }
+    if (ctxInfo->state.program == program) {
+        ctxInfo->state.skippedCalls++;
+        return;
+    }
+    ctxInfo->glUseProgram(program);
+    ctxInfo->state.program = program;
+}
+
+static void blendFunc(ContextInfo *ctxInfo, GLenum sFactor, GLenum dFactor) {
+    if ((ctxInfo->state.blendSrc == sFactor) && (ctxInfo->state.blendDst == dFactor)) {
+        ctxInfo->state.skippedCalls++;
+        return;
+    }
+    glBlendFunc(sFactor, dFactor);
+    ctxInfo->state.blendSrc = sFactor;
+    ctxInfo->state.blendDst = dFactor;
+}
+
+static void scissorTest(ContextInfo *ctxInfo, jboolean enable,
+        GLint x, GLint y, GLsizei w, GLsizei h) {
+    GLint *box = ctxInfo->state.scissorBox;
+
+    if (enable) {
+        if (!ctxInfo->state.scissorEnabled) {
+            glEnable(GL_SCISSOR_TEST);
+            ctxInfo->state.scissorEnabled = JNI_TRUE;
+        }
+        if ((box[0] == x) && (box[1] == y) && (box[2] == w) && (box[3] == h)) {
+            ctxInfo->state.skippedCalls++;
+            return;
+        }
+        glScissor(x, y, w, h);
+        box[0] = x;
+        box[1] = y;
+        box[2] = w;
+        box[3] = h;
+    } else if (ctxInfo->state.scissorEnabled) {
+        glDisable(GL_SCISSOR_TEST);
+        ctxInfo->state.scissorEnabled = JNI_FALSE;
+    } else {
+        ctxInfo->state.skippedCalls++;
+    }
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nActiveTexture
@@ -218,10 +330,10 @@ void bindFBO(ContextInfo *ctxInfo, GLuint fboId) {
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nActiveTexture
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texUnit) {
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glActiveTexture == NULL)) {
+    if (ctxInfo == NULL) {
         return;
     }
-    ctxInfo->glActiveTexture(GL_TEXTURE0 + texUnit);
+    setActiveTexture(ctxInfo, (GLuint) texUnit);
 }
 
 /*
@@ -242,7 +354,11 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBindFBO
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBindTexture
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID) {
-    glBindTexture(GL_TEXTURE_2D, texID);
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return;
+    }
+    bindTexture(ctxInfo, (GLuint) texID);
 }
 
 GLenum translateScaleFactor(jint scaleFactor) {
@@ -286,11 +402,75 @@ GLenum translateScaleFactor(jint scaleFactor) {
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBlendFunc
- * Signature: (II)V
+ * Signature: (JII)V
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBlendFunc
-(JNIEnv *env, jclass class, jint sFactor, jint dFactor) {
-    glBlendFunc(translateScaleFactor(sFactor), translateScaleFactor(dFactor));
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint sFactor, jint dFactor) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return;
+    }
+    blendFunc(ctxInfo, translateScaleFactor(sFactor), translateScaleFactor(dFactor));
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nSetState
+ * Signature: (J[II)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetState
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jintArray opsArr, jint length) {
+    jint *ops;
+    int i = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (opsArr == NULL)) {
+        return;
+    }
+    if (length > (*env)->GetArrayLength(env, opsArr)) {
+        length = (*env)->GetArrayLength(env, opsArr);
+    }
+
+    ops = (jint *) (*env)->GetPrimitiveArrayCritical(env, opsArr, NULL);
+    if (ops == NULL) {
+        return;
+    }
+    /* Every operation is followed by a single operand */
+    while (i + 1 < length) {
+        switch (ops[i]) {
+            case com_sun_prism_es2_GLContext_STATE_ACTIVE_TEXTURE:
+                setActiveTexture(ctxInfo, (GLuint) ops[i + 1]);
+                i += 2;
+                break;
+            case com_sun_prism_es2_GLContext_STATE_BIND_TEXTURE:
+                bindTexture(ctxInfo, (GLuint) ops[i + 1]);
+                i += 2;
+                break;
+            default:
+                /* Unknown operation, the rest of the array is unusable */
+                i = length;
+                break;
+        }
+    }
+    (*env)->ReleasePrimitiveArrayCritical(env, opsArr, ops, JNI_ABORT);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetSkippedStateCalls
+ * Signature: (JZ)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nGetSkippedStateCalls
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jboolean reset) {
+    jint skipped;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return 0;
+    }
+    skipped = ctxInfo->state.skippedCalls;
+    if (reset) {
+        ctxInfo->state.skippedCalls = 0;
+    }
+    return skipped;
 }
 
 /*
@@ -575,6 +755,12 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
         free(attrNameString);
     }
 
+    // allow the linked program to be stored in the program binary cache
+    if (ctxInfo->glProgramParameteri != NULL) {
+        ctxInfo->glProgramParameteri(shaderProgram,
+                GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     // link the program
     ctxInfo->glLinkProgram(shaderProgram);
     ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
@@ -607,6 +793,110 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
     return shaderProgram;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsProgramBinarySupported
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsProgramBinarySupported
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLint numFormats = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glGetProgramBinary == NULL)
+            || (ctxInfo->glProgramBinary == NULL)) {
+        return JNI_FALSE;
+    }
+
+    // A driver may support the entry points but no binary format at all
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    if (glGetError() != GL_NO_ERROR) {
+        return JNI_FALSE;
+    }
+    return numFormats > 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetProgramBinary
+ * Signature: (JI[I)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_sun_prism_es2_GLContext_nGetProgramBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint programID,
+        jintArray formatArr) {
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    jint formatValue;
+    void *binary;
+    jbyteArray result = NULL;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (formatArr == NULL)
+            || (ctxInfo->glGetProgramBinary == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)) {
+        return NULL;
+    }
+
+    ctxInfo->glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return NULL;
+    }
+    binary = malloc(length);
+    if (binary == NULL) {
+        return NULL;
+    }
+    ctxInfo->glGetProgramBinary(programID, length, &written, &format, binary);
+    if ((glGetError() == GL_NO_ERROR) && (written > 0)) {
+        result = (*env)->NewByteArray(env, written);
+        if (result != NULL) {
+            formatValue = (jint) format;
+            (*env)->SetByteArrayRegion(env, result, 0, written, (jbyte *) binary);
+            (*env)->SetIntArrayRegion(env, formatArr, 0, 1, &formatValue);
+        }
+    }
+    free(binary);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateProgramFromBinary
+ * Signature: (JI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgramFromBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint format,
+        jbyteArray binaryArr) {
+    GLuint shaderProgram;
+    GLint success = GL_FALSE;
+    jsize length;
+    void *binary;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (binaryArr == NULL)
+            || (ctxInfo->glProgramBinary == NULL)
+            || (ctxInfo->glCreateProgram == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glDeleteProgram == NULL)) {
+        return 0;
+    }
+
+    length = (*env)->GetArrayLength(env, binaryArr);
+    binary = (*env)->GetPrimitiveArrayCritical(env, binaryArr, NULL);
+    if (binary == NULL) {
+        return 0;
+    }
+    shaderProgram = ctxInfo->glCreateProgram();
+    ctxInfo->glProgramBinary(shaderProgram, (GLenum) format, binary, length);
+    (*env)->ReleasePrimitiveArrayCritical(env, binaryArr, binary, JNI_ABORT);
+
+    // A binary the driver no longer accepts, e.g. after a driver update,
+    // fails like a program that does not link
+    ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if ((glGetError() != GL_NO_ERROR) || (success == GL_FALSE)) {
+        ctxInfo->glDeleteProgram(shaderProgram);
+        return 0;
+    }
+    return shaderProgram;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCompileShader
@@ -686,7 +976,7 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateTexture
         return (jint) texID;
     }
 
-    glBindTexture(GL_TEXTURE_2D, texID);
+    bindTexture(ctxInfo, texID);
 
     // Reset Error
     glGetError();
@@ -698,6 +988,9 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateTexture
 
     if (err != GL_NO_ERROR) {
         glDeleteTextures(1, &texID);
+        if (ctxInfo->state.activeTexture < NUM_CACHED_TEXTURE_UNITS) {
+            ctxInfo->state.boundTextures[ctxInfo->state.activeTexture] = 0;
+        }
         texID = 0;
     } else {
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -804,8 +1097,19 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDeleteShader
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDeleteTexture
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID) {
     GLuint tID = (GLuint) texID;
+    int i;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if (tID != 0) {
         glDeleteTextures(1, &tID);
+        // Deleting a bound texture binds 0 in its place, and the name
+        // may be handed out again
+        if (ctxInfo != NULL) {
+            for (i = 0; i < NUM_CACHED_TEXTURE_UNITS; i++) {
+                if (ctxInfo->state.boundTextures[i] == tID) {
+                    ctxInfo->state.boundTextures[i] = 0;
+                }
+            }
+        }
     }
 }
 
@@ -822,13 +1126,17 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nFinish
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nGenAndBindTexture
- * Signature: ()I
+ * Signature: (J)I
  */
 JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nGenAndBindTexture
-(JNIEnv *env, jclass class) {
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
     GLuint texID;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if (ctxInfo == NULL) {
+        return 0;
+    }
     glGenTextures(1, &texID);
-    glBindTexture(GL_TEXTURE_2D, texID);
+    bindTexture(ctxInfo, texID);
     return texID;
 }
 
@@ -1092,16 +1400,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nScissorTest
         return;
     }
 
-    if (enable) {
-        if (!ctxInfo->state.scissorEnabled) {
-            glEnable(GL_SCISSOR_TEST);
-            ctxInfo->state.scissorEnabled = JNI_TRUE;
-        }
-        glScissor(x, y, w, h);
-    } else if (ctxInfo->state.scissorEnabled) {
-        glDisable(GL_SCISSOR_TEST);
-        ctxInfo->state.scissorEnabled = JNI_FALSE;
-    }
+    scissorTest(ctxInfo, enable, x, y, w, h);
 }
 
 /*
@@ -1195,52 +1494,368 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexImage2D1
     return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
 }
 
+/*
+ * Vertices of 2D quads and texture pixels are streamed through ring
+ * buffer objects when the context supports glMapBufferRange and fence
+ * syncs. The data is copied straight into an unsynchronized mapping of
+ * the next free range of the ring, so neither Java arrays have to stay
+ * pinned nor does the driver have to copy client memory when the command
+ * is issued. A ring is split in STREAM_RING_SEGMENTS segments; a fence is
+ * inserted after the last command reading from a segment and waited for
+ * before the segment is written again, which normally has long completed
+ * by then.
+ *
+ * Data that does not fit in a segment, and contexts without the needed
+ * functionality, use client memory as before.
+ */
+#define STREAM_RING_UNKNOWN  0
+#define STREAM_RING_ENABLED  1
+#define STREAM_RING_DISABLED 2
+
+/* 1 second, in nanoseconds */
+#define STREAM_RING_FENCE_TIMEOUT 1000000000
+
+static jboolean isStreamRingSupported(ContextInfo *ctxInfo) {
+    int major = ctxInfo->versionNumbers[0];
+    int minor = ctxInfo->versionNumbers[1];
+    jboolean mapBufferRange, sync;
+
+    if ((ctxInfo->glMapBufferRange == NULL) || (ctxInfo->glUnmapBuffer == NULL) ||
+            (ctxInfo->glFenceSync == NULL) || (ctxInfo->glClientWaitSync == NULL) ||
+            (ctxInfo->glDeleteSync == NULL) || (ctxInfo->glGenBuffers == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) || (ctxInfo->glBufferData == NULL)) {
+        return JNI_FALSE;
+    }
+
+    if ((ctxInfo->versionStr != NULL) &&
+            (sscanf(ctxInfo->versionStr, "OpenGL ES %d.%d", &major, &minor) == 2)) {
+        // Both are core in OpenGL ES 3.0
+        return major >= 3 ? JNI_TRUE : JNI_FALSE;
+    }
+
+    mapBufferRange = (major >= 3) ||
+            isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_map_buffer_range");
+    sync = (major > 3) || ((major == 3) && (minor >= 2)) ||
+            isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_sync");
+    return (mapBufferRange && sync) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Creates the buffer object of the ring, bound to target. Leaves the
+ * ring disabled if that fails.
+ */
+static void initStreamRing(ContextInfo *ctxInfo, StreamRing *ring,
+        GLenum target, GLenum usage, GLsizeiptr size) {
+    ring->status = STREAM_RING_DISABLED;
+    ctxInfo->glGenBuffers(1, &ring->buffer);
+    if (ring->buffer == 0) {
+        return;
+    }
+    ctxInfo->glBindBuffer(target, ring->buffer);
+    ctxInfo->glBufferData(target, size, NULL, usage);
+    ctxInfo->glBindBuffer(target, 0);
+
+    ring->size = size;
+    ring->offset = 0;
+    ring->segment = 0;
+    ring->status = STREAM_RING_ENABLED;
+}
+
+static void waitForStreamRingFence(ContextInfo *ctxInfo, GLsync *fence) {
+    GLenum result;
+
+    if (*fence == NULL) {
+        return;
+    }
+    do {
+        result = ctxInfo->glClientWaitSync(*fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                STREAM_RING_FENCE_TIMEOUT);
+    } while (result == GL_TIMEOUT_EXPIRED);
+    ctxInfo->glDeleteSync(*fence);
+    *fence = NULL;
+}
+
+static void deleteStreamRingFences(ContextInfo *ctxInfo, StreamRing *ring) {
+    int i;
+
+    for (i = 0; i < STREAM_RING_SEGMENTS; i++) {
+        if (ring->fences[i] != NULL) {
+            ctxInfo->glDeleteSync(ring->fences[i]);
+            ring->fences[i] = NULL;
+        }
+    }
+}
+
+/*
+ * Returns the offset of size bytes of the ring which the GPU no longer
+ * reads from. size must not exceed the size of a segment.
+ */
+static GLintptr reserveStreamRing(ContextInfo *ctxInfo, StreamRing *ring,
+        GLsizeiptr size) {
+    GLsizeiptr segmentSize = ring->size / STREAM_RING_SEGMENTS;
+    GLintptr offset = ring->offset;
+    int last;
+
+    // Data never straddles two segments, so that the fence of a segment
+    // comes after every command that reads from it
+    if ((offset % segmentSize) + size > segmentSize) {
+        offset = (offset / segmentSize + 1) * segmentSize;
+    }
+    if (offset + size > ring->size) {
+        offset = 0;
+    }
+    last = (int) (offset / segmentSize);
+    while (ring->segment != last) {
+        // Fence the commands reading the segment we leave, then make sure
+        // the GPU is done with the one we enter
+        ring->fences[ring->segment] =
+                ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        ring->segment = (ring->segment + 1) % STREAM_RING_SEGMENTS;
+        waitForStreamRingFence(ctxInfo, &ring->fences[ring->segment]);
+    }
+    ring->offset = offset + size;
+    return offset;
+}
+
+/*
+ * Texture uploads are streamed through the pixel ring. It starts out with
+ * PIXEL_RING_SIZE bytes and grows, up to PIXEL_RING_MAX_SIZE, until a
+ * segment holds the largest upload seen so far, typically a video frame.
+ */
+#define PIXEL_RING_SIZE (4 * 1024 * 1024)
+#define PIXEL_RING_MAX_SIZE (64 * 1024 * 1024)
+
+/* Uploads start at multiples of this many bytes */
+#define PIXEL_RING_ALIGNMENT 16
+
+static jboolean isPixelRingSupported(ContextInfo *ctxInfo) {
+    int major = ctxInfo->versionNumbers[0];
+    int minor = ctxInfo->versionNumbers[1];
+
+    if (!isStreamRingSupported(ctxInfo)) {
+        return JNI_FALSE;
+    }
+    if ((ctxInfo->versionStr != NULL) &&
+            (strstr(ctxInfo->versionStr, "OpenGL ES") != NULL)) {
+        // Pixel buffer objects are core in OpenGL ES 3.0
+        return JNI_TRUE;
+    }
+    return (major > 2) || ((major == 2) && (minor >= 1)) ||
+            isExtensionSupported(ctxInfo->glExtensionStr, "GL_ARB_pixel_buffer_object");
+}
+
+static void initPixelRing(ContextInfo *ctxInfo) {
+    if (!isPixelRingSupported(ctxInfo)) {
+        ctxInfo->pixelRing.status = STREAM_RING_DISABLED;
+        return;
+    }
+    initStreamRing(ctxInfo, &ctxInfo->pixelRing, GL_PIXEL_UNPACK_BUFFER,
+            GL_STREAM_DRAW, PIXEL_RING_SIZE);
+}
+
+/*
+ * Grows the pixel ring so that a segment holds at least size bytes.
+ * Returns JNI_FALSE if that would exceed PIXEL_RING_MAX_SIZE.
+ */
+static jboolean growPixelRing(ContextInfo *ctxInfo, GLsizeiptr size) {
+    StreamRing *ring = &ctxInfo->pixelRing;
+    GLsizeiptr newSize = ring->size;
+
+    while (newSize / STREAM_RING_SEGMENTS < size) {
+        newSize *= 2;
+    }
+    if (newSize > PIXEL_RING_MAX_SIZE) {
+        return JNI_FALSE;
+    }
+
+    // Respecifying the data store orphans the old one, which the GPU keeps
+    // for the uploads still reading from it
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->buffer);
+    ctxInfo->glBufferData(GL_PIXEL_UNPACK_BUFFER, newSize, NULL, GL_STREAM_DRAW);
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    deleteStreamRingFences(ctxInfo, ring);
+
+    ring->size = newSize;
+    ring->offset = 0;
+    ring->segment = 0;
+    return JNI_TRUE;
+}
+
+/*
+ * Returns the number of bytes glTexSubImage2D reads for the given image
+ * with the given GL_UNPACK_ROW_LENGTH and GL_UNPACK_ALIGNMENT, or 0 if the
+ * format is unknown.
+ */
+static GLsizeiptr getTexSubImage2DSize(jint format, jint type,
+        jint width, jint height, jint rowLength, jint alignment) {
+    GLsizeiptr pixelSize, rowSize;
+    int components;
+
+    if ((width <= 0) || (height <= 0)) {
+        return 0;
+    }
+    switch (format) {
+        case com_sun_prism_es2_GLContext_GL_RGBA:
+        case com_sun_prism_es2_GLContext_GL_BGRA:
+            components = 4;
+            break;
+        case com_sun_prism_es2_GLContext_GL_RGB:
+            components = 3;
+            break;
+        case com_sun_prism_es2_GLContext_GL_LUMINANCE:
+        case com_sun_prism_es2_GLContext_GL_ALPHA:
+            components = 1;
+            break;
+        case com_sun_prism_es2_GLContext_GL_YCBCR_422_APPLE:
+            components = 2;
+            break;
+        default:
+            return 0;
+    }
+    switch (type) {
+        case com_sun_prism_es2_GLContext_GL_UNSIGNED_BYTE:
+            pixelSize = components;
+            break;
+        case com_sun_prism_es2_GLContext_GL_FLOAT:
+            pixelSize = components * sizeof(GLfloat);
+            break;
+        case com_sun_prism_es2_GLContext_GL_UNSIGNED_INT_8_8_8_8_REV:
+        case com_sun_prism_es2_GLContext_GL_UNSIGNED_INT_8_8_8_8:
+            pixelSize = 4;
+            break;
+        case com_sun_prism_es2_GLContext_GL_UNSIGNED_SHORT_8_8_APPLE:
+            pixelSize = 2;
+            break;
+        default:
+            return 0;
+    }
+
+    rowSize = (rowLength > 0 ? rowLength : width) * pixelSize;
+    if (alignment > 1) {
+        rowSize = (rowSize + alignment - 1) / alignment * alignment;
+    }
+    return rowSize * (height - 1) + width * pixelSize;
+}
+
+/*
+ * Uploads the pixels through the pixel ring. Returns JNI_FALSE if the
+ * caller has to upload them from client memory instead.
+ */
+static jboolean texSubImage2DFromPixelRing(ContextInfo *ctxInfo,
+        GLenum target, GLint level, GLint xoffset, GLint yoffset,
+        GLsizei width, GLsizei height, GLenum format, GLenum type,
+        const char *pixels, GLsizeiptr size) {
+    StreamRing *ring = &ctxInfo->pixelRing;
+    GLsizeiptr reserved = (size + PIXEL_RING_ALIGNMENT - 1)
+            & ~((GLsizeiptr) PIXEL_RING_ALIGNMENT - 1);
+    GLintptr offset;
+    char *p;
+
+    if (ring->status == STREAM_RING_UNKNOWN) {
+        initPixelRing(ctxInfo);
+    }
+    if ((ring->status != STREAM_RING_ENABLED) || (pixels == NULL) || (size == 0)) {
+        return JNI_FALSE;
+    }
+    if ((reserved > ring->size / STREAM_RING_SEGMENTS) &&
+            !growPixelRing(ctxInfo, reserved)) {
+        return JNI_FALSE;
+    }
+
+    offset = reserveStreamRing(ctxInfo, ring, reserved);
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->buffer);
+    p = (char *) ctxInfo->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (p == NULL) {
+        ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return JNI_FALSE;
+    }
+    memcpy(p, pixels, size);
+    if (!ctxInfo->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER)) {
+        // The contents of the buffer were lost
+        ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return JNI_FALSE;
+    }
+
+    // With a pixel unpack buffer bound the pointer is an offset into it
+    glTexSubImage2D(target, level, xoffset, yoffset, width, height,
+            format, type, (GLvoid *) offset);
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return JNI_TRUE;
+}
+
+/*
+ * Uploads the pixels, through the pixel ring if possible. Returns the
+ * number of bytes read from pixels.
+ */
+static jint texSubImage2D(ContextInfo *ctxInfo, jint target, jint level,
+        jint xoffset, jint yoffset, jint width, jint height, jint format,
+        jint type, const char *pixels, jint rowLength, jint alignment) {
+    GLsizeiptr size = getTexSubImage2DSize(format, type, width, height,
+            rowLength, alignment);
+    GLenum glTarget = (GLenum) translatePrismToGL(target);
+    GLenum glFormat = (GLenum) translatePrismToGL(format);
+    GLenum glType = (GLenum) translatePrismToGL(type);
+
+    if ((ctxInfo == NULL) || !texSubImage2DFromPixelRing(ctxInfo, glTarget,
+            (GLint) level, (GLint) xoffset, (GLint) yoffset,
+            (GLsizei) width, (GLsizei) height, glFormat, glType, pixels, size)) {
+        glTexSubImage2D(glTarget, (GLint) level,
+                (GLint) xoffset, (GLint) yoffset,
+                (GLsizei) width, (GLsizei) height, glFormat, glType,
+                (GLvoid *) pixels);
+    }
+    return pixels != NULL ? (jint) size : 0;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexSubImage2D0
- * Signature: (IIIIIIIILjava/lang/Object;I)V
+ * Signature: (JIIIIIIIILjava/lang/Object;III)I
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D0
-(JNIEnv *env, jclass class, jint target, jint level,
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D0
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint target, jint level,
         jint xoffset, jint yoffset, jint width, jint height, jint format,
-        jint type, jobject pixels, jint pixelsByteOffset) {
-    GLvoid *ptr = NULL;
+        jint type, jobject pixels, jint pixelsByteOffset,
+        jint rowLength, jint alignment) {
+    char *ptr = NULL;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if (pixels != NULL) {
-        ptr = (GLvoid *) (((char *) (*env)->GetDirectBufferAddress(env, pixels))
-                + pixelsByteOffset);
+        ptr = ((char *) (*env)->GetDirectBufferAddress(env, pixels))
+                + pixelsByteOffset;
     }
-    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
-            (GLint) xoffset, (GLint) yoffset,
-            (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
-            (GLenum) translatePrismToGL(type), (GLvoid *) ptr);
+    return texSubImage2D(ctxInfo, target, level, xoffset, yoffset,
+            width, height, format, type, ptr, rowLength, alignment);
 }
 
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexSubImage2D1
- * Signature: (IIIIIIIILjava/lang/Object;I)V
+ * Signature: (JIIIIIIIILjava/lang/Object;III)I
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
-(JNIEnv *env, jclass class, jint target, jint level,
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint target, jint level,
         jint xoffset, jint yoffset, jint width, jint height, jint format,
-        jint type, jobject pixels, jint pixelsByteOffset) {
+        jint type, jobject pixels, jint pixelsByteOffset,
+        jint rowLength, jint alignment) {
     char *ptr = NULL;
     char *ptrPlusOffset = NULL;
+    jint size;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
     if (pixels != NULL) {
         ptr = (char *) (*env)->GetPrimitiveArrayCritical(env, pixels, NULL);
         if (ptr == NULL) {
             fprintf(stderr, "nTexSubImage2D1: GetPrimitiveArrayCritical returns NULL: out of memory\n");
-            return;
+            return 0;
         }
         ptrPlusOffset = ptr + pixelsByteOffset;
     }
-    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
-            (GLint) xoffset, (GLint) yoffset,
-            (GLsizei) width, (GLsizei) height, (GLenum) translatePrismToGL(format),
-            (GLenum) translatePrismToGL(type), (GLvoid *) ptrPlusOffset);
+    size = texSubImage2D(ctxInfo, target, level, xoffset, yoffset,
+            width, height, format, type, ptrPlusOffset, rowLength, alignment);
     if (pixels != NULL) {
-        (*env)->ReleasePrimitiveArrayCritical(env, pixels, ptr, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, pixels, ptr, JNI_ABORT);
     }
+    return size;
 }
 
 /*
@@ -1581,10 +2196,10 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateWrapState
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUseProgram
 (JNIEnv *env, jclass class, jlong nativeCtxInfo, jint pID) {
     ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    if ((ctxInfo == NULL) || (ctxInfo->glUseProgram == NULL)) {
+    if (ctxInfo == NULL) {
         return;
     }
-    ctxInfo->glUseProgram(pID);
+    useProgram(ctxInfo, (GLuint) pID);
 }
 
 /*
@@ -1650,6 +2265,81 @@ static void setVertexAttributePointers(ContextInfo *ctx, float *pFloat, char *pB
         ctx->vbByteData = pByte;
     }
 }
+#define VERTEX_RING_SIZE (4 * 1024 * 1024)
+
+static void initVertexRing(ContextInfo *ctxInfo) {
+    if (!isStreamRingSupported(ctxInfo)) {
+        ctxInfo->vertexRing.status = STREAM_RING_DISABLED;
+        return;
+    }
+    initStreamRing(ctxInfo, &ctxInfo->vertexRing, GL_ARRAY_BUFFER,
+            GL_STREAM_DRAW, VERTEX_RING_SIZE);
+}
+
+/*
+ * Draws the quads from the vertex ring. Returns JNI_FALSE if the caller
+ * has to draw them from the client side arrays instead.
+ */
+static jboolean drawQuadsFromVertexRing(JNIEnv *env, ContextInfo *ctxInfo,
+        jint numVertices, jfloatArray dataf, jbyteArray datab) {
+    StreamRing *ring = &ctxInfo->vertexRing;
+    GLsizeiptr floatBytes = (GLsizeiptr) numVertices * coordStride;
+    GLsizeiptr byteBytes = (GLsizeiptr) numVertices * colorStride;
+    GLintptr offset;
+    char *p;
+    jboolean unmapped;
+
+    if (ring->status == STREAM_RING_UNKNOWN) {
+        initVertexRing(ctxInfo);
+    }
+    if ((ring->status != STREAM_RING_ENABLED) ||
+            (floatBytes + byteBytes > ring->size / STREAM_RING_SEGMENTS)) {
+        return JNI_FALSE;
+    }
+
+    offset = reserveStreamRing(ctxInfo, ring, floatBytes + byteBytes);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+    p = (char *) ctxInfo->glMapBufferRange(GL_ARRAY_BUFFER, offset,
+            floatBytes + byteBytes, GL_MAP_WRITE_BIT |
+            GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (p == NULL) {
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return JNI_FALSE;
+    }
+    (*env)->GetFloatArrayRegion(env, dataf, 0, numVertices * FLOATS_PER_VERT,
+            (jfloat *) p);
+    (*env)->GetByteArrayRegion(env, datab, 0, numVertices * colorStride,
+            (jbyte *) (p + floatBytes));
+    unmapped = ctxInfo->glUnmapBuffer(GL_ARRAY_BUFFER) ? JNI_TRUE : JNI_FALSE;
+    if ((*env)->ExceptionCheck(env)) {
+        // Nothing to draw
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return JNI_TRUE;
+    }
+    if (!unmapped) {
+        // The contents of the buffer were lost
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return JNI_FALSE;
+    }
+
+    // The attribute pointers are offsets into the ring, they keep
+    // referring to it after it is unbound
+    ctxInfo->glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, coordStride,
+            (GLvoid *) offset);
+    ctxInfo->glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, coordStride,
+            (GLvoid *) (offset + FLOATS_PER_VC * sizeof(float)));
+    ctxInfo->glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, coordStride,
+            (GLvoid *) (offset + (FLOATS_PER_VC + FLOATS_PER_TC) * sizeof(float)));
+    ctxInfo->glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, colorStride,
+            (GLvoid *) (offset + floatBytes));
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+    ctxInfo->vbFloatData = NULL;
+    ctxInfo->vbByteData = NULL;
+
+    glDrawElements(GL_TRIANGLES, (numVertices / 4) * 2 * 3, GL_UNSIGNED_SHORT, 0);
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nDrawIndexedQuads
@@ -1668,6 +2358,10 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuads
         return;
     }
 
+    if (drawQuadsFromVertexRing(env, ctxInfo, numVertices, dataf, datab)) {
+        return;
+    }
+
     pFloat = (float *)(*env)->GetPrimitiveArrayCritical(env, dataf, NULL);
     pByte = (char *)(*env)->GetPrimitiveArrayCritical(env, datab, NULL);
 
@@ -1745,7 +2439,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor2
     ctxInfo->vbByteData = NULL;
 
     glEnable(GL_BLEND);
-    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    blendFunc(ctxInfo, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
     if (ctxInfo->state.scissorEnabled) {
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -1779,7 +2473,7 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetDeviceParametersFor3
     // This setting matches 2D ((1,1-alpha); premultiplied alpha case.
     // Will need to evaluate when support proper 3D blending (alpha,1-alpha).
     glEnable(GL_BLEND);
-    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    blendFunc(ctxInfo, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
     if (ctxInfo->state.scissorEnabled) {
         ctxInfo->state.scissorEnabled = JNI_FALSE;
@@ -2313,34 +3007,29 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nSetLight
 }
 
 /*
- * Class:     com_sun_prism_es2_GLContext
- * Method:    nRenderMeshView
- * Signature: (JJ)V
+ * Binds the buffers of the mesh of the given MeshView and sets up its
+ * vertex attributes. Returns JNI_FALSE if there is nothing to draw.
  */
-JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
-  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo)
-{
+static jboolean setupMeshView(ContextInfo *ctxInfo, MeshViewInfo *mvInfo) {
     GLuint offset = 0;
     MeshInfo *mInfo;
-    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
-    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
+
     if ((ctxInfo == NULL) || (mvInfo == NULL) ||
             (ctxInfo->glBindBuffer == NULL) ||
             (ctxInfo->glBufferData == NULL) ||
             (ctxInfo->glDisableVertexAttribArray == NULL) ||
             (ctxInfo->glEnableVertexAttribArray == NULL) ||
             (ctxInfo->glVertexAttribPointer == NULL)) {
-        return;
+        return JNI_FALSE;
     }
 
     if ((mvInfo->phongMaterialInfo == NULL) || (mvInfo->meshInfo == NULL)) {
-        return;
+        return JNI_FALSE;
     }
 
     setCullMode(ctxInfo, mvInfo);
     setPolyonMode(ctxInfo, mvInfo);
 
-    // Draw triangles ...
     mInfo = mvInfo->meshInfo;
     ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, mInfo->vboIDArray[MESH_VERTEXBUFFER]);
     ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mInfo->vboIDArray[MESH_INDEXBUFFER]);
@@ -2357,11 +3046,10 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
     offset += TC_3D_SIZE * sizeof(GLfloat);
     ctxInfo->glVertexAttribPointer(NC_3D_INDEX, NC_3D_SIZE, GL_FLOAT, GL_FALSE,
             VERT_3D_STRIDE, (const GLvoid *) jlong_to_ptr((jlong) offset));
+    return JNI_TRUE;
+}
 
-    glDrawElements(GL_TRIANGLES, mvInfo->meshInfo->indexBufferSize,
-            mvInfo->meshInfo->indexBufferType, 0);
-
-    // Reset states
+static void resetMeshView(ContextInfo *ctxInfo) {
     ctxInfo->glDisableVertexAttribArray(VC_3D_INDEX);
     ctxInfo->glDisableVertexAttribArray(NC_3D_INDEX);
     ctxInfo->glDisableVertexAttribArray(TC_3D_INDEX);
@@ -2369,3 +3057,149 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
     ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nRenderMeshView
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshView
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo)
+{
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
+    if (!setupMeshView(ctxInfo, mvInfo)) {
+        return;
+    }
+
+    // Draw triangles ...
+    glDrawElements(GL_TRIANGLES, mvInfo->meshInfo->indexBufferSize,
+            mvInfo->meshInfo->indexBufferType, 0);
+
+    // Reset states
+    resetMeshView(ctxInfo);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsInstancingSupported
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsInstancingSupported
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo)
+{
+    int major, minor;
+    GLint maxAttribs = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glDrawElementsInstanced == NULL) ||
+            (ctxInfo->glVertexAttribDivisor == NULL)) {
+        return JNI_FALSE;
+    }
+
+    glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxAttribs);
+    if (maxAttribs < INSTANCE_3D_INDEX + INSTANCE_3D_ATTRIBS) {
+        return JNI_FALSE;
+    }
+
+    major = ctxInfo->versionNumbers[0];
+    minor = ctxInfo->versionNumbers[1];
+    if ((ctxInfo->versionStr != NULL) &&
+            (sscanf(ctxInfo->versionStr, "OpenGL ES %d.%d", &major, &minor) == 2)) {
+        // Core in OpenGL ES 3.0, the entry points of the extension are
+        // loaded in their place on OpenGL ES 2.0
+        return (major >= 3) ||
+                isExtensionSupported(ctxInfo->glExtensionStr, "GL_EXT_instanced_arrays")
+                ? JNI_TRUE : JNI_FALSE;
+    }
+    // Both entry points are core in OpenGL 3.3
+    return (major > 3) || ((major == 3) && (minor >= 3)) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nRenderMeshViewInstanced
+ * Signature: (JJ[FI)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nRenderMeshViewInstanced
+  (JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshViewInfo,
+   jfloatArray instanceData, jint numInstances)
+{
+    StreamRing *ring;
+    GLsizeiptr size = (GLsizeiptr) numInstances * INSTANCE_3D_STRIDE;
+    GLintptr offset = 0;
+    char *base = NULL;
+    jfloat *pData = NULL;
+    int i;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshViewInfo *mvInfo = (MeshViewInfo *) jlong_to_ptr(nativeMeshViewInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glDrawElementsInstanced == NULL) ||
+            (ctxInfo->glVertexAttribDivisor == NULL) || (numInstances <= 0) ||
+            ((*env)->GetArrayLength(env, instanceData) < numInstances * INSTANCE_3D_SIZE)) {
+        return;
+    }
+    if (!setupMeshView(ctxInfo, mvInfo)) {
+        return;
+    }
+
+    // The instance data goes through the vertex ring where available,
+    // otherwise it is read from the Java array during the draw call
+    ring = &ctxInfo->vertexRing;
+    if (ring->status == STREAM_RING_UNKNOWN) {
+        initVertexRing(ctxInfo);
+    }
+    if ((ring->status == STREAM_RING_ENABLED) &&
+            (size <= ring->size / STREAM_RING_SEGMENTS)) {
+        void *p;
+        offset = reserveStreamRing(ctxInfo, ring, size);
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+        p = ctxInfo->glMapBufferRange(GL_ARRAY_BUFFER, offset, size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                GL_MAP_UNSYNCHRONIZED_BIT);
+        if (p != NULL) {
+            (*env)->GetFloatArrayRegion(env, instanceData, 0,
+                    numInstances * INSTANCE_3D_SIZE, (jfloat *) p);
+            if (!ctxInfo->glUnmapBuffer(GL_ARRAY_BUFFER) ||
+                    (*env)->ExceptionCheck(env)) {
+                p = NULL;
+            }
+        }
+        if (p == NULL) {
+            ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+            resetMeshView(ctxInfo);
+            return;
+        }
+    } else {
+        ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        pData = (jfloat *) (*env)->GetPrimitiveArrayCritical(env, instanceData, NULL);
+        if (pData == NULL) {
+            resetMeshView(ctxInfo);
+            return;
+        }
+        base = (char *) pData;
+    }
+
+    for (i = 0; i < INSTANCE_3D_ATTRIBS; i++) {
+        ctxInfo->glEnableVertexAttribArray(INSTANCE_3D_INDEX + i);
+        ctxInfo->glVertexAttribPointer(INSTANCE_3D_INDEX + i, 4, GL_FLOAT, GL_FALSE,
+                INSTANCE_3D_STRIDE, base + offset + i * 4 * sizeof(GLfloat));
+        ctxInfo->glVertexAttribDivisor(INSTANCE_3D_INDEX + i, 1);
+    }
+
+    ctxInfo->glDrawElementsInstanced(GL_TRIANGLES,
+            mvInfo->meshInfo->indexBufferSize,
+            mvInfo->meshInfo->indexBufferType, 0, numInstances);
+
+    if (pData != NULL) {
+        (*env)->ReleasePrimitiveArrayCritical(env, instanceData, pData, JNI_ABORT);
+    }
+
+    // Reset states, the 2D pipeline uses some of these attributes without
+    // a divisor
+    for (i = 0; i < INSTANCE_3D_ATTRIBS; i++) {
+        ctxInfo->glVertexAttribDivisor(INSTANCE_3D_INDEX + i, 0);
+        ctxInfo->glDisableVertexAttribArray(INSTANCE_3D_INDEX + i);
+    }
+    ctxInfo->vbFloatData = NULL;
+    ctxInfo->vbByteData = NULL;
+    resetMeshView(ctxInfo);
+}
+
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -194,6 +194,9 @@ struct DrawableInfoRec {
 #endif /* __APPLE__ */
 };
 
+/* Number of texture units whose bound texture is cached in StateInfo */
+#define NUM_CACHED_TEXTURE_UNITS 8
+
 /* Typedef for state properties struct */
 typedef struct StateInfoRec StateInfo;
 
@@ -212,6 +215,41 @@ struct StateInfoRec {
 
     /* Currently bound fbo */
     GLuint fbo;
+
+    /* Texture, program and blend state, cached to skip redundant calls */
+    GLuint activeTexture;
+    GLuint boundTextures[NUM_CACHED_TEXTURE_UNITS];
+    GLuint program;
+    GLenum blendSrc;
+    GLenum blendDst;
+    /* width is -1 while the scissor box is unknown */
+    GLint scissorBox[4];
+
+    /* Calls not made because they would not have changed the state */
+    jint skippedCalls;
+};
+
+/* Number of parts of a stream ring, each guarded by its own fence */
+#define STREAM_RING_SEGMENTS 4
+
+/* Typedef for streaming buffer struct */
+typedef struct StreamRingRec StreamRing;
+
+/*
+ * define the structure to hold a buffer object data is streamed through,
+ * the vertices of 2D quads (see nDrawIndexedQuads) or texture pixels
+ * (see nTexSubImage2D0)
+ */
+struct StreamRingRec {
+    /* STREAM_RING_UNKNOWN until first used */
+    jint status;
+    GLuint buffer;
+    GLsizeiptr size;
+    /* next free byte and the segment it is in */
+    GLsizeiptr offset;
+    int segment;
+    /* signaled once the GPU is done with the commands reading a segment */
+    GLsync fences[STREAM_RING_SEGMENTS];
 };
 
 /* Typedef for context properties struct */
@@ -317,10 +355,26 @@ struct ContextInfoRec {
     PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
     PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+    PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
+    PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
+    PFNGLDRAWELEMENTSINSTANCEDPROC glDrawElementsInstanced;
+    PFNGLVERTEXATTRIBDIVISORPROC glVertexAttribDivisor;
 
     /* For state caching */
     StateInfo state;
 
+    /* Streaming vertex buffer for 2D quads */
+    StreamRing vertexRing;
+
+    /* Streaming pixel unpack buffer for texture uploads */
+    StreamRing pixelRing;
+
     /* this pointers represent cached values of glVertexAttribPointer values */
     /* they should be properly updated in case of glVertexAttribPointer call */
     /* see setVertexAttributePointers */
@@ -352,6 +406,16 @@ extern void deletePixelFormatInfo(PixelFormatInfo *pfInfo);
 #define VERT_3D_SIZE (VC_3D_SIZE + TC_3D_SIZE + NC_3D_SIZE)
 #define VERT_3D_STRIDE (sizeof(GLfloat) * VERT_3D_SIZE)
 
+/*
+ * Per instance attributes of instanced MeshView draws, see
+ * nRenderMeshViewInstanced: the first three rows of the world matrix
+ * followed by the diffuse color, one vec4 attribute each
+ */
+#define INSTANCE_3D_INDEX 3
+#define INSTANCE_3D_ATTRIBS 4
+#define INSTANCE_3D_SIZE (4 * INSTANCE_3D_ATTRIBS)
+#define INSTANCE_3D_STRIDE (sizeof(GLfloat) * INSTANCE_3D_SIZE)
+
 #define MESH_VERTEXBUFFER 0
 #define MESH_INDEXBUFFER 1
 #define MESH_MAX_BUFFERS 2
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+// diffuse texture fragment shader, instanced draws
+
+#ifdef GL_ES
+
+#ifndef EXTENSION_APPLIED
+#define EXTENSION_APPLIED
+#extension GL_OES_standard_derivatives : enable
+#endif
+
+// Define default float precision for fragment shaders
+#ifdef GL_FRAGMENT_PRECISION_HIGH
+precision highp float;
+precision highp int;
+#else
+precision mediump float;
+precision mediump int;
+#endif
+
+#else
+
+// Ignore GL_ES precision specifiers:
+#define lowp
+#define mediump
+#define highp
+
+#endif
+
+uniform sampler2D diffuseTexture;
+
+varying vec2 oTexCoords;
+// per instance diffuse color, see main_instanced.vert
+varying vec4 oDiffuseColor;
+
+vec4 apply_diffuse() {
+    vec4 dTexColor = texture2D(diffuseTexture, oTexCoords);
+    return dTexColor * oDiffuseColor;
+}
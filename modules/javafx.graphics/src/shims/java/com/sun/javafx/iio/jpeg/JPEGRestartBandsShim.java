@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.jpeg;
+
+import java.io.IOException;
+import java.io.InputStream;
+
+public class JPEGRestartBandsShim {
+
+    public static final class Band {
+        public final int firstLine;
+        public final int lines;
+        public final byte[] stream;
+
+        private Band(JPEGRestartBands.Band band) {
+            this.firstLine = band.firstLine;
+            this.lines = band.lines;
+            this.stream = band.stream;
+        }
+    }
+
+    public static boolean isSplittable(byte[] data) {
+        return JPEGRestartBands.parseHeader(data, data.length) != null;
+    }
+
+    public static Band[] split(byte[] data, int maxBands) {
+        JPEGRestartBands restartBands = JPEGRestartBands.parseHeader(data, data.length);
+        if (restartBands == null) {
+            return null;
+        }
+        JPEGRestartBands.Band[] bands = restartBands.split(data, data.length, maxBands);
+        if (bands == null) {
+            return null;
+        }
+        Band[] result = new Band[bands.length];
+        for (int i = 0; i < bands.length; i++) {
+            result[i] = new Band(bands[i]);
+        }
+        return result;
+    }
+
+    public static InputStream newRecordingInputStream(InputStream in) {
+        return new JPEGRestartBands.RecordingInputStream(in);
+    }
+
+    public static boolean readRemaining(InputStream recorder, int limit) throws IOException {
+        return ((JPEGRestartBands.RecordingInputStream) recorder).readRemaining(limit);
+    }
+
+    public static int getRecordedCount(InputStream recorder) {
+        return ((JPEGRestartBands.RecordingInputStream) recorder).getCount();
+    }
+
+    public static InputStream getSource(InputStream recorder) {
+        return ((JPEGRestartBands.RecordingInputStream) recorder).getSource();
+    }
+
+}
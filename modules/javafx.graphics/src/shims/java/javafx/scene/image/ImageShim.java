@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,4 +68,8 @@ public class ImageShim extends Image {
         image.setProgress(value);
     }
 
+    public static void setLoadPriority(Image image, int priority) {
+        image.setLoadPriority(priority);
+    }
+
 }
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio.common;
+
+import com.sun.javafx.iio.common.ImageDecodeScheduler;
+import com.sun.javafx.iio.common.ImageDecodeScheduler.Job;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.Semaphore;
+import java.util.concurrent.TimeUnit;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertSame;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class ImageDecodeSchedulerTest {
+
+    private final ImageDecodeScheduler scheduler = ImageDecodeScheduler.getInstance();
+
+    // Names of the jobs in the order they started
+    private final List<String> started = Collections.synchronizedList(new ArrayList<>());
+    private final Semaphore startSignal = new Semaphore(0);
+    // Jobs wait here until the test lets them finish
+    private final Semaphore gate = new Semaphore(0);
+
+    @AfterEach
+    public void releaseJobs() {
+        gate.release(10000);
+    }
+
+    private Callable<String> task(String name) {
+        return () -> {
+            started.add(name);
+            startSignal.release();
+            gate.acquire();
+            return name;
+        };
+    }
+
+    /*
+     * Submits a job for every thread of the pool and waits until they all
+     * run, so that everything submitted afterwards is queued.
+     */
+    private void occupyAllThreads() throws InterruptedException {
+        int n = scheduler.getParallelism();
+        for (int i = 0; i < n; i++) {
+            scheduler.submit(task("blocker"), Integer.MAX_VALUE);
+        }
+        assertTrue(startSignal.tryAcquire(n, 10, TimeUnit.SECONDS), "Timeout waiting for the pool");
+        started.clear();
+    }
+
+    /*
+     * Lets one running job finish and waits for the job that takes its
+     * thread to start.
+     */
+    private void runNext() throws InterruptedException {
+        gate.release();
+        assertTrue(startSignal.tryAcquire(10, TimeUnit.SECONDS), "Timeout waiting for a job to start");
+    }
+
+    @Test
+    public void testHigherPriorityRunsFirst() throws Exception {
+        occupyAllThreads();
+        Job<String> a = scheduler.submit(task("a"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        Job<String> b = scheduler.submit(task("b"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        Job<String> c = scheduler.submit(task("c"), ImageDecodeScheduler.PRIORITY_VISIBLE);
+        for (int i = 0; i < 3; i++) {
+            runNext();
+        }
+        assertEquals(List.of("c", "a", "b"), new ArrayList<>(started));
+
+        gate.release(10000);
+        assertEquals("a", a.get(10, TimeUnit.SECONDS));
+        assertEquals("b", b.get(10, TimeUnit.SECONDS));
+        assertEquals("c", c.get(10, TimeUnit.SECONDS));
+    }
+
+    @Test
+    public void testSetPriorityReordersQueuedJob() throws Exception {
+        occupyAllThreads();
+        scheduler.submit(task("a"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        scheduler.submit(task("b"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        Job<String> c = scheduler.submit(task("c"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        c.setPriority(ImageDecodeScheduler.PRIORITY_VISIBLE);
+        assertEquals(ImageDecodeScheduler.PRIORITY_VISIBLE, c.getPriority());
+        for (int i = 0; i < 3; i++) {
+            runNext();
+        }
+        assertEquals(List.of("c", "a", "b"), new ArrayList<>(started));
+    }
+
+    @Test
+    public void testCancelledJobNeverRuns() throws Exception {
+        occupyAllThreads();
+        Job<String> a = scheduler.submit(task("a"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        Job<String> b = scheduler.submit(task("b"), ImageDecodeScheduler.PRIORITY_NORMAL);
+        assertTrue(a.cancel(false));
+        runNext();
+
+        gate.release(10000);
+        assertEquals("b", b.get(10, TimeUnit.SECONDS));
+        assertTrue(a.isCancelled());
+        assertFalse(started.contains("a"));
+    }
+
+    @Test
+    public void testJoinRunsQueuedJobOnCallingThread() throws Exception {
+        occupyAllThreads();
+        Job<Thread> job = scheduler.submit(Thread::currentThread, ImageDecodeScheduler.PRIORITY_NORMAL);
+        assertSame(Thread.currentThread(), job.join());
+    }
+
+    @Test
+    public void testCurrentPriority() throws Exception {
+        assertEquals(ImageDecodeScheduler.PRIORITY_NORMAL, ImageDecodeScheduler.currentPriority());
+        Job<Integer> job = scheduler.submit(ImageDecodeScheduler::currentPriority, 7);
+        assertEquals(7, job.get(10, TimeUnit.SECONDS));
+    }
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio.jpeg;
+
+import com.sun.javafx.iio.jpeg.JPEGRestartBandsShim;
+import com.sun.javafx.iio.jpeg.JPEGRestartBandsShim.Band;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.Arrays;
+import org.junit.jupiter.api.Test;
+
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class JPEGRestartBandsTest {
+
+    private static final int SOF0 = 0xC0;
+    private static final int SOF2 = 0xC2;
+
+    /*
+     * Builds the markers of a 3 component image with 2x2 subsampled
+     * chroma, so an MCU is 16x16 pixels.
+     */
+    private static void writeHeader(ByteArrayOutputStream out, int sof,
+            int width, int height, int restartInterval) {
+        out.writeBytes(new byte[] { (byte) 0xff, (byte) 0xd8 });
+        // Frame header
+        out.writeBytes(new byte[] {
+            (byte) 0xff, (byte) sof, 0, 17, 8,
+            (byte) (height >> 8), (byte) height, (byte) (width >> 8), (byte) width,
+            3, 1, 0x22, 0, 2, 0x11, 1, 3, 0x11, 1 });
+        // A Huffman table, its content does not matter here
+        out.writeBytes(new byte[] { (byte) 0xff, (byte) 0xc4, 0, 3, 0 });
+        if (restartInterval > 0) {
+            out.writeBytes(new byte[] {
+                (byte) 0xff, (byte) 0xdd, 0, 4,
+                (byte) (restartInterval >> 8), (byte) restartInterval });
+        }
+        // Scan header
+        out.writeBytes(new byte[] {
+            (byte) 0xff, (byte) 0xda, 0, 12, 3, 1, 0, 2, 0x11, 3, 0x11, 0, 63, 0 });
+    }
+
+    /*
+     * The entropy coded data of an interval. It includes a stuffed zero
+     * byte, which must not be taken for a marker.
+     */
+    private static byte[] interval(int i) {
+        return new byte[] { (byte) (0x10 + i), (byte) 0xff, 0, (byte) (0x20 + i) };
+    }
+
+    private static byte[] createImage(int sof, int width, int height,
+            int restartInterval, int intervals, int missingMarker) {
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        writeHeader(out, sof, width, height, restartInterval);
+        for (int i = 0; i < intervals; i++) {
+            if (i > 0 && i != missingMarker) {
+                out.writeBytes(new byte[] { (byte) 0xff, (byte) (0xd0 + ((i - 1) & 7)) });
+            }
+            out.writeBytes(interval(i));
+        }
+        out.writeBytes(new byte[] { (byte) 0xff, (byte) 0xd9 });
+        return out.toByteArray();
+    }
+
+    private static byte[] createImage(int width, int height, int restartInterval) {
+        int mcus = ((width + 15) / 16) * ((height + 15) / 16);
+        return createImage(SOF0, width, height, restartInterval,
+                (mcus + restartInterval - 1) / restartInterval, -1);
+    }
+
+    @Test
+    public void testSplitIntoBands() {
+        // 4 rows of 4 MCUs, one row per interval
+        Band[] bands = JPEGRestartBandsShim.split(createImage(64, 64, 4), 2);
+        assertNotNull(bands);
+        assertEquals(2, bands.length);
+        assertEquals(0, bands[0].firstLine);
+        assertEquals(32, bands[0].lines);
+        assertEquals(32, bands[1].firstLine);
+        assertEquals(32, bands[1].lines);
+    }
+
+    @Test
+    public void testLastBandIsCutToImageHeight() {
+        Band[] bands = JPEGRestartBandsShim.split(createImage(64, 60, 4), 4);
+        assertNotNull(bands);
+        assertEquals(4, bands.length);
+        for (int i = 0; i < 3; i++) {
+            assertEquals(16 * i, bands[i].firstLine);
+            assertEquals(16, bands[i].lines);
+        }
+        assertEquals(48, bands[3].firstLine);
+        assertEquals(12, bands[3].lines);
+    }
+
+    @Test
+    public void testBandsStartOnRestartIntervals() {
+        // An interval of 6 MCUs starts a row only every 3 rows of 4 MCUs
+        Band[] bands = JPEGRestartBandsShim.split(createImage(64, 192, 6), 4);
+        assertNotNull(bands);
+        assertEquals(4, bands.length);
+        for (int i = 0; i < bands.length; i++) {
+            assertEquals(48 * i, bands[i].firstLine);
+            assertEquals(48, bands[i].lines);
+        }
+    }
+
+    @Test
+    public void testBandIsStandaloneStream() {
+        byte[] image = createImage(64, 64, 4);
+        Band[] bands = JPEGRestartBandsShim.split(image, 2);
+        assertNotNull(bands);
+
+        ByteArrayOutputStream expected = new ByteArrayOutputStream();
+        writeHeader(expected, SOF0, 64, 32, 4);
+        expected.writeBytes(interval(2));
+        // Restart markers are numbered from 0 again
+        expected.writeBytes(new byte[] { (byte) 0xff, (byte) 0xd0 });
+        expected.writeBytes(interval(3));
+        expected.writeBytes(new byte[] { (byte) 0xff, (byte) 0xd9 });
+        assertArrayEquals(expected.toByteArray(), bands[1].stream);
+    }
+
+    @Test
+    public void testSingleBandIsNotSplit() {
+        assertNull(JPEGRestartBandsShim.split(createImage(64, 64, 4), 1));
+        // The interval covers the whole image
+        assertNull(JPEGRestartBandsShim.split(createImage(64, 64, 16), 4));
+    }
+
+    @Test
+    public void testImageWithoutRestartMarkersIsNotSplittable() {
+        assertFalse(JPEGRestartBandsShim.isSplittable(
+                createImage(SOF0, 64, 64, 0, 1, -1)));
+    }
+
+    @Test
+    public void testProgressiveImageIsNotSplittable() {
+        assertTrue(JPEGRestartBandsShim.isSplittable(
+                createImage(SOF0, 64, 64, 4, 4, -1)));
+        assertFalse(JPEGRestartBandsShim.isSplittable(
+                createImage(SOF2, 64, 64, 4, 4, -1)));
+    }
+
+    @Test
+    public void testMissingRestartMarkerIsNotSplit() {
+        assertNull(JPEGRestartBandsShim.split(
+                createImage(SOF0, 64, 64, 4, 4, 2), 2));
+    }
+
+    @Test
+    public void testTruncatedImageIsNotSplit() {
+        byte[] image = createImage(64, 64, 4);
+        assertNull(JPEGRestartBandsShim.split(
+                Arrays.copyOf(image, image.length - 2), 2));
+    }
+
+    @Test
+    public void testRecordingStopsAtLimit() throws IOException {
+        byte[] data = new byte[100];
+        for (int i = 0; i < data.length; i++) {
+            data[i] = (byte) i;
+        }
+        InputStream recorder = JPEGRestartBandsShim.newRecordingInputStream(
+                new ByteArrayInputStream(data));
+        assertEquals(10, recorder.read(new byte[10]));
+
+        assertFalse(JPEGRestartBandsShim.readRemaining(recorder, 50));
+        assertEquals(50, JPEGRestartBandsShim.getRecordedCount(recorder));
+        // Nothing beyond the limit has been read
+        byte[] rest = JPEGRestartBandsShim.getSource(recorder).readAllBytes();
+        assertArrayEquals(Arrays.copyOfRange(data, 50, 100), rest);
+    }
+
+    @Test
+    public void testRecordingReadsToEnd() throws IOException {
+        InputStream recorder = JPEGRestartBandsShim.newRecordingInputStream(
+                new ByteArrayInputStream(new byte[100]));
+        assertTrue(JPEGRestartBandsShim.readRemaining(recorder, 1000));
+        assertEquals(100, JPEGRestartBandsShim.getRecordedCount(recorder));
+    }
+}
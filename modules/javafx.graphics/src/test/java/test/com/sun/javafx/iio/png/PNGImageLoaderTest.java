@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,15 +25,19 @@
 
 package test.com.sun.javafx.iio.png;
 
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageStorage;
 import com.sun.javafx.iio.png.PNGImageLoader2;
 import test.com.sun.javafx.iio.ImageTestHelper;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
+import java.nio.ByteBuffer;
 import java.util.concurrent.TimeUnit;
 
 import org.junit.jupiter.api.Test;
 import org.junit.jupiter.api.Timeout;
+import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertThrows;
 
 public class PNGImageLoaderTest {
@@ -86,4 +90,48 @@ public class PNGImageLoaderTest {
             testImage(stream);
         });
     }
+
+    @Test
+    public void testInterlacedFilteredRGBWithTransparency() throws IOException {
+        int[] interlacedRGB = {
+            137, 80, 78, 71, 13, 10, 26, 10, // signature
+            0, 0, 0, 13, 73, 72, 68, 82, // IHDR chunk
+            0, 0, 0, 5, 0, 0, 0, 5, 8, 2, 0, 0, 1, // 5x5 RGB, interlaced
+            117, 10, 129, 36, // IHDR chunk crc
+            0, 0, 0, 6, 116, 82, 78, 83, // tRNS chunk
+            0, 10, 0, 20, 0, 30, // transparent color 10, 20, 30
+            197, 54, 41, 255, // tRNS chunk crc
+            0, 0, 0, 86, 73, 68, 65, 84, // IDAT chunk, rows use all filter types
+            120, 156, 99, 96, 96, 96, 96, 60, 193, 195, 192, 36,
+            179, 128, 225, 201, 154, 13, 204, 41, 108, 12, 44, 50,
+            11, 34, 24, 248, 2, 24, 138, 194, 116, 174, 197, 68,
+            48, 26, 49, 51, 0, 5, 153, 248, 2, 196, 74, 184,
+            229, 152, 245, 170, 20, 219, 252, 226, 89, 216, 53, 24,
+            140, 152, 185, 225, 136, 65, 180, 130, 193, 189, 90, 177,
+            178, 206, 105, 117, 99, 242, 221, 150, 22, 0, 1, 47,
+            19, 55,
+            193, 29, 171, 162, // IDAT chunk crc
+            0, 0, 0, 0, 73, 69, 78, 68, 174, 66, 96, 130 // IEND chunk
+        };
+
+        ByteArrayInputStream stream = ImageTestHelper.constructStreamFromInts(interlacedRGB);
+        PNGImageLoader2 loader = new PNGImageLoader2(stream);
+        ImageFrame frame = loader.load(0, 0, 0, true, true, 1, 1);
+        assertEquals(ImageStorage.ImageType.RGBA, frame.getImageType());
+
+        ByteBuffer buffer = (ByteBuffer) frame.getImageData();
+        for (int y = 0; y < 5; y++) {
+            for (int x = 0; x < 5; x++) {
+                int pos = y * frame.getStride() + x * 4;
+                boolean transparent = x == 3 && y == 2;
+                int r = transparent ? 10 : (x * 50 + y * 7) % 256;
+                int g = transparent ? 20 : (y * 40 + x * 3) % 256;
+                int b = transparent ? 30 : (x * y * 11) % 256;
+                assertEquals(r, buffer.get(pos) & 0xFF);
+                assertEquals(g, buffer.get(pos + 1) & 0xFF);
+                assertEquals(b, buffer.get(pos + 2) & 0xFF);
+                assertEquals(transparent ? 0 : 255, buffer.get(pos + 3) & 0xFF);
+            }
+        }
+    }
 }
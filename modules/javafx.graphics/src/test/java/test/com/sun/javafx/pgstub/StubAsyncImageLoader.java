@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@ public class StubAsyncImageLoader implements AsyncOperation {
     private boolean started;
     private boolean cancelled;
     private boolean finished;
+    private int priority = PRIORITY_NORMAL;
 
     public StubAsyncImageLoader(
             final ImageLoader imageLoader,
@@ -66,6 +67,15 @@ public class StubAsyncImageLoader implements AsyncOperation {
         return finished;
     }
 
+    @Override
+    public void setPriority(int priority) {
+        this.priority = priority;
+    }
+
+    public int getPriority() {
+        return priority;
+    }
+
     public boolean isStarted() {
         return started;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,11 +32,14 @@ import test.com.sun.javafx.pgstub.StubAsyncImageLoader;
 import test.com.sun.javafx.pgstub.StubImageLoaderFactory;
 import test.com.sun.javafx.pgstub.StubToolkit;
 import test.com.sun.javafx.test.PropertyInvalidationCounter;
+import com.sun.javafx.runtime.async.AsyncOperation;
 import com.sun.javafx.tk.Toolkit;
 
 import java.io.ByteArrayInputStream;
 import java.io.InputStream;
+import java.util.ArrayList;
 import java.util.LinkedList;
+import java.util.List;
 import java.util.Queue;
 
 import javafx.beans.InvalidationListener;
@@ -346,6 +349,72 @@ public final class ImageTest {
         }
     }
 
+    @Test
+    public void loadImageAsyncPriorityTest() {
+        final List<StubAsyncImageLoader> asyncLoaders = new ArrayList<>();
+        final List<Image> images = new ArrayList<>();
+
+        // fill all running slots, the next image is queued
+        StubAsyncImageLoader lastAsyncLoader;
+        do {
+            final String url = "file:priority" + images.size() + ".png";
+            registerImage(url, 100, 100);
+            images.add(new Image(url, true));
+            lastAsyncLoader = imageLoaderFactory.getLastAsyncImageLoader();
+            asyncLoaders.add(lastAsyncLoader);
+        } while (lastAsyncLoader.isStarted());
+
+        final String cancelledUrl = "file:priority_cancelled.png";
+        registerImage(cancelledUrl, 100, 100);
+        final Image cancelledImage = new Image(cancelledUrl, true);
+        final StubAsyncImageLoader cancelledLoader =
+                imageLoaderFactory.getLastAsyncImageLoader();
+        asyncLoaders.add(cancelledLoader);
+
+        final String visibleUrl = "file:priority_visible.png";
+        registerImage(visibleUrl, 100, 100);
+        final Image visibleImage = new Image(visibleUrl, true);
+        final StubAsyncImageLoader visibleLoader =
+                imageLoaderFactory.getLastAsyncImageLoader();
+        asyncLoaders.add(visibleLoader);
+        assertFalse(visibleLoader.isStarted());
+
+        // cancelling a queued image must not free a running slot
+        cancelledImage.cancel();
+        assertTrue(cancelledImage.isError());
+        final String extraUrl = "file:priority_extra.png";
+        registerImage(extraUrl, 100, 100);
+        new Image(extraUrl, true);
+        final StubAsyncImageLoader extraLoader =
+                imageLoaderFactory.getLastAsyncImageLoader();
+        asyncLoaders.add(extraLoader);
+        assertFalse(extraLoader.isStarted());
+
+        // the visible image is started next, ahead of older images
+        ImageShim.setLoadPriority(visibleImage, AsyncOperation.PRIORITY_VISIBLE);
+        asyncLoaders.get(0).finish();
+        assertTrue(visibleLoader.isStarted());
+        assertEquals(AsyncOperation.PRIORITY_VISIBLE, visibleLoader.getPriority());
+        assertFalse(lastAsyncLoader.isStarted());
+        assertFalse(cancelledLoader.isStarted());
+
+        // the remaining images are loaded, except for the cancelled one
+        boolean finishedAny;
+        do {
+            finishedAny = false;
+            for (final StubAsyncImageLoader asyncLoader: asyncLoaders) {
+                if (asyncLoader.isStarted() && !asyncLoader.isDone()) {
+                    asyncLoader.finish();
+                    finishedAny = true;
+                }
+            }
+        } while (finishedAny);
+        assertTrue(extraLoader.isDone());
+        assertFalse(cancelledLoader.isStarted());
+
+        verifyLoadedImage(visibleImage, 0, 0, false, false, 100, 100);
+    }
+
     @Test
     public void animatedImageTest() {
         // reset time
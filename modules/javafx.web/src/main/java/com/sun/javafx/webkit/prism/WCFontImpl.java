@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,9 @@ import com.sun.javafx.scene.text.TextLayout;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 import java.util.Arrays;
 import java.util.HashMap;
 
@@ -115,6 +118,26 @@ final class WCFontImpl extends WCFont {
         return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
     }
 
+    @Override public void getGlyphMetrics(int firstGlyph, int count,
+                                          boolean withBounds, ByteBuffer buffer) {
+        FloatBuffer metrics = buffer.order(ByteOrder.nativeOrder()).asFloatBuffer();
+        FontResource fontResource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] bb = withBounds ? new float[4] : null;
+        for (int i = 0; i < count; i++) {
+            int glyph = firstGlyph + i;
+            int index = i * GLYPH_METRICS_SIZE;
+            metrics.put(index, fontResource.getAdvance(glyph, size));
+            if (withBounds) {
+                bb = fontResource.getGlyphBoundingBox(glyph, size, bb);
+                metrics.put(index + 1, bb[0]);
+                metrics.put(index + 2, -bb[3]);
+                metrics.put(index + 3, bb[2]);
+                metrics.put(index + 4, bb[3] - bb[1]);
+            }
+        }
+    }
+
     @Override public float getXHeight() {
         return getFontStrike().getMetrics().getXHeight();
     }
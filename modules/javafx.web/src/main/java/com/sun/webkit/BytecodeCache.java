@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.javafx.logging.PlatformLogger;
+import java.io.File;
+import java.io.IOException;
+import static java.lang.String.format;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+import java.nio.file.attribute.FileTime;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.HexFormat;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+/**
+ * A disk cache of JavaScriptCore bytecode for external scripts.
+ * <p>
+ * Entries are keyed by the script URL and the hash and length of the
+ * script text, so a changed script simply misses the cache and replaces
+ * the previous entry for its URL.  JavaScriptCore additionally validates
+ * the cached source text and its own version before using an entry.
+ * <p>
+ * There is one cache for each user data directory, shared by all pages
+ * that use the directory.  Least recently used entries of a cache are
+ * evicted once its total size exceeds {@link #getMaxSize()}.  All methods
+ * are called on the event thread.
+ */
+public final class BytecodeCache {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(BytecodeCache.class.getName());
+
+    private static final String SUFFIX = ".jsbc";
+
+    private static final Map<String, BytecodeCache> caches = new HashMap<>();
+    private static long maxSize = Long.getLong(
+            "com.sun.webkit.bytecodeCacheSize", 64L * 1024 * 1024);
+
+    private final Path directory;
+    // Entry file names in least recently used order, with their sizes, or
+    // null if the directory has not been read yet
+    private LinkedHashMap<String, Long> entries;
+    private long totalSize;
+    private boolean broken;
+
+    private BytecodeCache(Path directory) {
+        this.directory = directory;
+    }
+
+    /**
+     * Returns the maximum size of each bytecode cache.
+     * @return the maximum size of a cache, in bytes.
+     */
+    public static long getMaxSize() {
+        return maxSize;
+    }
+
+    /**
+     * Sets the maximum size of each bytecode cache.  Zero disables the
+     * caches.
+     * @param size specifies the new maximum size of a cache, in bytes.
+     * @throws IllegalArgumentException if {@code size} is negative.
+     */
+    public static void setMaxSize(long size) {
+        if (size < 0) {
+            throw new IllegalArgumentException("size is negative:" + size);
+        }
+        maxSize = size;
+        for (BytecodeCache cache : caches.values()) {
+            if (cache.entries != null) {
+                cache.evict();
+            }
+        }
+    }
+
+    /**
+     * Returns the cache stored in the given directory, or null if the
+     * cache is disabled or the directory cannot be used.
+     */
+    private static BytecodeCache get(String dir) {
+        if (dir == null || maxSize <= 0) {
+            return null;
+        }
+        BytecodeCache cache = caches.computeIfAbsent(dir,
+                d -> new BytecodeCache(Path.of(d)));
+        return cache.loadEntries() ? cache : null;
+    }
+
+    private static boolean fwkIsEnabled(String dir) {
+        return dir != null && maxSize > 0;
+    }
+
+    /**
+     * Returns the size of the entry for the given script in the cache
+     * stored in {@code dir}, or -1 if there is none.
+     */
+    static long fwkGetSize(String dir, String url, int hash, int length) {
+        BytecodeCache cache = get(dir);
+        if (cache == null) {
+            return -1;
+        }
+        Long size = cache.entries.get(entryName(url, hash, length));
+        return size != null ? size : -1;
+    }
+
+    /**
+     * Reads the entry for the given script in the cache stored in
+     * {@code dir} into {@code buffer}.
+     */
+    static boolean fwkRead(String dir, String url, int hash, int length,
+                           ByteBuffer buffer)
+    {
+        BytecodeCache cache = get(dir);
+        return cache != null && cache.read(entryName(url, hash, length), buffer);
+    }
+
+    /**
+     * Stores {@code buffer} as the entry for the given script in the cache
+     * stored in {@code dir}, replacing any entry for an older version of
+     * the script.
+     */
+    static void fwkWrite(String dir, String url, int hash, int length,
+                         ByteBuffer buffer)
+    {
+        BytecodeCache cache = get(dir);
+        if (cache != null) {
+            cache.write(entryName(url, hash, length), buffer);
+        }
+    }
+
+    private boolean read(String name, ByteBuffer buffer) {
+        Path path = directory.resolve(name);
+        try (FileChannel fc = FileChannel.open(path, StandardOpenOption.READ)) {
+            while (buffer.hasRemaining()) {
+                if (fc.read(buffer) < 0) {
+                    break;
+                }
+            }
+            if (!buffer.hasRemaining()) {
+                // Persist the recency of use across runs
+                Files.setLastModifiedTime(path,
+                        FileTime.fromMillis(System.currentTimeMillis()));
+                return true;
+            }
+        } catch (IOException | SecurityException ex) {
+            logger.fine(format("Error reading bytecode cache entry [%s]", path), ex);
+        }
+        remove(name);
+        return false;
+    }
+
+    private void write(String name, ByteBuffer buffer) {
+        long size = buffer.remaining();
+        if (size > maxSize) {
+            return;
+        }
+        Path path = directory.resolve(name);
+        Path tmp = null;
+        try {
+            // Write to a temporary file and move it into place, so that
+            // concurrent readers never see a partially written entry
+            tmp = Files.createTempFile(directory, null, ".tmp");
+            try (FileChannel fc = FileChannel.open(tmp, StandardOpenOption.WRITE)) {
+                while (buffer.hasRemaining()) {
+                    fc.write(buffer);
+                }
+            }
+            Files.move(tmp, path, StandardCopyOption.REPLACE_EXISTING,
+                    StandardCopyOption.ATOMIC_MOVE);
+        } catch (IOException | SecurityException ex) {
+            logger.fine(format("Error writing bytecode cache entry [%s]", path), ex);
+            if (tmp != null) {
+                try {
+                    Files.deleteIfExists(tmp);
+                } catch (IOException | SecurityException ignore) {
+                }
+            }
+            return;
+        }
+
+        String prefix = name.substring(0, name.indexOf('-') + 1);
+        Iterator<Map.Entry<String, Long>> it = entries.entrySet().iterator();
+        while (it.hasNext()) {
+            Map.Entry<String, Long> entry = it.next();
+            if (entry.getKey().startsWith(prefix) && !entry.getKey().equals(name)) {
+                it.remove();
+                totalSize -= entry.getValue();
+                delete(entry.getKey());
+            }
+        }
+        Long oldSize = entries.put(name, size);
+        totalSize += size - (oldSize != null ? oldSize : 0);
+        evict();
+    }
+
+    private boolean loadEntries() {
+        if (entries != null) {
+            return true;
+        }
+        if (broken) {
+            return false;
+        }
+        try {
+            Files.createDirectories(directory);
+            File[] files = directory.toFile().listFiles(
+                    (dir, name) -> name.endsWith(SUFFIX));
+            if (files == null) {
+                throw new IOException("Cannot list " + directory);
+            }
+            Arrays.sort(files, Comparator.comparingLong(File::lastModified));
+            entries = new LinkedHashMap<>(16, 0.75f, true);
+            for (File file : files) {
+                entries.put(file.getName(), file.length());
+                totalSize += file.length();
+            }
+            evict();
+            return true;
+        } catch (IOException | SecurityException ex) {
+            logger.fine(format("Error opening bytecode cache [%s]", directory), ex);
+            broken = true;
+            return false;
+        }
+    }
+
+    private void evict() {
+        Iterator<Map.Entry<String, Long>> it = entries.entrySet().iterator();
+        while (totalSize > maxSize && it.hasNext()) {
+            Map.Entry<String, Long> entry = it.next();
+            it.remove();
+            totalSize -= entry.getValue();
+            delete(entry.getKey());
+        }
+    }
+
+    private void remove(String name) {
+        Long size = entries.remove(name);
+        if (size != null) {
+            totalSize -= size;
+            delete(name);
+        }
+    }
+
+    private void delete(String name) {
+        Path path = directory.resolve(name);
+        try {
+            Files.deleteIfExists(path);
+        } catch (IOException | SecurityException ex) {
+            logger.fine(format("Error deleting bytecode cache entry [%s]", path), ex);
+        }
+    }
+
+    static String entryName(String url, int hash, int length) {
+        byte[] digest;
+        try {
+            digest = MessageDigest.getInstance("SHA-256")
+                    .digest(url.getBytes(StandardCharsets.UTF_8));
+        } catch (NoSuchAlgorithmException ex) {
+            throw new AssertionError(ex);
+        }
+        return HexFormat.of().formatHex(digest, 0, 16) + "-"
+                + Integer.toHexString(hash) + "-"
+                + Integer.toHexString(length) + SUFFIX;
+    }
+}
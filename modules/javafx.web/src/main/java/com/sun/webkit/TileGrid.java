@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import com.sun.webkit.graphics.WCRectangle;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Keeps track of the parts of a page that have to be repainted, on a grid
+ * of fixed-size tiles.
+ * <p>
+ * Each tile remembers the bounds of everything that was invalidated in it
+ * since it was last painted, so any number of repaint requests costs at
+ * most one repaint of the dirty part of each tile.  Tiles that were not
+ * invalidated stay valid and keep their content in the page back buffer.
+ * <p>
+ * When the dirty tiles are collected, dirty bounds that touch across tile
+ * edges are merged again, so a single invalidated rectangle is painted in
+ * one piece no matter how many tiles it spans.
+ * <p>
+ * Instances of this class may not be accessed and modified concurrently
+ * by multiple threads.
+ */
+public final class TileGrid {
+
+    public static final int TILE_SIZE = 256;
+
+    private int width, height;
+    private int columns, rows;
+
+    // Dirty bounds of each tile as {x1, y1, x2, y2} in page coordinates,
+    // or null if the tile is valid. Indexed by row * columns + column.
+    private int[][] tiles = new int[0][];
+    private int dirtyCount;
+
+    public int getWidth() {
+        return width;
+    }
+
+    public int getHeight() {
+        return height;
+    }
+
+    /**
+     * Resizes the grid. Dirty bounds of the tiles that are still inside
+     * the new size are kept, everything else is dropped.
+     */
+    public void setSize(int width, int height) {
+        width = Math.max(width, 0);
+        height = Math.max(height, 0);
+        if (width == this.width && height == this.height) {
+            return;
+        }
+        int[][] oldTiles = tiles;
+        int oldColumns = columns;
+        int oldRows = rows;
+
+        this.width = width;
+        this.height = height;
+        columns = (width + TILE_SIZE - 1) / TILE_SIZE;
+        rows = (height + TILE_SIZE - 1) / TILE_SIZE;
+        tiles = new int[columns * rows][];
+        dirtyCount = 0;
+
+        for (int r = 0; r < Math.min(rows, oldRows); r++) {
+            for (int c = 0; c < Math.min(columns, oldColumns); c++) {
+                int[] d = oldTiles[r * oldColumns + c];
+                if (d != null) {
+                    d[2] = Math.min(d[2], width);
+                    d[3] = Math.min(d[3], height);
+                    if (d[0] < d[2] && d[1] < d[3]) {
+                        tiles[r * columns + c] = d;
+                        dirtyCount++;
+                    }
+                }
+            }
+        }
+    }
+
+    public boolean isEmpty() {
+        return dirtyCount == 0;
+    }
+
+    public void invalidate(WCRectangle r) {
+        invalidate(r.getIntX(), r.getIntY(), r.getIntWidth(), r.getIntHeight());
+    }
+
+    public void invalidate(int x, int y, int w, int h) {
+        int x1 = Math.max(x, 0);
+        int y1 = Math.max(y, 0);
+        int x2 = Math.min(x + w, width);
+        int y2 = Math.min(y + h, height);
+        if (x1 >= x2 || y1 >= y2) {
+            return;
+        }
+        for (int r = y1 / TILE_SIZE; r <= (y2 - 1) / TILE_SIZE; r++) {
+            int ty1 = Math.max(y1, r * TILE_SIZE);
+            int ty2 = Math.min(y2, (r + 1) * TILE_SIZE);
+            for (int c = x1 / TILE_SIZE; c <= (x2 - 1) / TILE_SIZE; c++) {
+                int tx1 = Math.max(x1, c * TILE_SIZE);
+                int tx2 = Math.min(x2, (c + 1) * TILE_SIZE);
+                int[] d = tiles[r * columns + c];
+                if (d == null) {
+                    tiles[r * columns + c] = new int[] { tx1, ty1, tx2, ty2 };
+                    dirtyCount++;
+                } else {
+                    d[0] = Math.min(d[0], tx1);
+                    d[1] = Math.min(d[1], ty1);
+                    d[2] = Math.max(d[2], tx2);
+                    d[3] = Math.max(d[3], ty2);
+                }
+            }
+        }
+    }
+
+    public void invalidateAll() {
+        clear();
+        invalidate(0, 0, width, height);
+    }
+
+    public void clear() {
+        if (dirtyCount > 0) {
+            for (int i = 0; i < tiles.length; i++) {
+                tiles[i] = null;
+            }
+            dirtyCount = 0;
+        }
+    }
+
+    /**
+     * Moves the dirty bounds that lie inside the given area by
+     * {@code (dx, dy)}, following the content that was scrolled
+     * by the same amount.  Dirty bounds that only partly lie inside
+     * the area stay dirty, and their part inside the area is moved
+     * as well.
+     */
+    public void scroll(int x, int y, int w, int h, int dx, int dy) {
+        if (dirtyCount == 0 || (dx == 0 && dy == 0)) {
+            return;
+        }
+        List<int[]> moved = new ArrayList<>();
+        for (int i = 0; i < tiles.length; i++) {
+            int[] d = tiles[i];
+            if (d == null) {
+                continue;
+            }
+            if (d[0] >= x && d[1] >= y && d[2] <= x + w && d[3] <= y + h) {
+                moved.add(d);
+                tiles[i] = null;
+                dirtyCount--;
+            } else {
+                int x1 = Math.max(d[0], x);
+                int y1 = Math.max(d[1], y);
+                int x2 = Math.min(d[2], x + w);
+                int y2 = Math.min(d[3], y + h);
+                if (x1 < x2 && y1 < y2) {
+                    moved.add(new int[] { x1, y1, x2, y2 });
+                }
+            }
+        }
+        for (int[] d : moved) {
+            invalidate(d[0] + dx, d[1] + dy, d[2] - d[0], d[3] - d[1]);
+        }
+    }
+
+    /**
+     * Returns the dirty parts of the page, without changing them.
+     */
+    public List<WCRectangle> getDirtyRects() {
+        return collect(0, 0, width, height);
+    }
+
+    /**
+     * Returns the dirty parts of the page that intersect {@code clip},
+     * which are about to be painted, and marks every tile as valid.
+     */
+    public List<WCRectangle> validate(WCRectangle clip) {
+        List<WCRectangle> result = collect(clip.getIntX(), clip.getIntY(),
+                clip.getIntX() + clip.getIntWidth(),
+                clip.getIntY() + clip.getIntHeight());
+        clear();
+        return result;
+    }
+
+    private List<WCRectangle> collect(int cx1, int cy1, int cx2, int cy2) {
+        List<WCRectangle> result = new ArrayList<>();
+        if (dirtyCount == 0) {
+            return result;
+        }
+        // Rectangles that may still be extended by the runs of the next row
+        List<int[]> open = new ArrayList<>();
+        List<int[]> runs = new ArrayList<>();
+        for (int r = 0; r < rows; r++) {
+            // Merge the dirty bounds of the row that touch and have the
+            // same vertical extent
+            runs.clear();
+            int[] run = null;
+            for (int c = 0; c < columns; c++) {
+                int[] d = tiles[r * columns + c];
+                if (d == null) {
+                    run = null;
+                    continue;
+                }
+                int x1 = Math.max(d[0], cx1);
+                int y1 = Math.max(d[1], cy1);
+                int x2 = Math.min(d[2], cx2);
+                int y2 = Math.min(d[3], cy2);
+                if (x1 >= x2 || y1 >= y2) {
+                    run = null;
+                    continue;
+                }
+                if (run != null && run[2] == x1 && run[1] == y1 && run[3] == y2) {
+                    run[2] = x2;
+                } else {
+                    run = new int[] { x1, y1, x2, y2 };
+                    runs.add(run);
+                }
+            }
+
+            // Extend the rectangles of the previous row that end where
+            // a run with the same horizontal extent starts
+            List<int[]> next = new ArrayList<>();
+            for (int[] d : runs) {
+                int[] merged = null;
+                for (int[] o : open) {
+                    if (o[0] == d[0] && o[2] == d[2] && o[3] == d[1]) {
+                        merged = o;
+                        break;
+                    }
+                }
+                if (merged != null) {
+                    open.remove(merged);
+                    merged[3] = d[3];
+                    next.add(merged);
+                } else {
+                    next.add(d);
+                }
+            }
+            for (int[] o : open) {
+                result.add(toRect(o));
+            }
+            open = next;
+        }
+        for (int[] o : open) {
+            result.add(toRect(o));
+        }
+        return result;
+    }
+
+    private static WCRectangle toRect(int[] d) {
+        return new WCRectangle(d[0], d[1], d[2] - d[0], d[3] - d[1]);
+    }
+
+    @Override
+    public String toString() {
+        return "TileGrid{" + width + "x" + height
+                + ", dirty tiles: " + dirtyCount + "}";
+    }
+}
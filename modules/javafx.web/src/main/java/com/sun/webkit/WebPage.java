@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -143,6 +143,12 @@ public final class WebPage {
                 "com.sun.webkit.useJIT", "true"));
         final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                 "com.sun.webkit.useDFGJIT", "false"));
+        // FTL and WebAssembly are only compiled in on some platforms and
+        // are ignored elsewhere. FTL also requires the DFG JIT.
+        final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useFTLJIT", "true"));
+        final boolean useWebAssembly = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useWebAssembly", "true"));
 
         // TODO: Enable CSS3D by default once it is stabilized.
         boolean useCSS3D = Boolean.valueOf(System.getProperty(
@@ -150,7 +156,7 @@ public final class WebPage {
         useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
         // Initialize WTF, WebCore and JavaScriptCore.
-        twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+        twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useWebAssembly, useCSS3D);
 
         // Inform the native webkit code when either the JVM or the
         // JavaFX runtime is being shutdown
@@ -237,41 +243,17 @@ public final class WebPage {
     // *************************************************************************
 
     private WCPageBackBuffer backbuffer;
-    private List<WCRectangle> dirtyRects = new LinkedList<>();
+    // Parts of the back buffer that no longer match the page content
+    private final TileGrid dirtyTiles = new TileGrid();
 
     private void addDirtyRect(WCRectangle toPaint) {
-        if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
-            return;
-        }
-        for (Iterator<WCRectangle> it = dirtyRects.iterator(); it.hasNext();) {
-            WCRectangle rect = it.next();
-            // if already covered
-            if (rect.contains(toPaint)) {
-                return;
-            }
-            // if covers an existing one
-            if (toPaint.contains(rect)) {
-                it.remove();
-                continue;
-            }
-            WCRectangle u = rect.createUnion(toPaint);
-            // if squre of union is less than summary of squares
-            if (u.getIntWidth() * u.getIntHeight() <
-                rect.getIntWidth() * rect.getIntHeight() +
-                toPaint.getIntWidth() * toPaint.getIntHeight())
-            {
-                it.remove();
-                toPaint = u; // replace both the rects with their union
-                continue;
-            }
-        }
-        dirtyRects.add(toPaint);
+        dirtyTiles.invalidate(toPaint);
     }
 
     public boolean isDirty() {
         lockPage();
         try {
-            return !dirtyRects.isEmpty();
+            return !dirtyTiles.isEmpty();
         } finally {
             unlockPage();
         }
@@ -279,28 +261,25 @@ public final class WebPage {
 
     private void updateDirty(WCRectangle clip) {
         if (paintLog.isLoggable(Level.FINEST)) {
-            paintLog.finest("Entering, dirtyRects: {0}, currentFrame: {1}",
-                    new Object[] {dirtyRects, currentFrame});
+            paintLog.finest("Entering, dirtyTiles: {0}, currentFrame: {1}",
+                    new Object[] {dirtyTiles.getDirtyRects(), currentFrame});
         }
 
         if (isDisposed || width <= 0 || height <= 0) {
-            // If there're any dirty rects left, they are invalid.
-            // Clear the list so that the platform doesn't consider
+            // If there're any dirty tiles left, they are invalid.
+            // Clear them so that the platform doesn't consider
             // the page dirty.
-            dirtyRects.clear();
+            dirtyTiles.clear();
             return;
         }
         if (clip == null) {
             clip = new WCRectangle(0, 0, width, height);
         }
-        List<WCRectangle> oldDirtyRects = dirtyRects;
-        dirtyRects = new LinkedList<>();
+        // Only the dirty parts of the tiles are painted again, the valid
+        // tiles keep their content in the back buffer
+        List<WCRectangle> toUpdate = dirtyTiles.validate(clip);
         twkPrePaint(getPage());
-        while (!oldDirtyRects.isEmpty()) {
-            WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
-            if (r.getWidth() <= 0 || r.getHeight() <= 0) {
-                continue;
-            }
+        for (WCRectangle r : toUpdate) {
             paintLog.finest("Updating: {0}", r);
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
                     .createRenderQueue(r, true);
@@ -318,8 +297,8 @@ public final class WebPage {
         }
 
         if (paintLog.isLoggable(Level.FINEST)) {
-            paintLog.finest("Dirty rects processed, dirtyRects: {0}, currentFrame: {1}",
-                    new Object[] {dirtyRects, currentFrame});
+            paintLog.finest("Dirty rects processed, dirtyTiles: {0}, currentFrame: {1}",
+                    new Object[] {dirtyTiles.getDirtyRects(), currentFrame});
         }
 
         if (currentFrame.getRQList().size() > 0) {
@@ -357,8 +336,8 @@ public final class WebPage {
         }
 
         if (paintLog.isLoggable(Level.FINEST)) {
-            paintLog.finest("Exiting, dirtyRects: {0}, currentFrame: {1}",
-                    new Object[] {dirtyRects, currentFrame});
+            paintLog.finest("Exiting, dirtyTiles: {0}, currentFrame: {1}",
+                    new Object[] {dirtyTiles.getDirtyRects(), currentFrame});
         }
     }
 
@@ -402,17 +381,7 @@ public final class WebPage {
             currentFrame.scrollDy = dy;
             // Now we have to translate "old" dirty rects that fit to the frame's
             // content as the content is already scrolled at the moment by webkit.
-            if (!dirtyRects.isEmpty()) {
-                WCRectangle scrollRect = new WCRectangle(x, y, w, h);
-                for (WCRectangle r: dirtyRects) {
-                    if (scrollRect.contains(r)) {
-                        if (paintLog.isLoggable(Level.FINEST)) {
-                            paintLog.finest("translating old dirty rect by the delta: " + r);
-                        }
-                        r.translate(dx, dy);
-                    }
-                }
-            }
+            dirtyTiles.scroll(x, y, w, h, dx, dy);
         }
 
         // Add the dirty (not copied) rects
@@ -491,6 +460,8 @@ public final class WebPage {
     private final RenderTheme renderTheme;
     private final ScrollBarTheme scrollbarTheme;
 
+    private String bytecodeCacheDirectory;
+
     public WebPageClient getPageClient() {
         return pageClient;
     }
@@ -528,6 +499,10 @@ public final class WebPage {
         return scrollbarTheme;
     }
 
+    private String fwkGetBytecodeCacheDirectory() {
+        return bytecodeCacheDirectory;
+    }
+
     // *************************************************************************
     // UI stuff API
     // *************************************************************************
@@ -542,6 +517,7 @@ public final class WebPage {
             }
             width = w;
             height = h;
+            dirtyTiles.setSize(w, h);
             twkSetBounds(getPage(), 0, 0, w, h);
             // In response to the above call, WebKit will issue many
             // repaint requests, one of which will be meant to invalidate
@@ -2080,6 +2056,14 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory of the bytecode cache used for the scripts of
+     * this page, or {@code null} to not cache their bytecode.
+     */
+    public void setBytecodeCacheDirectory(String path) {
+        bytecodeCacheDirectory = path;
+    }
+
     // ---- INSPECTOR SUPPORT ---- //
 
     public void connectInspectorFrontend() {
@@ -2560,8 +2544,7 @@ public final class WebPage {
     }
 
     private void repaintAll() {
-        dirtyRects.clear();
-        addDirtyRect(new WCRectangle(0, 0, width, height));
+        dirtyTiles.invalidateAll();
     }
 
     private boolean isBackgroundColorTransparent() {
@@ -2594,7 +2577,8 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT,
+            boolean useFTLJIT, boolean useWebAssembly, boolean useCSS3D);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
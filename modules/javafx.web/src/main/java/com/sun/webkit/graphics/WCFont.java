@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,16 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 public abstract class WCFont extends Ref {
 
+    /**
+     * Number of floats written per glyph by {@link #getGlyphMetrics}.
+     */
+    public static final int GLYPH_METRICS_SIZE = 5;
+
     public abstract Object getPlatformFont();
 
     public abstract WCFont deriveFont(float size);
@@ -41,6 +49,30 @@ public abstract class WCFont extends Ref {
 
     public abstract float[] getGlyphBoundingBox(int glyph);
 
+    /**
+     * Writes the metrics of {@code count} consecutive glyphs, starting with
+     * {@code firstGlyph}, into a direct buffer in native byte order.
+     * For each glyph {@link #GLYPH_METRICS_SIZE} floats are reserved: the
+     * advance as returned by {@link #getGlyphWidth}, then, only if
+     * {@code withBounds} is set, the four values returned by
+     * {@link #getGlyphBoundingBox}.
+     * NB: This method is called from native code!
+     */
+    public abstract void getGlyphMetrics(int firstGlyph, int count,
+                                         boolean withBounds, ByteBuffer buffer);
+
+    /**
+     * Maps the {@code count} UTF-16 chars read from the {@code chars} buffer
+     * to glyph codes and writes them as ints into the {@code glyphs} buffer.
+     * Both are direct buffers in native byte order.
+     * NB: This method is called from native code!
+     */
+    public void getGlyphCodes(ByteBuffer chars, ByteBuffer glyphs, int count) {
+        char[] c = new char[count];
+        chars.order(ByteOrder.nativeOrder()).asCharBuffer().get(c);
+        glyphs.order(ByteOrder.nativeOrder()).asIntBuffer().put(getGlyphCodes(c), 0, count);
+    }
+
     /**
      * Returns a hash code value for the object.
      * NB: This method is called from native code!
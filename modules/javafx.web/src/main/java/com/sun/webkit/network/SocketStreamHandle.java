@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,8 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
 import java.util.List;
 import java.util.concurrent.SynchronousQueue;
 import java.util.concurrent.ThreadFactory;
@@ -65,6 +67,25 @@ final class SocketStreamHandle {
             new SynchronousQueue<Runnable>(),
             new CustomThreadFactory());
 
+    /**
+     * The size of the direct buffers received data is delivered in.
+     */
+    private static final int RECEIVE_BUFFER_SIZE = 1024 * 32;
+
+    /**
+     * The maximum number of receive buffers a single socket may hold
+     * before the reader thread waits for them to be delivered.
+     */
+    private static final int MAX_BUF_COUNT = 8;
+
+    /**
+     * The largest send buffer kept between sends.
+     */
+    private static final int MAX_RETAINED_SEND_BUFFER_SIZE = 1024 * 64;
+
+    private static final ByteBufferPool byteBufferPool =
+            ByteBufferPool.newInstance(RECEIVE_BUFFER_SIZE);
+
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
     private final String host;
@@ -76,6 +97,13 @@ final class SocketStreamHandle {
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
 
+    // Received data waiting to be delivered on the event thread. The reader
+    // thread appends to the last buffer, the event thread delivers whole
+    // buffers, so several reads are passed to WebKit in one call.
+    private final ArrayDeque<ByteBuffer> received = new ArrayDeque<>();
+    private boolean deliveryPosted;
+    private byte[] sendBuffer = new byte[0];
+
     private SocketStreamHandle(String host, int port, boolean ssl,
                                WebPage webPage, long data)
     {
@@ -118,15 +146,17 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            ByteBufferAllocator allocator =
+                    byteBufferPool.newAllocator(MAX_BUF_COUNT);
+            byte[] buffer = new byte[8192];
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
                         logger.finest(format("%s received len: [%d], data:%s",
-                                this, n, dump(buffer, n)));
+                                this, n, dump(ByteBuffer.wrap(buffer, 0, n))));
                     }
-                    didReceiveData(buffer, n);
+                    didReceiveData(buffer, n, allocator);
                 } else {
                     logger.finest("{0} connection closed by remote host", this);
                     break;
@@ -266,15 +296,25 @@ final class SocketStreamHandle {
         }
     }
 
-    private int fwkSend(byte[] buffer) {
+    private int fwkSend(ByteBuffer buffer) {
+        // The buffer wraps native memory that is only valid during this call
+        int len = buffer.remaining();
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(format("%s sending len: [%d], data:%s",
-                    this, buffer.length, dump(buffer, buffer.length)));
+                    this, len, dump(buffer)));
         }
         if (connected) {
             try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
+                byte[] bytes = sendBuffer;
+                if (bytes.length < len) {
+                    bytes = new byte[len];
+                    if (len <= MAX_RETAINED_SEND_BUFFER_SIZE) {
+                        sendBuffer = bytes;
+                    }
+                }
+                buffer.get(bytes, 0, len);
+                socket.getOutputStream().write(bytes, 0, len);
+                return len;
             } catch (IOException ex) {
                 logger.finest(format("%s exception", this), ex);
                 didFail(0, "I/O error");
@@ -312,12 +352,51 @@ final class SocketStreamHandle {
         });
     }
 
-    private void didReceiveData(final byte[] buffer, final int len) {
-        Invoker.getInvoker().postOnEventThread(() -> {
-            if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
+    private void didReceiveData(byte[] buffer, int len,
+                                ByteBufferAllocator allocator)
+            throws InterruptedException
+    {
+        int offset = 0;
+        while (offset < len) {
+            synchronized (received) {
+                ByteBuffer last = received.peekLast();
+                if (last != null && last.hasRemaining()) {
+                    int count = Math.min(last.remaining(), len - offset);
+                    last.put(buffer, offset, count);
+                    offset += count;
+                    if (!deliveryPosted) {
+                        deliveryPosted = true;
+                        Invoker.getInvoker().postOnEventThread(() -> {
+                            deliverReceivedData(allocator);
+                        });
+                    }
+                    continue;
+                }
             }
-        });
+            // Blocks while MAX_BUF_COUNT buffers are waiting for delivery
+            ByteBuffer byteBuffer = allocator.allocate();
+            synchronized (received) {
+                received.add(byteBuffer);
+            }
+        }
+    }
+
+    private void deliverReceivedData(ByteBufferAllocator allocator) {
+        while (true) {
+            ByteBuffer byteBuffer;
+            synchronized (received) {
+                byteBuffer = received.poll();
+                if (byteBuffer == null) {
+                    deliveryPosted = false;
+                    return;
+                }
+            }
+            byteBuffer.flip();
+            if (state == State.ACTIVE && byteBuffer.hasRemaining()) {
+                notifyDidReceiveData(byteBuffer);
+            }
+            allocator.release(byteBuffer);
+        }
     }
 
     private void didFail(final int errorCode, final String errorDescription) {
@@ -341,12 +420,13 @@ final class SocketStreamHandle {
         twkDidOpen(data);
     }
 
-    private void notifyDidReceiveData(byte[] buffer, int len) {
+    private void notifyDidReceiveData(ByteBuffer byteBuffer) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(format("%s, len: [%d], data:%s",
-                    this, len, dump(buffer, len)));
+                    this, byteBuffer.remaining(), dump(byteBuffer)));
         }
-        twkDidReceiveData(buffer, len, data);
+        twkDidReceiveData(byteBuffer, byteBuffer.position(),
+                          byteBuffer.remaining(), data);
     }
 
     private void notifyDidFail(int errorCode, String errorDescription) {
@@ -364,21 +444,23 @@ final class SocketStreamHandle {
     }
 
     private static native void twkDidOpen(long data);
-    private static native void twkDidReceiveData(byte[] buffer, int len,
+    private static native void twkDidReceiveData(ByteBuffer byteBuffer,
+                                                 int position, int remaining,
                                                  long data);
     private static native void twkDidFail(int errorCode,
                                           String errorDescription, long data);
     private static native void twkDidClose(long data);
 
-    private static String dump(byte[] buffer, int len) {
+    private static String dump(ByteBuffer buffer) {
         StringBuilder sb = new StringBuilder();
-        int i = 0;
+        int i = buffer.position();
+        int len = buffer.limit();
         while (i < len) {
             StringBuilder c1 = new StringBuilder();
             StringBuilder c2 = new StringBuilder();
             for (int k = 0; k < 16; k++, i++) {
                 if (i < len) {
-                    int b = buffer[i] & 0xff;
+                    int b = buffer.get(i) & 0xff;
                     c1.append(format("%02x ", b));
                     c2.append((b >= 0x20 && b <= 0x7e) ? (char) b : '.');
                 } else {
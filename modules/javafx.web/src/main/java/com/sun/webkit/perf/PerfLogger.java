@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -205,6 +205,19 @@ public final class PerfLogger {
         return stat;
     }
 
+    /**
+     * Returns the sum of the invocation counts of all the probes.
+     */
+    public synchronized int getInvocationCount() {
+        int count = 0;
+        for (Map.Entry<String, ProbeStat> entry: probes.entrySet()) {
+            if (!"TOTALTIME".equals(entry.getKey())) {
+                count += entry.getValue().getCount();
+            }
+        }
+        return count;
+    }
+
     public synchronized ProbeStat getProbeStat(String probe) {
         String p = probe.intern();
         ProbeStat s = probes.get(p);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.webkit.perf;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
 
 public final class WCFontPerfLogger extends WCFont {
     private static final PlatformLogger log =
@@ -53,6 +54,13 @@ public final class WCFontPerfLogger extends WCFont {
         logger.reset();
     }
 
+    /**
+     * Returns the number of font calls made since the last reset.
+     */
+    public static int getCallCount() {
+        return logger.getInvocationCount();
+    }
+
     @Override
     public Object getPlatformFont() {
         return fnt.getPlatformFont();
@@ -106,6 +114,14 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    @Override
+    public void getGlyphMetrics(int firstGlyph, int count,
+                                boolean withBounds, ByteBuffer buffer) {
+        logger.resumeCount("GETGLYPHMETRICS");
+        fnt.getGlyphMetrics(firstGlyph, count, withBounds, buffer);
+        logger.suspendCount("GETGLYPHMETRICS");
+    }
+
     @Override
     public int hashCode() {
         logger.resumeCount("HASH");
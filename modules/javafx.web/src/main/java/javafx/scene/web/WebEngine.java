@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -224,6 +224,12 @@ import static com.sun.webkit.LoadListenerClient.*;
  * the conversion.
  * For example if setting a Java {@code String} field from a JavaScript
  * expression, then the JavaScript value is converted to a string.
+ * If a Java method expects a primitive array such as {@code double[]},
+ * a JavaScript array, an {@code ArrayBuffer}, or a typed array with the
+ * same element layout (for example {@code Float64Array}) is copied into
+ * a new Java array in one step. If it expects a {@code java.nio.ByteBuffer},
+ * the bytes of an {@code ArrayBuffer} or typed array are copied into a new
+ * direct buffer in native byte order.
  *
  * <p><b>Mapping Java objects to JavaScript values</b></p>
  *
@@ -234,6 +240,9 @@ import static com.sun.webkit.LoadListenerClient.*;
  * Java {@code String},  {@code Number}, or {@code Boolean} objects
  * are converted to the obvious JavaScript values. A  {@code JSObject}
  * object is converted to the original wrapped JavaScript object.
+ * A direct {@code java.nio.ByteBuffer} is converted to an
+ * {@code ArrayBuffer} that shares the bytes between its position and limit
+ * with Java, without copying them; a read-only buffer is copied instead.
  * Otherwise a {@code JavaRuntimeObject} is created.  This is
  * a JavaScript object that acts as a proxy for the Java object,
  * in that accessing properties of the {@code JavaRuntimeObject}
@@ -627,8 +636,11 @@ final public class WebEngine {
      * data.
      *
      * <p>Currently, the directory specified by this property is used
-     * only to store the data that backs the {@code window.localStorage}
-     * objects. In the future, more types of data can be added.
+     * to store the data that backs the {@code window.localStorage}
+     * objects and a cache of compiled bytecode for external scripts.
+     * The bytecode cache is shared by all {@code WebEngine} instances
+     * that use the same user data directory.
+     * In the future, more types of data can be added.
      *
      * @defaultValue {@code null}
      * @since JavaFX 8.0
@@ -1023,9 +1035,11 @@ final public class WebEngine {
             try {
                 userDataDir = DirectoryLock.canonicalize(userDataDir);
                 File localStorageDir = new File(userDataDir, "localstorage");
+                File bytecodeCacheDir = new File(userDataDir, "bytecodecache");
                 File[] dirs = new File[] {
                     userDataDir,
                     localStorageDir,
+                    bytecodeCacheDir,
                 };
                 for (File dir : dirs) {
                     createDirectories(dir);
@@ -1040,6 +1054,7 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                page.setBytecodeCacheDirectory(bytecodeCacheDir.getPath());
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
@@ -621,6 +621,14 @@ static void overrideDefaults()
     Options::useWasmFaultSignalHandler() = false;
 #endif
 
+#if PLATFORM(JAVA)
+    // The JVM relies on its own SIGSEGV/SIGBUS handlers for implicit null
+    // checks and safepoint polls, and only expects foreign handlers to be
+    // chained through libjsig. Bounds check Wasm memory explicitly instead.
+    Options::useWasmFastMemory() = false;
+    Options::useWasmFaultSignalHandler() = false;
+#endif
+
 #if !HAVE(MACH_EXCEPTIONS)
     Options::useMachForExceptions() = false;
 #endif
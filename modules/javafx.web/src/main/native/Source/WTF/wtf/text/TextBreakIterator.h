@@ -175,7 +175,13 @@ private:
 
     TextBreakIteratorCache() = default;
 
+#if PLATFORM(JAVA)
+    // Pages mixing several languages need a word and a line iterator per
+    // locale, creating ICU iterators is expensive so keep more of them.
+    static constexpr int capacity = 8;
+#else
     static constexpr int capacity = 2;
+#endif
     // FIXME: Break this up into different Vectors per mode.
     Vector<TextBreakIterator, capacity> m_unused;
 };
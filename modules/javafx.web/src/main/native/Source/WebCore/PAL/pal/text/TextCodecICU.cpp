@@ -34,6 +34,7 @@
 #include <unicode/ucnv_cb.h>
 #include <wtf/TZoneMallocInlines.h>
 #include <wtf/Threading.h>
+#include <wtf/text/ASCIIFastPath.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/ParsingUtilities.h>
 #include <wtf/text/StringBuilder.h>
@@ -46,6 +47,9 @@ WTF_MAKE_TZONE_ALLOCATED_IMPL(TextCodecICU);
 
 const size_t ConversionBufferSize = 16384;
 
+// ASCII runs shorter than this are left to ICU rather than split into separate conversions.
+const size_t MinimumASCIIRunLength = 32;
+
 #define DECLARE_ALIASES(encoding, ...) \
     static constexpr ASCIILiteral encoding##_aliases[] { __VA_ARGS__ }
 
@@ -187,6 +191,80 @@ int TextCodecICU::decodeToBuffer(std::span<char16_t> targetSpan, std::span<const
     return target - targetStart;
 }
 
+// Returns true if the converter maps bytes 0x00-0x7F to the same code points. Only
+// stateless table based converters qualify, so an ASCII byte seen between complete
+// characters always stands for itself and can bypass ICU.
+bool TextCodecICU::decodesASCIIAsIdentity()
+{
+    if (m_decodesASCIIAsIdentity)
+        return *m_decodesASCIIAsIdentity;
+
+    m_decodesASCIIAsIdentity = false;
+    auto type = ucnv_getType(m_converter.get());
+    if (type != UCNV_SBCS && type != UCNV_MBCS)
+        return false;
+
+    std::array<uint8_t, 128> ascii;
+    for (size_t i = 0; i < ascii.size(); ++i)
+        ascii[i] = i;
+    std::array<char16_t, 128> decoded;
+    UErrorCode error = U_ZERO_ERROR;
+    // ucnv_toUChars() resets the converter before and after the conversion.
+    int32_t length = ucnv_toUChars(m_converter.get(), decoded.data(), decoded.size(), byteCast<char>(ascii.data()), ascii.size(), &error);
+    if (U_FAILURE(error) || length != static_cast<int32_t>(ascii.size()))
+        return false;
+    for (size_t i = 0; i < ascii.size(); ++i) {
+        if (decoded[i] != ascii[i])
+            return false;
+    }
+
+    m_decodesASCIIAsIdentity = true;
+    return true;
+}
+
+static bool hasPendingInput(UConverter& converter)
+{
+    UErrorCode error = U_ZERO_ERROR;
+    int32_t pending = ucnv_toUCountPending(&converter, &error);
+    return U_FAILURE(error) || pending;
+}
+
+static size_t asciiPrefixLength(std::span<const uint8_t> source)
+{
+    size_t length = 0;
+    while (length < source.size()) {
+        auto remaining = source.subspan(length);
+        if (WTF::isAlignedToMachineWord(remaining.data()) && remaining.size() >= sizeof(WTF::MachineWord)) {
+            if (WTF::containsOnlyASCII<LChar>(reinterpretCastSpanStartTo<const WTF::MachineWord>(remaining))) {
+                length += sizeof(WTF::MachineWord);
+                continue;
+            }
+        }
+        if (!isASCII(remaining[0]))
+            break;
+        ++length;
+    }
+    return length;
+}
+
+// Length of the leading part of source that should go through ICU: everything up to the
+// first ASCII run of at least MinimumASCIIRunLength bytes. The split lands right after a
+// non-ASCII byte, which is not necessarily a character boundary: in Shift_JIS, GBK or Big5
+// it may be a lead byte whose trail byte is in the ASCII range. ICU then keeps the lead
+// byte pending, and decode() hands the following bytes to ICU until it has completed the
+// character, see hasPendingInput().
+static size_t nonASCIISegmentLength(std::span<const uint8_t> source)
+{
+    size_t runStart = 0;
+    for (size_t i = 0; i < source.size(); ++i) {
+        if (!isASCII(source[i]))
+            runStart = i + 1;
+        else if (i + 1 - runStart >= MinimumASCIIRunLength)
+            return runStart;
+    }
+    return source.size();
+}
+
 class ErrorCallbackSetter {
 public:
     ErrorCallbackSetter(UConverter& converter, bool stopOnError)
@@ -240,10 +318,25 @@ String TextCodecICU::decode(std::span<const uint8_t> source, bool flush, bool st
     int32_t* offsets = nullptr;
     UErrorCode err = U_ZERO_ERROR;
 
+    bool skipASCII = decodesASCIIAsIdentity();
+    if (skipASCII)
+        result.reserveCapacity(source.size());
+
     do {
-        size_t ucharsDecoded = decodeToBuffer(target, source, offsets, flush, err);
-        result.append(target.first(ucharsDecoded));
-    } while (needsToGrowToProduceBuffer(err));
+        if (skipASCII && !hasPendingInput(*m_converter))
+            result.append(byteCast<LChar>(consumeSpan(source, asciiPrefixLength(source))));
+
+        // A partial character left over from the previous call may be followed by ASCII,
+        // so always give ICU at least one byte to make progress.
+        auto segment = skipASCII ? source.first(std::min(std::max<size_t>(nonASCIISegmentLength(source), 1), source.size())) : source;
+        size_t segmentSize = segment.size();
+        bool segmentFlush = flush && segmentSize == source.size();
+        do {
+            size_t ucharsDecoded = decodeToBuffer(target, segment, offsets, segmentFlush, err);
+            result.append(target.first(ucharsDecoded));
+        } while (needsToGrowToProduceBuffer(err));
+        skip(source, segmentSize - segment.size());
+    } while (U_SUCCESS(err) && !source.empty());
 
     if (U_FAILURE(err)) {
         // flush the converter so it can be reused, and not be bothered by this error.
@@ -53,10 +53,12 @@ private:
     void releaseICUConverter() const;
 
     int decodeToBuffer(std::span<char16_t> buffer, std::span<const uint8_t>& source, int32_t* offsets, bool flush, UErrorCode&);
+    bool decodesASCIIAsIdentity();
 
     ASCIILiteral m_encodingName;
     ASCIILiteral const m_canonicalConverterName;
     mutable ICUConverterPtr m_converter;
+    std::optional<bool> m_decodesASCIIAsIdentity;
 };
 
 struct ICUConverterWrapper {
@@ -29,6 +29,9 @@
 #include "CachedResourceHandle.h"
 #include "CachedScript.h"
 #include "CachedScriptFetcher.h"
+#if PLATFORM(JAVA)
+#include "Timer.h"
+#endif
 #include <JavaScriptCore/SourceProvider.h>
 
 namespace WebCore {
@@ -40,12 +43,22 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(JAVA)
+        postCachedBytecodeCommit();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
     unsigned hash() const override;
     StringView source() const override;
 
+#if PLATFORM(JAVA)
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final;
+    void cacheBytecode(const JSC::BytecodeCacheGenerator&) const final;
+    void updateCache(const JSC::UnlinkedFunctionExecutable*, const JSC::SourceCode&, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*) const final;
+    void commitCachedBytecode() const final;
+#endif
+
     JSC::CodeBlockHash codeBlockHashConcurrently(int startOffset, int endOffset, JSC::CodeSpecializationKind kind) override
     {
         return m_cachedScript->codeBlockHashConcurrently(startOffset, endOffset, kind, sourceType() == JSC::SourceProviderSourceType::Module ? CachedScript::ShouldDecodeAsUTF8Only::Yes : CachedScript::ShouldDecodeAsUTF8Only::No);
@@ -55,11 +68,26 @@ private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), cachedScript->requiresPrivacyProtections() ? JSC::SourceTaintedOrigin::KnownTainted : JSC::SourceTaintedOrigin::Untainted, TextPosition(), sourceType)
         , m_cachedScript(cachedScript)
+#if PLATFORM(JAVA)
+        , m_commitTimer([this] { commitCachedBytecode(); })
+#endif
     {
         m_cachedScript->addClient(*this);
     }
 
+#if PLATFORM(JAVA)
+    bool canCacheBytecode() const;
+    void postCachedBytecodeCommit();
+#endif
+
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    // Bytecode loaded from or to be written to the disk cache, see BytecodeCacheJava.
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    mutable String m_bytecodeCacheDirectory;
+    mutable bool m_didLoadCachedBytecode { false };
+    mutable Timer m_commitTimer;
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
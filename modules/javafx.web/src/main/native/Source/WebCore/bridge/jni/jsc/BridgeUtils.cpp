@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,7 @@
 #include <JavaScriptCore/OpaqueJSString.h>
 #include <JavaScriptCore/JSBase.h>
 #include <JavaScriptCore/JSStringRef.h>
+#include <JavaScriptCore/JSTypedArray.h>
 
 #include "com_sun_webkit_dom_JSObject.h"
 
@@ -106,6 +107,11 @@ static jclass getStringClass (JNIEnv *env)
     FIND_CACHE_CLASS(env, "java/lang/String");
 }
 
+static jclass getByteBufferClass (JNIEnv *env)
+{
+    FIND_CACHE_CLASS(env, "java/nio/ByteBuffer");
+}
+
 static jclass getNullPointerExceptionClass (JNIEnv *env)
 {
     FIND_CACHE_CLASS(env, "java/lang/NullPointerException");
@@ -134,6 +140,40 @@ JSStringRef asJSStringRef(JNIEnv *env, jstring str)
     return name;
 }
 
+static void releaseDirectByteBuffer(void*, void* buffer)
+{
+    if (JNIEnv* env = JSC::Bindings::getJNIEnv())
+        env->DeleteGlobalRef(static_cast<jobject>(buffer));
+}
+
+static void releaseByteBufferCopy(void* bytes, void*)
+{
+    fastFree(bytes);
+}
+
+// A direct ByteBuffer becomes an ArrayBuffer over its remaining bytes. The
+// memory is shared with Java, which keeps the buffer alive until the
+// ArrayBuffer is collected. Read-only buffers are copied.
+static JSValueRef directByteBufferToArrayBuffer(JNIEnv* env, JSContextRef ctx, jobject buffer, uint8_t* address)
+{
+    jclass clByteBuffer = getByteBufferClass(env);
+    static jmethodID positionMethod = env->GetMethodID(clByteBuffer, "position", "()I");
+    static jmethodID limitMethod = env->GetMethodID(clByteBuffer, "limit", "()I");
+    static jmethodID isReadOnlyMethod = env->GetMethodID(clByteBuffer, "isReadOnly", "()Z");
+
+    jint position = env->CallIntMethod(buffer, positionMethod);
+    jint limit = env->CallIntMethod(buffer, limitMethod);
+    size_t length = std::max<jint>(limit - position, 0);
+    uint8_t* bytes = address + position;
+
+    if (env->CallBooleanMethod(buffer, isReadOnlyMethod)) {
+        void* copy = fastMalloc(std::max<size_t>(length, 1));
+        memcpy(copy, bytes, length);
+        return JSObjectMakeArrayBufferWithBytesNoCopy(ctx, copy, length, releaseByteBufferCopy, nullptr, nullptr);
+    }
+    return JSObjectMakeArrayBufferWithBytesNoCopy(ctx, bytes, length, releaseDirectByteBuffer, env->NewGlobalRef(buffer), nullptr);
+}
+
 JSValueRef Java_Object_to_JSValue(
     JNIEnv *env,
     JSContextRef ctx,
@@ -190,6 +230,11 @@ JSValueRef Java_Object_to_JSValue(
         return JSValueMakeNumber(ctx, value);
     }
 
+    if (env->IsInstanceOf(val, getByteBufferClass(env))) {
+        if (void* address = env->GetDirectBufferAddress(val))
+            return directByteBufferToArrayBuffer(env, ctx, val, static_cast<uint8_t*>(address));
+    }
+
     JLObject valClass(JSC::Bindings::callJNIMethod<jobject>(val, "getClass", "()Ljava/lang/Class;"));
     if (JSC::Bindings::callJNIMethod<jboolean>(valClass, "isArray", "()Z")) {
         JLString className((jstring)JSC::Bindings::callJNIMethod<jobject>(valClass, "getName", "()Ljava/lang/String;"));
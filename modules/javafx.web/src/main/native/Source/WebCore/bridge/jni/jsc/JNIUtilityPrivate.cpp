@@ -33,7 +33,11 @@
 #include "runtime_array.h"
 #include "runtime_object.h"
 #include "runtime_root.h"
+#include <JavaScriptCore/ArrayBuffer.h>
+#include <JavaScriptCore/Error.h>
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
+#include <JavaScriptCore/JSArrayBufferViewInlines.h>
 #include <JavaScriptCore/JSLock.h>
 
 #include "JavaArrayJSC.h"
@@ -74,6 +78,239 @@ jobject convertUndefinedToJObject()
     return jgoUndefined;
 }
 
+// Returns the element type of a one-dimensional primitive array class name
+// such as "[D", or 0 for any other class name.
+static char primitiveArrayElementType(const char* javaClassName)
+{
+    if (!javaClassName || javaClassName[0] != '[' || !javaClassName[1] || javaClassName[2])
+        return 0;
+    switch (javaClassName[1]) {
+    case 'Z':
+    case 'B':
+    case 'C':
+    case 'S':
+    case 'I':
+    case 'J':
+    case 'F':
+    case 'D':
+        return javaClassName[1];
+    default:
+        return 0;
+    }
+}
+
+static size_t primitiveElementSize(char elementType)
+{
+    switch (elementType) {
+    case 'Z':
+    case 'B':
+        return 1;
+    case 'C':
+    case 'S':
+        return 2;
+    case 'I':
+    case 'F':
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+// Typed arrays are copied as is into a Java array with the same element
+// layout. ArrayBuffers have no element type and can fill any array.
+static bool typedArrayMatchesElementType(TypedArrayType type, char elementType)
+{
+    switch (type) {
+    case TypeInt8:
+    case TypeUint8:
+    case TypeUint8Clamped:
+    case TypeDataView:
+        return elementType == 'B';
+    case TypeInt16:
+    case TypeUint16:
+        return elementType == 'S' || elementType == 'C';
+    case TypeInt32:
+    case TypeUint32:
+        return elementType == 'I';
+    case TypeFloat32:
+        return elementType == 'F';
+    case TypeFloat64:
+        return elementType == 'D';
+    case TypeBigInt64:
+    case TypeBigUint64:
+        return elementType == 'J';
+    default:
+        return false;
+    }
+}
+
+static jarray newJavaPrimitiveArray(JNIEnv* env, char elementType, std::span<const uint8_t> bytes)
+{
+    jsize length = bytes.size() / primitiveElementSize(elementType);
+    switch (elementType) {
+    case 'Z': {
+        jbooleanArray array = env->NewBooleanArray(length);
+        if (array) {
+            // An ArrayBuffer may hold any byte, but a jboolean must be 0 or 1.
+            Vector<jboolean> values(length);
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = bytes[i] ? JNI_TRUE : JNI_FALSE;
+            env->SetBooleanArrayRegion(array, 0, length, values.data());
+        }
+        return array;
+    }
+    case 'B': {
+        jbyteArray array = env->NewByteArray(length);
+        if (array)
+            env->SetByteArrayRegion(array, 0, length, reinterpret_cast<const jbyte*>(bytes.data()));
+        return array;
+    }
+    case 'C': {
+        jcharArray array = env->NewCharArray(length);
+        if (array)
+            env->SetCharArrayRegion(array, 0, length, reinterpret_cast<const jchar*>(bytes.data()));
+        return array;
+    }
+    case 'S': {
+        jshortArray array = env->NewShortArray(length);
+        if (array)
+            env->SetShortArrayRegion(array, 0, length, reinterpret_cast<const jshort*>(bytes.data()));
+        return array;
+    }
+    case 'I': {
+        jintArray array = env->NewIntArray(length);
+        if (array)
+            env->SetIntArrayRegion(array, 0, length, reinterpret_cast<const jint*>(bytes.data()));
+        return array;
+    }
+    case 'J': {
+        jlongArray array = env->NewLongArray(length);
+        if (array)
+            env->SetLongArrayRegion(array, 0, length, reinterpret_cast<const jlong*>(bytes.data()));
+        return array;
+    }
+    case 'F': {
+        jfloatArray array = env->NewFloatArray(length);
+        if (array)
+            env->SetFloatArrayRegion(array, 0, length, reinterpret_cast<const jfloat*>(bytes.data()));
+        return array;
+    }
+    case 'D': {
+        jdoubleArray array = env->NewDoubleArray(length);
+        if (array)
+            env->SetDoubleArrayRegion(array, 0, length, reinterpret_cast<const jdouble*>(bytes.data()));
+        return array;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+template<typename T>
+static Vector<uint8_t> convertArrayElements(JSGlobalObject* globalObject, JSArray* array, JavaType javaType, T jvalue::*member)
+{
+    auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+    unsigned length = array->length();
+    Vector<uint8_t> bytes(length * sizeof(T));
+    auto* elements = reinterpret_cast<T*>(bytes.mutableSpan().data());
+    for (unsigned i = 0; i < length; i++) {
+        JSValue value = array->getIndex(globalObject, i);
+        RETURN_IF_EXCEPTION(scope, { });
+        elements[i] = convertValueToJValue(globalObject, nullptr, value, javaType, nullptr).*member;
+        RETURN_IF_EXCEPTION(scope, { });
+    }
+    return bytes;
+}
+
+// Creates a Java primitive array from a JS typed array, ArrayBuffer or array
+// with a single JNI call instead of one call per element.
+static jobject convertToJavaPrimitiveArray(JSGlobalObject* globalObject, JSObject* object, char elementType)
+{
+    auto scope = DECLARE_THROW_SCOPE(globalObject->vm());
+    JNIEnv* env = getJNIEnv();
+    if (auto* view = jsDynamicCast<JSArrayBufferView*>(object)) {
+        if (view->isOutOfBounds() || !typedArrayMatchesElementType(typedArrayType(view->type()), elementType))
+            return nullptr;
+        return newJavaPrimitiveArray(env, elementType, view->span());
+    }
+    if (auto* arrayBuffer = jsDynamicCast<JSArrayBuffer*>(object)) {
+        auto bytes = arrayBuffer->impl()->span();
+        if (bytes.size() % primitiveElementSize(elementType)) {
+            throwTypeError(globalObject, scope, "ArrayBuffer length is not a multiple of the Java array element size"_s);
+            return nullptr;
+        }
+        return newJavaPrimitiveArray(env, elementType, bytes);
+    }
+
+    auto* array = jsDynamicCast<JSArray*>(object);
+    if (!array)
+        return nullptr;
+
+    Vector<uint8_t> bytes;
+    JavaType javaType = javaTypeFromPrimitiveType(elementType);
+    switch (elementType) {
+    case 'Z':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::z);
+        break;
+    case 'B':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::b);
+        break;
+    case 'C':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::c);
+        break;
+    case 'S':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::s);
+        break;
+    case 'I':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::i);
+        break;
+    case 'J':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::j);
+        break;
+    case 'F':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::f);
+        break;
+    case 'D':
+        bytes = convertArrayElements(globalObject, array, javaType, &jvalue::d);
+        break;
+    }
+    RETURN_IF_EXCEPTION(scope, nullptr);
+    return newJavaPrimitiveArray(env, elementType, bytes.span());
+}
+
+// Copies the bytes of a JS typed array or ArrayBuffer into a new direct
+// ByteBuffer in native byte order.
+static jobject convertToJavaByteBuffer(JSObject* object)
+{
+    std::span<const uint8_t> bytes;
+    if (auto* view = jsDynamicCast<JSArrayBufferView*>(object)) {
+        if (view->isOutOfBounds())
+            return nullptr;
+        bytes = view->span();
+    } else if (auto* arrayBuffer = jsDynamicCast<JSArrayBuffer*>(object))
+        bytes = arrayBuffer->impl()->span();
+    else
+        return nullptr;
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass byteBufferClass(env->FindClass("java/nio/ByteBuffer"));
+    static JGClass byteOrderClass(env->FindClass("java/nio/ByteOrder"));
+    static jmethodID allocateDirectID = env->GetStaticMethodID(byteBufferClass, "allocateDirect", "(I)Ljava/nio/ByteBuffer;");
+    static jmethodID nativeOrderID = env->GetStaticMethodID(byteOrderClass, "nativeOrder", "()Ljava/nio/ByteOrder;");
+    static jmethodID orderID = env->GetMethodID(byteBufferClass, "order", "(Ljava/nio/ByteOrder;)Ljava/nio/ByteBuffer;");
+
+    jobject buffer = env->CallStaticObjectMethod(byteBufferClass, allocateDirectID, static_cast<jint>(bytes.size()));
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return nullptr;
+    }
+    if (!bytes.empty())
+        memcpy(env->GetDirectBufferAddress(buffer), bytes.data(), bytes.size());
+    JLObject nativeOrder(env->CallStaticObjectMethod(byteOrderClass, nativeOrderID));
+    JLObject orderedBuffer(env->CallObjectMethod(buffer, orderID, static_cast<jobject>(nativeOrder)));
+    return buffer;
+}
+
 jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject, JSValue value, JavaType javaType, const char* javaClassName)
 {
     JSLockHolder lock(globalObject);
@@ -115,6 +352,10 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if (char elementType = primitiveArrayElementType(javaClassName)) {
+                    result.l = convertToJavaPrimitiveArray(globalObject, object, elementType);
+                } else if (!strcmp(javaClassName, "java.nio.ByteBuffer")) {
+                    result.l = convertToJavaByteBuffer(object);
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -154,7 +395,7 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                 } else if (value.isString() && !strcmp(javaClassName, "java.lang.Character")) {
                     JNIEnv* env = getJNIEnv();
                     static JGClass clazz(env->FindClass("java/lang/Character"));
-                    jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(C)Ljava/lang/Character;");
+                    static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(C)Ljava/lang/Character;");
                     jchar charValue = toJCharValue(value, globalObject);
                     jobject javaChar = env->CallStaticObjectMethod(clazz, meth, charValue);
                     result.l = javaChar;
@@ -162,12 +403,12 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                     JNIEnv* env = getJNIEnv();
                     if (value.isInt32() && (!strcmp(javaClassName, "java.lang.Number") || !strcmp(javaClassName, "java.lang.Integer") || !strcmp(javaClassName, "java.lang.Object"))) {
                         static JGClass clazz(env->FindClass("java/lang/Integer"));
-                        jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(I)Ljava/lang/Integer;");
+                        static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(I)Ljava/lang/Integer;");
                         result.l = env->CallStaticObjectMethod(clazz, meth, (jint) value.asInt32());
                     } else if (!strcmp(javaClassName, "java.lang.Number") || !strcmp(javaClassName, "java.lang.Double") || !strcmp(javaClassName, "java.lang.Object")) {
                         jdouble doubleValue = (jdouble) value.asNumber();
                         static JGClass clazz = env->FindClass("java/lang/Double");
-                        jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(D)Ljava/lang/Double;");
+                        static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(D)Ljava/lang/Double;");
                         jobject javaDouble = env->CallStaticObjectMethod(clazz, meth, doubleValue);
                         result.l = javaDouble;
                     }
@@ -175,7 +416,7 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                     bool boolValue = value.asBoolean();
                     JNIEnv* env = getJNIEnv();
                     static JGClass clazz(env->FindClass("java/lang/Boolean"));
-                    jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(Z)Ljava/lang/Boolean;");
+                    static jmethodID meth = env->GetStaticMethodID(clazz, "valueOf", "(Z)Ljava/lang/Boolean;");
                     jobject javaBoolean = env->CallStaticObjectMethod(clazz, meth, boolValue);
                     result.l = javaBoolean;
                 } else if (value.isUndefined()) {
@@ -253,50 +494,49 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
 
 jobject jvalueToJObject(jvalue value, JavaType jtype) {
     JNIEnv* env = getJNIEnv();
-    jmethodID meth;
     switch (jtype) {
     case JavaTypeObject:
     case JavaTypeArray:
         return value.l;
     case JavaTypeBoolean: {
       static JGClass clsZ(env->FindClass("java/lang/Boolean"));
-      meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
+      static jmethodID meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
       return env->CallStaticObjectMethod(clsZ, meth, value.z);
     }
     case JavaTypeChar: {
       static JGClass clsC(env->FindClass("java/lang/Character"));
-      meth = env->GetStaticMethodID(clsC, "valueOf",
-                                    "(C)Ljava/lang/Character;");
+      static jmethodID meth = env->GetStaticMethodID(clsC, "valueOf",
+                                                     "(C)Ljava/lang/Character;");
       return env->CallStaticObjectMethod(clsC, meth, value.c);
     }
     case JavaTypeByte: {
       static JGClass clsB(env->FindClass("java/lang/Byte"));
-      meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
+      static jmethodID meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
       return env->CallStaticObjectMethod(clsB, meth, value.b);
     }
     case JavaTypeShort: {
       static JGClass clsS(env->FindClass("java/lang/Short"));
-      meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
+      static jmethodID meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
       return env->CallStaticObjectMethod(clsS, meth, value.s);
     }
     case JavaTypeInt: {
       static JGClass clsI(env->FindClass("java/lang/Integer"));
-      meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
+      static jmethodID meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
       return env->CallStaticObjectMethod(clsI, meth, value.i);
     }
     case JavaTypeLong: {
       static JGClass clsJ(env->FindClass("java/lang/Long"));
-      meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
+      static jmethodID meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
       return env->CallStaticObjectMethod(clsJ, meth, value.j);
     }
     case JavaTypeFloat: {
       static JGClass clsF(env->FindClass("java/lang/Float"));
-      meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
+      static jmethodID meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
       return env->CallStaticObjectMethod(clsF, meth, value.f);
     }
     case JavaTypeDouble: {
       static JGClass clsD(env->FindClass("java/lang/Double"));
-      meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
+      static jmethodID meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
       return env->CallStaticObjectMethod(clsD, meth, value.d);
     }
     default:
@@ -304,7 +544,7 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+jthrowable dispatchJNICall(int count, RootObject* rootObject, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -315,23 +555,43 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, rootObject, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+
+    JLObjectArray argsArray(env->NewObjectArray(count, objectCls, NULL));
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, (jobjectArray)argsArray,
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
     env->ExceptionClear();
 
+    // Primitive results come back boxed; unbox them through cached method IDs
+    // and drop the wrapper.
+    static JGClass booleanCls(env->FindClass("java/lang/Boolean"));
+    static JGClass numberCls(env->FindClass("java/lang/Number"));
+    memset(&result, 0, sizeof(jvalue));
     switch (returnType) {
     case JavaTypeVoid:
         {
@@ -343,40 +603,64 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     // to treat it as JS foreign object.
     case JavaTypeChar:
         result.l = r;
+        r = nullptr;
         break;
 
     case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
+        if (r) {
+            static jmethodID booleanValue = env->GetMethodID(booleanCls, "booleanValue", "()Z");
+            result.z = env->CallBooleanMethod(r, booleanValue);
+        }
         break;
 
     case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
+        if (r) {
+            static jmethodID byteValue = env->GetMethodID(numberCls, "byteValue", "()B");
+            result.b = env->CallByteMethod(r, byteValue);
+        }
         break;
 
     case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
+        if (r) {
+            static jmethodID shortValue = env->GetMethodID(numberCls, "shortValue", "()S");
+            result.s = env->CallShortMethod(r, shortValue);
+        }
         break;
 
     case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
+        if (r) {
+            static jmethodID intValue = env->GetMethodID(numberCls, "intValue", "()I");
+            result.i = env->CallIntMethod(r, intValue);
+        }
         break;
 
     case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
+        if (r) {
+            static jmethodID longValue = env->GetMethodID(numberCls, "longValue", "()J");
+            result.j = env->CallLongMethod(r, longValue);
+        }
         break;
 
     case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
+        if (r) {
+            static jmethodID floatValue = env->GetMethodID(numberCls, "floatValue", "()F");
+            result.f = env->CallFloatMethod(r, floatValue);
+        }
         break;
 
     case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
+        if (r) {
+            static jmethodID doubleValue = env->GetMethodID(numberCls, "doubleValue", "()D");
+            result.d = env->CallDoubleMethod(r, doubleValue);
+        }
         break;
 
     case JavaTypeInvalid:
         /* Nothing to do */
         break;
     }
+    if (r)
+        env->DeleteLocalRef(r);
     return ex;
 }
 
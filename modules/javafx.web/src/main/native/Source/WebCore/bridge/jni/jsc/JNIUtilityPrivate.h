@@ -41,6 +41,7 @@ class RootObject;
 jvalue convertValueToJValue(JSGlobalObject*, RootObject*, JSValue, JavaType, const char* javaClassName);
 jobject convertUndefinedToJObject();
 jthrowable dispatchJNICall(int, RootObject *rootObject, jobject, bool isStatic, JavaType returnType, jmethodID, jobject* args, jvalue& result, jobject accessControlContext);
+jthrowable dispatchJNICall(int, RootObject *rootObject, jobject, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext);
 jobject jvalueToJObject(jvalue value, JavaType);
 
 } // namespace Bindings
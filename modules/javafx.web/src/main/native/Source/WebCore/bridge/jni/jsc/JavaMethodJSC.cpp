@@ -66,6 +66,8 @@ JavaMethod::JavaMethod(JNIEnv* env, jobject aMethod)
             if (!parameterName)
                 parameterName = env->NewStringUTF("<Unknown>");
             m_parameters.append(JavaString(env, parameterName).impl());
+            m_parameterClassNames.append(m_parameters.last().utf8());
+            m_parameterTypes.append(javaTypeFromClassName(m_parameterClassNames.last().data()));
             env->DeleteLocalRef(aParameter);
             env->DeleteLocalRef(parameterName);
         }
@@ -85,6 +87,23 @@ JavaMethod::~JavaMethod()
         fastFree(m_signature);
 }
 
+jobject JavaMethod::reflectedMethod(jobject instance) const
+{
+    if (!m_reflectedMethod) {
+        jmethodID methodId = getMethodID(instance, name().utf8().data(), signature());
+        if (!methodId)
+            return nullptr;
+
+        JNIEnv* env = getJNIEnv();
+        JLClass cls(env->GetObjectClass(instance));
+        JLObject method(env->ToReflectedMethod(cls, methodId, m_isStatic));
+        if (!method)
+            return nullptr;
+        m_reflectedMethod = JobjectWrapper::create(method, true);
+    }
+    return m_reflectedMethod->instance();
+}
+
 // JNI method signatures use '/' between components of a class name, but
 // we get '.' between components from the reflection API.
 static void appendClassName(StringBuilder& builder, const char* className)
@@ -111,14 +130,14 @@ const char* JavaMethod::signature() const
         StringBuilder signatureBuilder;
         signatureBuilder.append('(');
         for (unsigned int i = 0; i < m_parameters.size(); i++) {
-            CString javaClassName = parameterAt(i).utf8();
-            JavaType type = javaTypeFromClassName(javaClassName.data());
+            const char* javaClassName = parameterClassNameAt(i);
+            JavaType type = parameterTypeAt(i);
             if (type == JavaTypeArray)
-                appendClassName(signatureBuilder, javaClassName.data());
+                appendClassName(signatureBuilder, javaClassName);
             else {
                 signatureBuilder.append(ASCIILiteral::fromLiteralUnsafe(signatureFromJavaType(type)));
                 if (type == JavaTypeObject) {
-                    appendClassName(signatureBuilder, javaClassName.data());
+                    appendClassName(signatureBuilder, javaClassName);
                     signatureBuilder.append(';');
                 }
             }
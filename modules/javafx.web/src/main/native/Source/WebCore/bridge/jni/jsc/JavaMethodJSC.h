@@ -30,6 +30,8 @@
 
 #include "Bridge.h"
 #include "JavaType.h"
+#include "JobjectWrapper.h"
+#include <wtf/text/CString.h>
 
 #include "JavaStringJSC.h"
 
@@ -47,15 +49,24 @@ public:
     const String name() const { return m_name.impl(); }
     RuntimeType returnTypeClassName() const { return m_returnTypeClassName.utf8(); }
     const String parameterAt(int i) const { return m_parameters[i]; }
+    JavaType parameterTypeAt(int i) const { return m_parameterTypes[i]; }
+    const char* parameterClassNameAt(int i) const { return m_parameterClassNames[i].data(); }
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
 
+    // The java.lang.reflect.Method to invoke on instances of the owning
+    // class. Resolved on first use and kept for later calls.
+    jobject reflectedMethod(jobject instance) const;
+
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
 
 private:
     Vector<WTF::String> m_parameters;
+    Vector<JavaType> m_parameterTypes;
+    Vector<CString> m_parameterClassNames;
+    mutable RefPtr<JobjectWrapper> m_reflectedMethod;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
@@ -58,6 +58,7 @@ WTF_IGNORE_WARNINGS_IN_THIRD_PARTY_CODE_END
 #endif
 
 #if PLATFORM(JAVA)
+#include "GlyphMetricsCacheJava.h"
 #include "PlatformJavaClasses.h"
 #include "RQRef.h"
 #endif
@@ -394,6 +395,7 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+    GlyphMetricsCacheJava& glyphMetrics() const;
 #endif
 
     unsigned hash() const;
@@ -488,6 +490,7 @@ private:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> m_jFont;
+    mutable RefPtr<GlyphMetricsCacheJava> m_glyphMetrics;
 #endif
 
     float m_size { 0 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -114,6 +114,13 @@ bool FontPlatformData::platformIsEqual(const FontPlatformData& other) const
     return bool_to_jbool(res);
 }
 
+GlyphMetricsCacheJava& FontPlatformData::glyphMetrics() const
+{
+    if (!m_glyphMetrics)
+        m_glyphMetrics = GlyphMetricsCacheJava::create();
+    return *m_glyphMetrics;
+}
+
 unsigned FontPlatformData::hash() const
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "GlyphMetricsCacheJava.h"
+#include "GraphicsContextJava.h"
+
+namespace WebCore {
+
+const float* GlyphMetricsCacheJava::metricsForGlyph(RQRef& jFont, Glyph glyph, bool needsBounds)
+{
+    unsigned pageNumber = static_cast<unsigned>(glyph) / pageSize;
+    auto& page = m_pages.ensure(pageNumber + 1, [] {
+        return makeUnique<Page>();
+    }).iterator->value;
+
+    if (!page->hasAdvances || (needsBounds && !page->hasBounds)) {
+        JNIEnv* env = WTF::GetJavaEnv();
+
+        static jmethodID mid = env->GetMethodID(PG_GetFontClass(env),
+            "getGlyphMetrics", "(IIZLjava/nio/ByteBuffer;)V");
+        ASSERT(mid);
+
+        JLObject buffer(env->NewDirectByteBuffer(page->metrics.data(),
+            sizeof(page->metrics)));
+        WTF::CheckAndClearException(env); // OOME
+        if (!buffer)
+            return nullptr;
+
+        env->CallVoidMethod(*jFont, mid, (jint)(pageNumber * pageSize),
+            (jint)pageSize, bool_to_jbool(needsBounds), (jobject)buffer);
+        if (WTF::CheckAndClearException(env))
+            return nullptr;
+
+        page->hasAdvances = true;
+        page->hasBounds |= needsBounds;
+    }
+    return page->metrics.data() + (static_cast<unsigned>(glyph) % pageSize) * metricsPerGlyph;
+}
+
+float GlyphMetricsCacheJava::widthForGlyph(RQRef& jFont, Glyph glyph)
+{
+    const float* metrics = metricsForGlyph(jFont, glyph, false);
+    return metrics ? metrics[0] : 0.0f;
+}
+
+FloatRect GlyphMetricsCacheJava::boundsForGlyph(RQRef& jFont, Glyph glyph)
+{
+    const float* metrics = metricsForGlyph(jFont, glyph, true);
+    if (!metrics)
+        return { };
+    return FloatRect { metrics[1], metrics[2], metrics[3], metrics[4] };
+}
+
+} // namespace WebCore
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "FloatRect.h"
+#include "Glyph.h"
+#include "RQRef.h"
+
+#include <array>
+#include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
+
+namespace WebCore {
+
+// Advances and bounds of the glyphs of a WCFont. They are fetched with one
+// upcall per page of glyphs, written by Java straight into the page storage
+// through a direct buffer.
+class GlyphMetricsCacheJava : public RefCounted<GlyphMetricsCacheJava> {
+public:
+    static Ref<GlyphMetricsCacheJava> create()
+    {
+        return adoptRef(*new GlyphMetricsCacheJava);
+    }
+
+    float widthForGlyph(RQRef& jFont, Glyph);
+    FloatRect boundsForGlyph(RQRef& jFont, Glyph);
+
+private:
+    GlyphMetricsCacheJava() = default;
+
+    static constexpr unsigned pageSize = 256;
+    // Must match WCFont.GLYPH_METRICS_SIZE: advance, x, y, width, height
+    static constexpr unsigned metricsPerGlyph = 5;
+
+    struct Page {
+        std::array<float, pageSize * metricsPerGlyph> metrics;
+        bool hasAdvances { false };
+        bool hasBounds { false };
+    };
+
+    const float* metricsForGlyph(RQRef& jFont, Glyph, bool needsBounds);
+
+    // Keyed by page number + 1, as 0 is the empty value of the map
+    HashMap<unsigned, std::unique_ptr<Page>> m_pages;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,8 @@
 #include "GraphicsContextJava.h"
 #include "Font.h"
 
+#include <array>
+
 namespace WebCore {
 
 bool GlyphPage::fill(std::span<const UChar> characterBuffer)
@@ -39,27 +41,30 @@ bool GlyphPage::fill(std::span<const UChar> characterBuffer)
     if (!jFont)
         return false;
 
-    JLocalRef<jcharArray> jchars(env->NewCharArray(characterBuffer.size()));
-    WTF::CheckAndClearException(env); // OOME
-    ASSERT(jchars);
-    if (!jchars)
+    // Characters and glyph codes are passed in direct buffers over native
+    // storage, so no Java arrays are created and copied for each page.
+    std::array<Glyph, 2 * GlyphPage::size> glyphStorage;
+    if (characterBuffer.size() > glyphStorage.size())
         return false;
 
-    jchar* chars = (jchar*)env->GetPrimitiveArrayCritical(jchars, NULL);
-    ASSERT(chars);
-    memcpy(chars, characterBuffer.data(), characterBuffer.size() * 2);
-    env->ReleasePrimitiveArrayCritical(jchars, chars, 0);
+    JLObject jchars(env->NewDirectByteBuffer(const_cast<UChar*>(characterBuffer.data()),
+        characterBuffer.size() * sizeof(UChar)));
+    WTF::CheckAndClearException(env); // OOME
+    JLObject jglyphs(env->NewDirectByteBuffer(glyphStorage.data(),
+        characterBuffer.size() * sizeof(Glyph)));
+    WTF::CheckAndClearException(env); // OOME
+    ASSERT(jchars && jglyphs);
+    if (!jchars || !jglyphs)
+        return false;
 
-    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphCodes", "([C)[I");
+    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphCodes",
+        "(Ljava/nio/ByteBuffer;Ljava/nio/ByteBuffer;I)V");
     ASSERT(mid);
-    JLocalRef<jintArray> jglyphs(static_cast<jintArray>(env->CallObjectMethod(*jFont, mid, (jcharArray)jchars)));
-    WTF::CheckAndClearException(env);
-    ASSERT(jglyphs);
-    if (!jglyphs)
+    env->CallVoidMethod(*jFont, mid, (jobject)jchars, (jobject)jglyphs, (jint)characterBuffer.size());
+    if (WTF::CheckAndClearException(env))
         return false;
 
-    Glyph* glyphs = (Glyph*)env->GetPrimitiveArrayCritical(jglyphs, NULL);
-    ASSERT(glyphs);
+    const Glyph* glyphs = glyphStorage.data();
 
     unsigned step;  // 1 for BMP, 2 for non-BMP
     if (characterBuffer.size() == GlyphPage::size) {
@@ -79,7 +84,6 @@ bool GlyphPage::fill(std::span<const UChar> characterBuffer)
         } else
             setGlyphForIndex(i, 0, this->font().colorGlyphType(glyph));
     }
-    env->ReleasePrimitiveArrayCritical(jglyphs, glyphs, JNI_ABORT);
 
     return haveGlyphs;
 }
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BytecodeCacheJava.h"
+
+#include "CachedScriptSourceProvider.h"
+#include "CommonVM.h"
+#include "Document.h"
+#include "JSDOMGlobalObject.h"
+#include "PageSupplementJava.h"
+#include "PlatformJavaClasses.h"
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/JSCellInlines.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <JavaScriptCore/VM.h>
+#include <JavaScriptCore/VMEntryScope.h>
+#include <wtf/MainThread.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/java/JavaRef.h>
+
+namespace BytecodeCacheJavaInternal {
+
+static JGClass bytecodeCacheClass;
+static jmethodID isEnabledMID;
+static jmethodID getSizeMID;
+static jmethodID readMID;
+static jmethodID writeMID;
+static jmethodID getDirectoryMID;
+
+static void initRefs(JNIEnv* env)
+{
+    if (!bytecodeCacheClass) {
+        bytecodeCacheClass = JLClass(env->FindClass("com/sun/webkit/BytecodeCache"));
+        ASSERT(bytecodeCacheClass);
+
+        isEnabledMID = env->GetStaticMethodID(bytecodeCacheClass, "fwkIsEnabled", "(Ljava/lang/String;)Z");
+        ASSERT(isEnabledMID);
+
+        getSizeMID = env->GetStaticMethodID(bytecodeCacheClass, "fwkGetSize", "(Ljava/lang/String;Ljava/lang/String;II)J");
+        ASSERT(getSizeMID);
+
+        readMID = env->GetStaticMethodID(bytecodeCacheClass, "fwkRead", "(Ljava/lang/String;Ljava/lang/String;IILjava/nio/ByteBuffer;)Z");
+        ASSERT(readMID);
+
+        writeMID = env->GetStaticMethodID(bytecodeCacheClass, "fwkWrite", "(Ljava/lang/String;Ljava/lang/String;IILjava/nio/ByteBuffer;)V");
+        ASSERT(writeMID);
+
+        getDirectoryMID = env->GetMethodID(PG_GetWebPageClass(env), "fwkGetBytecodeCacheDirectory", "()Ljava/lang/String;");
+        ASSERT(getDirectoryMID);
+    }
+}
+}
+
+namespace WebCore {
+
+namespace BytecodeCacheJava {
+
+String directoryForCurrentScript(JSC::VM& vm)
+{
+    using namespace BytecodeCacheJavaInternal;
+    auto* globalObject = vm.entryScope ? JSC::jsDynamicCast<JSDOMGlobalObject*>(vm.entryScope->globalObject()) : nullptr;
+    RefPtr document = globalObject ? dynamicDowncast<Document>(globalObject->scriptExecutionContext()) : nullptr;
+    auto* pageSupplement = document ? PageSupplementJava::from(document->page()) : nullptr;
+    if (!pageSupplement || !pageSupplement->jWebPage())
+        return { };
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    JLString directory(static_cast<jstring>(env->CallObjectMethod(pageSupplement->jWebPage(), getDirectoryMID)));
+    if (WTF::CheckAndClearException(env) || !directory)
+        return { };
+    return String(env, directory);
+}
+
+bool isEnabled(const String& directory)
+{
+    using namespace BytecodeCacheJavaInternal;
+    if (directory.isNull())
+        return false;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    jboolean result = env->CallStaticBooleanMethod(bytecodeCacheClass, isEnabledMID,
+        (jstring)directory.toJavaString(env));
+    WTF::CheckAndClearException(env);
+    return jbool_to_bool(result);
+}
+
+RefPtr<JSC::CachedBytecode> load(const String& directory, const String& url, unsigned hash, unsigned length)
+{
+    using namespace BytecodeCacheJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    JLString jdirectory(directory.toJavaString(env));
+    JLString jurl(url.toJavaString(env));
+    jlong size = env->CallStaticLongMethod(bytecodeCacheClass, getSizeMID,
+        (jstring)jdirectory, (jstring)jurl, static_cast<jint>(hash), static_cast<jint>(length));
+    if (WTF::CheckAndClearException(env) || size <= 0 || size > std::numeric_limits<jint>::max())
+        return nullptr;
+
+    // Read straight into the buffer JavaScriptCore decodes from
+    auto buffer = MallocSpan<uint8_t, JSC::VMMalloc>::malloc(size);
+    JLObject byteBuffer(env->NewDirectByteBuffer(buffer.mutableSpan().data(), size));
+    jboolean result = env->CallStaticBooleanMethod(bytecodeCacheClass, readMID,
+        (jstring)jdirectory, (jstring)jurl, static_cast<jint>(hash), static_cast<jint>(length), (jobject)byteBuffer);
+    if (WTF::CheckAndClearException(env) || !jbool_to_bool(result))
+        return nullptr;
+
+    return JSC::CachedBytecode::create(WTFMove(buffer), { });
+}
+
+RefPtr<JSC::CachedBytecode> commit(const String& directory, const String& url, unsigned hash, unsigned length, JSC::CachedBytecode& bytecode)
+{
+    using namespace BytecodeCacheJavaInternal;
+    size_t size = bytecode.sizeForUpdate();
+    if (size > static_cast<size_t>(std::numeric_limits<jint>::max()))
+        return nullptr;
+
+    // Apply the updates to a copy of the current contents instead of
+    // patching the cache file in place: the Java side replaces the file
+    // atomically, so other processes never map a half written entry.
+    auto buffer = MallocSpan<uint8_t, JSC::VMMalloc>::malloc(size);
+    auto data = buffer.mutableSpan();
+    memcpySpan(data, bytecode.span());
+    bytecode.commitUpdates([&] (off_t offset, std::span<const uint8_t> update) {
+        memcpySpan(data.subspan(offset), update);
+    });
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    JLObject byteBuffer(env->NewDirectByteBuffer(data.data(), size));
+    env->CallStaticVoidMethod(bytecodeCacheClass, writeMID,
+        (jstring)directory.toJavaString(env), (jstring)url.toJavaString(env), static_cast<jint>(hash), static_cast<jint>(length), (jobject)byteBuffer);
+    if (WTF::CheckAndClearException(env))
+        return nullptr;
+
+    return JSC::CachedBytecode::create(WTFMove(buffer), WTFMove(bytecode.leafExecutables()));
+}
+
+} // namespace BytecodeCacheJava
+
+// Functions compiled after the script first ran are written to the cache
+// after this delay, so that a burst of compilations costs a single write.
+static constexpr Seconds functionUpdateCommitDelay = 2_s;
+
+bool CachedScriptSourceProvider::canCacheBytecode() const
+{
+    if (sourceType() != JSC::SourceProviderSourceType::Program && sourceType() != JSC::SourceProviderSourceType::Module)
+        return false;
+
+    const URL& url = sourceOrigin().url();
+    if (url.isEmpty() || url.protocolIsData() || url.protocolIsBlob())
+        return false;
+
+    // The bytecode is cached in the user data directory of the page that
+    // first runs the script
+    if (m_bytecodeCacheDirectory.isNull())
+        m_bytecodeCacheDirectory = BytecodeCacheJava::directoryForCurrentScript(commonVM());
+    return BytecodeCacheJava::isEnabled(m_bytecodeCacheDirectory);
+}
+
+RefPtr<JSC::CachedBytecode> CachedScriptSourceProvider::cachedBytecode() const
+{
+    if (!m_didLoadCachedBytecode) {
+        m_didLoadCachedBytecode = true;
+        if (canCacheBytecode())
+            m_cachedBytecode = BytecodeCacheJava::load(m_bytecodeCacheDirectory, sourceURL(), hash(), source().length());
+    }
+    return m_cachedBytecode;
+}
+
+void CachedScriptSourceProvider::cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const
+{
+    if (!canCacheBytecode())
+        return;
+
+    RefPtr update = generator();
+    if (!update)
+        return;
+
+    // The program was generated from scratch, so anything loaded from the
+    // cache before did not match and is replaced rather than updated.
+    m_cachedBytecode = JSC::CachedBytecode::create();
+    m_cachedBytecode->addGlobalUpdate(update.releaseNonNull());
+    m_commitTimer.startOneShot(0_s);
+}
+
+void CachedScriptSourceProvider::updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!m_cachedBytecode)
+        return;
+
+    JSC::BytecodeCacheError error;
+    RefPtr bytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (!bytecode || error.isValid())
+        return;
+
+    m_cachedBytecode->addFunctionUpdate(executable, kind, bytecode.releaseNonNull());
+    if (!m_commitTimer.isActive())
+        m_commitTimer.startOneShot(functionUpdateCommitDelay);
+}
+
+void CachedScriptSourceProvider::commitCachedBytecode() const
+{
+    m_commitTimer.stop();
+    if (!m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+
+    m_cachedBytecode = BytecodeCacheJava::commit(m_bytecodeCacheDirectory, sourceURL(), hash(), source().length(), *m_cachedBytecode);
+}
+
+void CachedScriptSourceProvider::postCachedBytecodeCommit()
+{
+    m_commitTimer.stop();
+    if (!m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+
+    // Called on destruction: write the pending bytecode from the run loop
+    // rather than blocking whoever releases the last reference on disk I/O.
+    callOnMainThread([directory = m_bytecodeCacheDirectory.isolatedCopy(), url = sourceURL().isolatedCopy(), hash = hash(), length = source().length(), bytecode = WTFMove(m_cachedBytecode)] {
+        BytecodeCacheJava::commit(directory, url, hash, length, *bytecode);
+    });
+}
+
+} // namespace WebCore
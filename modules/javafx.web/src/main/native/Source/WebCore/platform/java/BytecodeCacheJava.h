@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/CachedBytecode.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// Disk cache of JavaScriptCore bytecode for external scripts. The caches
+// themselves are managed on the Java side by com.sun.webkit.BytecodeCache,
+// one for each user data directory; entries are keyed by script URL,
+// source hash and source length.
+namespace BytecodeCacheJava {
+
+// Returns the cache directory of the page whose script is being entered,
+// or a null string if there is none.
+String directoryForCurrentScript(JSC::VM&);
+bool isEnabled(const String& directory);
+RefPtr<JSC::CachedBytecode> load(const String& directory, const String& url, unsigned hash, unsigned length);
+// Writes the bytecode with all its pending updates applied and returns
+// a CachedBytecode for the written contents that further updates can be
+// added to, or null if the bytecode could not be stored.
+RefPtr<JSC::CachedBytecode> commit(const String& directory, const String& url, unsigned hash, unsigned length, JSC::CachedBytecode&);
+
+} // namespace BytecodeCacheJava
+
+} // namespace WebCore
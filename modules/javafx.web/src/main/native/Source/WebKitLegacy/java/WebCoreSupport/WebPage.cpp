@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -875,6 +875,8 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
+bool s_useWebAssembly;
 bool s_useCSS3D;
 
 }  // namespace
@@ -882,9 +884,12 @@ bool s_useCSS3D;
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT,
+     jboolean useWebAssembly, jboolean useCSS3D) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
+    s_useWebAssembly = useWebAssembly;
     s_useCSS3D = useCSS3D;
 }
 
@@ -914,6 +919,17 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+#if ENABLE(FTL_JIT)
+        // FTL is tiered up to from DFG.
+        JSC::Options::useFTLJIT() = JSC::Options::useDFGJIT() && s_useFTLJIT;
+#endif
+#if ENABLE(WEBASSEMBLY)
+        JSC::Options::useWasm() = s_useWebAssembly;
+        // BBQ and OMG follow the JavaScript baseline and FTL tiers. Options
+        // does not tie OMG to FTL, so apply the DFG requirement of FTL here.
+        JSC::Options::useBBQJIT() = s_useJIT;
+        JSC::Options::useOMGJIT() = JSC::Options::useDFGJIT() && s_useFTLJIT;
+#endif
     });
 
     JLObject jlself(self, true);
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit;
+
+import com.sun.webkit.BytecodeCache;
+import com.sun.webkit.BytecodeCacheShim;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.stream.Stream;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class BytecodeCacheTest {
+
+    private static final int ENTRY_SIZE = 100;
+
+    private long oldMaxSize;
+    private Path root;
+    private String dir;
+
+    @BeforeEach
+    public void setUp() throws IOException {
+        oldMaxSize = BytecodeCache.getMaxSize();
+        BytecodeCache.setMaxSize(3 * ENTRY_SIZE);
+        root = Files.createTempDirectory("bytecodecache");
+        dir = root.resolve("a").toString();
+    }
+
+    @AfterEach
+    public void tearDown() throws IOException {
+        BytecodeCache.setMaxSize(oldMaxSize);
+        try (Stream<Path> paths = Files.walk(root)) {
+            paths.sorted(Comparator.reverseOrder()).forEach(p -> p.toFile().delete());
+        }
+    }
+
+    private static ByteBuffer bytes(int fill) {
+        byte[] data = new byte[ENTRY_SIZE];
+        Arrays.fill(data, (byte) fill);
+        return ByteBuffer.wrap(data);
+    }
+
+    private static void write(String dir, String url, int hash) {
+        BytecodeCacheShim.write(dir, url, hash, 1, bytes(hash));
+    }
+
+    private static boolean contains(String dir, String url, int hash) {
+        return BytecodeCacheShim.getSize(dir, url, hash, 1) == ENTRY_SIZE;
+    }
+
+    private static boolean exists(String dir, String url, int hash) {
+        return Files.exists(Path.of(dir, BytecodeCacheShim.entryName(url, hash, 1)));
+    }
+
+    @Test
+    public void testWriteAndRead() {
+        write(dir, "http://host/a.js", 1);
+        assertTrue(exists(dir, "http://host/a.js", 1));
+        assertEquals(ENTRY_SIZE, BytecodeCacheShim.getSize(dir, "http://host/a.js", 1, 1));
+        assertEquals(-1, BytecodeCacheShim.getSize(dir, "http://host/b.js", 1, 1));
+
+        ByteBuffer buffer = ByteBuffer.allocate(ENTRY_SIZE);
+        assertTrue(BytecodeCacheShim.read(dir, "http://host/a.js", 1, 1, buffer));
+        assertArrayEquals(bytes(1).array(), buffer.array());
+    }
+
+    @Test
+    public void testLeastRecentlyUsedIsEvicted() {
+        write(dir, "http://host/a.js", 1);
+        write(dir, "http://host/b.js", 2);
+        write(dir, "http://host/c.js", 3);
+        // Looking up a makes b the least recently used entry
+        assertTrue(contains(dir, "http://host/a.js", 1));
+
+        write(dir, "http://host/d.js", 4);
+
+        assertTrue(contains(dir, "http://host/a.js", 1));
+        assertFalse(contains(dir, "http://host/b.js", 2));
+        assertFalse(exists(dir, "http://host/b.js", 2));
+        assertTrue(contains(dir, "http://host/c.js", 3));
+        assertTrue(contains(dir, "http://host/d.js", 4));
+    }
+
+    @Test
+    public void testNewVersionReplacesOldVersion() {
+        write(dir, "http://host/a.js", 1);
+        write(dir, "http://host/b.js", 2);
+        write(dir, "http://host/a.js", 5);
+
+        assertFalse(contains(dir, "http://host/a.js", 1));
+        assertFalse(exists(dir, "http://host/a.js", 1));
+        assertTrue(contains(dir, "http://host/a.js", 5));
+        assertTrue(contains(dir, "http://host/b.js", 2));
+    }
+
+    @Test
+    public void testSetMaxSizeEvicts() {
+        write(dir, "http://host/a.js", 1);
+        write(dir, "http://host/b.js", 2);
+        write(dir, "http://host/c.js", 3);
+
+        BytecodeCache.setMaxSize(ENTRY_SIZE);
+
+        assertFalse(exists(dir, "http://host/a.js", 1));
+        assertFalse(exists(dir, "http://host/b.js", 2));
+        assertTrue(contains(dir, "http://host/c.js", 3));
+    }
+
+    @Test
+    public void testZeroMaxSizeDisablesCache() {
+        write(dir, "http://host/a.js", 1);
+        BytecodeCache.setMaxSize(0);
+
+        assertEquals(-1, BytecodeCacheShim.getSize(dir, "http://host/a.js", 1, 1));
+        write(dir, "http://host/b.js", 2);
+        assertFalse(exists(dir, "http://host/b.js", 2));
+    }
+
+    @Test
+    public void testEntryLargerThanMaxSizeIsNotStored() {
+        BytecodeCache.setMaxSize(ENTRY_SIZE - 1);
+        write(dir, "http://host/a.js", 1);
+        assertFalse(exists(dir, "http://host/a.js", 1));
+    }
+
+    @Test
+    public void testNegativeMaxSize() {
+        assertThrows(IllegalArgumentException.class,
+                () -> BytecodeCache.setMaxSize(-1));
+    }
+
+    @Test
+    public void testDirectoriesAreSeparateCaches() {
+        String other = root.resolve("b").toString();
+        write(dir, "http://host/a.js", 1);
+        write(other, "http://host/b.js", 2);
+        write(other, "http://host/c.js", 3);
+        write(other, "http://host/d.js", 4);
+
+        assertTrue(contains(dir, "http://host/a.js", 1));
+        assertFalse(contains(other, "http://host/a.js", 1));
+        assertTrue(contains(other, "http://host/b.js", 2));
+        assertTrue(contains(other, "http://host/d.js", 4));
+    }
+}
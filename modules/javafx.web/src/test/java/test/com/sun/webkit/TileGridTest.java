@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit;
+
+import com.sun.webkit.TileGrid;
+import com.sun.webkit.graphics.WCRectangle;
+import java.util.List;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class TileGridTest {
+
+    private TileGrid grid;
+
+    @BeforeEach
+    public void setUp() {
+        grid = new TileGrid();
+        grid.setSize(1000, 700);
+    }
+
+    private static WCRectangle rect(int x, int y, int w, int h) {
+        return new WCRectangle(x, y, w, h);
+    }
+
+    @Test
+    public void testEmpty() {
+        assertTrue(grid.isEmpty());
+        assertEquals(List.of(), grid.getDirtyRects());
+    }
+
+    @Test
+    public void testInvalidateOutsideIsIgnored() {
+        grid.invalidate(-100, -100, 50, 50);
+        grid.invalidate(1000, 0, 50, 50);
+        grid.invalidate(10, 10, 0, 10);
+        assertTrue(grid.isEmpty());
+    }
+
+    @Test
+    public void testInvalidateIsClipped() {
+        grid.invalidate(-10, 690, 30, 30);
+        assertEquals(List.of(rect(0, 690, 20, 10)), grid.getDirtyRects());
+    }
+
+    @Test
+    public void testInvalidateAll() {
+        grid.invalidateAll();
+        assertFalse(grid.isEmpty());
+        assertEquals(List.of(rect(0, 0, 1000, 700)), grid.getDirtyRects());
+    }
+
+    @Test
+    public void testRectAcrossTilesIsMerged() {
+        int t = TileGrid.TILE_SIZE;
+        grid.invalidate(t - 56, t - 56, 100, 100);
+        assertEquals(List.of(rect(t - 56, t - 56, 100, 100)), grid.getDirtyRects());
+    }
+
+    @Test
+    public void testRectsInOneTileAreUnited() {
+        grid.invalidate(10, 10, 10, 10);
+        grid.invalidate(50, 40, 10, 10);
+        assertEquals(List.of(rect(10, 10, 50, 40)), grid.getDirtyRects());
+    }
+
+    @Test
+    public void testRectsInDistantTilesAreSeparate() {
+        grid.invalidate(10, 10, 10, 10);
+        grid.invalidate(600, 10, 10, 10);
+        grid.invalidate(10, 600, 10, 10);
+        List<WCRectangle> rects = grid.getDirtyRects();
+        assertEquals(3, rects.size());
+        assertTrue(rects.contains(rect(10, 10, 10, 10)));
+        assertTrue(rects.contains(rect(600, 10, 10, 10)));
+        assertTrue(rects.contains(rect(10, 600, 10, 10)));
+    }
+
+    @Test
+    public void testValidate() {
+        grid.invalidate(10, 10, 10, 10);
+        grid.invalidate(600, 10, 10, 10);
+        assertEquals(List.of(rect(10, 10, 10, 10)), grid.validate(rect(0, 0, 100, 100)));
+        assertTrue(grid.isEmpty());
+        assertEquals(List.of(), grid.validate(rect(0, 0, 1000, 700)));
+    }
+
+    @Test
+    public void testScroll() {
+        grid.invalidate(10, 10, 10, 10);
+        grid.invalidate(600, 600, 10, 10);
+        grid.scroll(0, 0, 500, 500, 0, 50);
+        List<WCRectangle> rects = grid.getDirtyRects();
+        assertEquals(2, rects.size());
+        assertTrue(rects.contains(rect(10, 60, 10, 10)));
+        assertTrue(rects.contains(rect(600, 600, 10, 10)));
+    }
+
+    private static boolean covers(List<WCRectangle> rects, WCRectangle r) {
+        return rects.stream().anyMatch(d -> d.contains(r));
+    }
+
+    @Test
+    public void testScrollPartlyInsideKeepsTileDirty() {
+        // Both in the first tile, only the first inside the scrolled area
+        grid.invalidate(10, 10, 10, 10);
+        grid.invalidate(200, 200, 10, 10);
+        grid.scroll(0, 0, 100, 100, 0, 50);
+        List<WCRectangle> rects = grid.getDirtyRects();
+        assertTrue(covers(rects, rect(10, 60, 10, 10)));
+        assertTrue(covers(rects, rect(200, 200, 10, 10)));
+    }
+
+    @Test
+    public void testScrollPartlyInsideIntoAnotherTile() {
+        grid.invalidate(10, 10, 10, 10);
+        grid.invalidate(200, 200, 10, 10);
+        grid.scroll(0, 0, 100, 100, 0, 300);
+        List<WCRectangle> rects = grid.getDirtyRects();
+        assertTrue(covers(rects, rect(10, 310, 10, 10)));
+        assertTrue(covers(rects, rect(200, 200, 10, 10)));
+    }
+
+    @Test
+    public void testShrinkKeepsDirtyTilesInside() {
+        grid.invalidate(700, 10, 200, 10);
+        grid.invalidate(10, 650, 10, 10);
+        grid.setSize(800, 600);
+        assertEquals(List.of(rect(700, 10, 100, 10)), grid.getDirtyRects());
+        grid.setSize(600, 600);
+        assertTrue(grid.isEmpty());
+    }
+
+    @Test
+    public void testGrowKeepsDirtyTiles() {
+        grid.invalidate(10, 10, 10, 10);
+        grid.setSize(2000, 1500);
+        assertEquals(List.of(rect(10, 10, 10, 10)), grid.getDirtyRects());
+        grid.invalidate(1900, 1400, 200, 200);
+        assertEquals(2, grid.getDirtyRects().size());
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package test.javafx.scene.web;
 
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import javafx.scene.web.WebEngine;
 import netscape.javascript.JSException;
 import netscape.javascript.JSObject;
@@ -666,6 +668,101 @@ public class JavaScriptBridgeTest extends TestBase {
          });
     }
 
+    public static class PrimitiveArrays {
+        public double[] doubles;
+        public int[] ints;
+        public byte[] bytes;
+        public boolean[] booleans;
+        public ByteBuffer buffer;
+
+        public void setDoubles(double[] a) { doubles = a; }
+        public void setInts(int[] a) { ints = a; }
+        public void setBytes(byte[] a) { bytes = a; }
+        public void setBooleans(boolean[] a) { booleans = a; }
+        public void setBuffer(ByteBuffer b) { buffer = b; }
+    }
+
+    public @Test void testTypedArrayToPrimitiveArray() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            PrimitiveArrays obj = new PrimitiveArrays();
+            bind("obj", obj);
+            web.executeScript("obj.setDoubles(new Float64Array([1.5, -2, 3.25]))");
+            assertArrayEquals(new double[] { 1.5, -2, 3.25 }, obj.doubles);
+            web.executeScript("obj.setInts(new Int32Array([7, -8, 9]).subarray(1))");
+            assertArrayEquals(new int[] { -8, 9 }, obj.ints);
+            web.executeScript("obj.setBytes(new Uint8Array([1, 2, 255]).buffer)");
+            assertArrayEquals(new byte[] { 1, 2, -1 }, obj.bytes);
+            // Any nonzero byte is true
+            web.executeScript("obj.setBooleans(new Uint8Array([0, 1, 2, 255]).buffer)");
+            assertArrayEquals(new boolean[] { false, true, true, true }, obj.booleans);
+            web.executeScript("obj.setDoubles([4, 5.5, '6'])");
+            assertArrayEquals(new double[] { 4, 5.5, 6 }, obj.doubles);
+            // Element layouts that do not match are not converted
+            web.executeScript("obj.setInts(new Float32Array([1, 2]))");
+            assertNull(obj.ints);
+        });
+    }
+
+    public @Test void testInvalidPrimitiveArrayConversions() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            PrimitiveArrays obj = new PrimitiveArrays();
+            bind("obj", obj);
+            // 6 bytes do not make a whole number of ints
+            JSException ex = assertThrows(JSException.class,
+                    () -> web.executeScript("obj.setInts(new Uint8Array(6).buffer)"));
+            assertTrue(ex.getMessage().startsWith("TypeError"), ex.getMessage());
+            assertNull(obj.ints);
+            // An exception while reading the elements is not swallowed
+            ex = assertThrows(JSException.class,
+                    () -> web.executeScript("var a = [1, 2];"
+                            + "Object.defineProperty(a, 1, { get() { throw new Error('boom'); } });"
+                            + "obj.setDoubles(a)"));
+            assertTrue(ex.getMessage().contains("boom"), ex.getMessage());
+            assertNull(obj.doubles);
+        });
+    }
+
+    public @Test void testTypedArrayToByteBuffer() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            PrimitiveArrays obj = new PrimitiveArrays();
+            bind("obj", obj);
+            web.executeScript("obj.setBuffer(new Float64Array([0.5, 42]))");
+            assertTrue(obj.buffer.isDirect());
+            assertEquals(ByteOrder.nativeOrder(), obj.buffer.order());
+            assertEquals(16, obj.buffer.remaining());
+            assertEquals(42, obj.buffer.getDouble(8), 0);
+        });
+    }
+
+    public @Test void testDirectByteBufferToArrayBuffer() {
+        final WebEngine web = getEngine();
+
+        submit(() -> {
+            ByteBuffer buffer = ByteBuffer.allocateDirect(24)
+                    .order(ByteOrder.nativeOrder());
+            buffer.putDouble(0, 1.5).putDouble(8, 2.5).putDouble(16, 3.5);
+            buffer.position(8);
+            bind("buf", buffer);
+            assertEquals(Boolean.TRUE, web.executeScript("buf instanceof ArrayBuffer"));
+            assertEquals(Integer.valueOf(16), web.executeScript("buf.byteLength"));
+            assertEquals(2.5, ((Number) web.executeScript("new Float64Array(buf)[0]")).doubleValue(), 0);
+            // The memory is shared with Java
+            web.executeScript("new Float64Array(buf)[1] = 10");
+            assertEquals(10, buffer.getDouble(16), 0);
+
+            ByteBuffer readOnly = buffer.asReadOnlyBuffer();
+            bind("ro", readOnly);
+            web.executeScript("new Float64Array(ro)[0] = 20");
+            assertEquals(2.5, buffer.getDouble(8), 0);
+        });
+    }
+
     public @Test void testBridgeBadOverloading() {
         final WebEngine web = getEngine();
 
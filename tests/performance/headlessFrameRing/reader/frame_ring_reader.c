@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Sample reader for the shared frame ring of the headless Monocle screen
+ * (see com.sun.glass.ui.monocle.HeadlessFrameRing). It maps the ring, waits
+ * for each new frame and reads it in place, reporting frames per second,
+ * frames dropped because the reader fell behind, and the average damaged
+ * area per frame.
+ *
+ * Build and run:
+ *   cc -O2 -o frame_ring_reader frame_ring_reader.c
+ *   ./frame_ring_reader /dev/shm/jfx-frames [seconds]
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define RING_MAGIC 0x4A465846u
+#define RING_VERSION 1
+#define RING_FLAG_CLOSED 1
+#define RING_FULL_DAMAGE 0xFFFFFFFFu
+#define RING_MAX_DAMAGE 16
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t headerSize;
+    uint32_t slotCount;
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+    uint32_t format;
+    uint64_t slotSize;
+    uint64_t latest;
+    uint32_t flags;
+} RingHeader;
+
+typedef struct {
+    uint64_t sequence;
+    uint64_t timestamp;
+    uint32_t damageCount;
+    uint32_t reserved;
+    uint32_t damage[RING_MAX_DAMAGE][4];
+} SlotHeader;
+
+#define SLOT_HEADER_SIZE 320
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <ring file> [seconds]\n", argv[0]);
+        return 2;
+    }
+    double seconds = argc > 2 ? atof(argv[2]) : 10.0;
+
+    int fd = -1;
+    double deadline = now() + 10.0;
+    while ((fd = open(argv[1], O_RDONLY)) < 0) {
+        if (now() > deadline) {
+            perror(argv[1]);
+            return 1;
+        }
+        usleep(100000);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(RingHeader)) {
+        fprintf(stderr, "%s: not a frame ring\n", argv[1]);
+        return 1;
+    }
+    const uint8_t *base = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    const RingHeader *hdr = (const RingHeader *) base;
+    if (__atomic_load_n(&hdr->magic, __ATOMIC_ACQUIRE) != RING_MAGIC
+            || hdr->version != RING_VERSION) {
+        fprintf(stderr, "%s: not a frame ring\n", argv[1]);
+        return 1;
+    }
+    printf("%ux%u, %u slots\n", hdr->width, hdr->height, hdr->slotCount);
+
+    uint64_t last = 0, frames = 0, dropped = 0, torn = 0;
+    double damagedPixels = 0;
+    uint64_t checksum = 0;
+    double start = now(), end = start + seconds;
+    while (now() < end) {
+        uint64_t seq = __atomic_load_n(&hdr->latest, __ATOMIC_ACQUIRE);
+        if (seq == last) {
+            if (__atomic_load_n(&hdr->flags, __ATOMIC_ACQUIRE) & RING_FLAG_CLOSED) {
+                break;
+            }
+            usleep(500);
+            continue;
+        }
+        const uint8_t *slot = base + hdr->headerSize
+                + ((seq - 1) % hdr->slotCount) * hdr->slotSize;
+        const SlotHeader *sh = (const SlotHeader *) slot;
+        if (__atomic_load_n(&sh->sequence, __ATOMIC_ACQUIRE) != seq) {
+            continue;
+        }
+        const uint32_t *pixels = (const uint32_t *) (slot + SLOT_HEADER_SIZE);
+
+        // Stand-in for encoding or comparing: touch the damaged pixels
+        uint32_t count = sh->damageCount;
+        uint64_t area = 0;
+        if (count == RING_FULL_DAMAGE || last == 0 || seq != last + 1) {
+            for (uint32_t y = 0; y < hdr->height; y++) {
+                const uint32_t *row = pixels + (size_t) y * (hdr->stride / 4);
+                for (uint32_t x = 0; x < hdr->width; x += 16) {
+                    checksum += row[x];
+                }
+            }
+            area = (uint64_t) hdr->width * hdr->height;
+        } else {
+            for (uint32_t i = 0; i < count && i < RING_MAX_DAMAGE; i++) {
+                const uint32_t *r = sh->damage[i];
+                for (uint32_t y = r[1]; y < r[1] + r[3]; y++) {
+                    const uint32_t *row = pixels + (size_t) y * (hdr->stride / 4);
+                    for (uint32_t x = r[0]; x < r[0] + r[2]; x += 16) {
+                        checksum += row[x];
+                    }
+                }
+                area += (uint64_t) r[2] * r[3];
+            }
+        }
+
+        // The writer may have reused the slot while we were reading it
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&sh->sequence, __ATOMIC_RELAXED) != seq) {
+            torn++;
+            continue;
+        }
+        if (last != 0 && seq > last + 1) {
+            dropped += seq - last - 1;
+        }
+        last = seq;
+        frames++;
+        damagedPixels += (double) area;
+    }
+    double elapsed = now() - start;
+    printf("read %llu frames in %.2f s, %.1f fps, %llu dropped, %llu torn\n",
+           (unsigned long long) frames, elapsed, frames / elapsed,
+           (unsigned long long) dropped, (unsigned long long) torn);
+    if (frames > 0) {
+        printf("average damage %.1f%% of the frame (checksum %llx)\n",
+               100.0 * damagedPixels / frames / ((double) hdr->width * hdr->height),
+               (unsigned long long) checksum);
+    }
+    munmap((void *) base, (size_t) st.st_size);
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package framering;
+
+import java.util.Random;
+
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.robot.Robot;
+import javafx.scene.shape.Rectangle;
+import javafx.stage.Stage;
+
+/**
+ * Measures how many frames per second the headless Monocle screen can
+ * produce while exporting them through the shared frame ring, and compares
+ * it with pulling every frame out through {@link Robot#getScreenCapture}.
+ * <p>
+ * Run with the headless platform, for example:
+ * <pre>
+ *   java -Dglass.platform=Monocle -Dmonocle.platform=Headless -Dprism.order=sw \
+ *        -Dmonocle.headless.shm=jfx-frames -Djavafx.animation.fullspeed=true \
+ *        framering.FrameRingBenchmark [ring|robot] [seconds] [rectangles]
+ * </pre>
+ * In {@code ring} mode (the default) frames are only published to
+ * <i>/dev/shm/jfx-frames</i>; start {@code frame_ring_reader} from the
+ * reader directory at the same time to consume them. In {@code robot} mode
+ * the application also copies every frame into a {@link WritableImage},
+ * which is what a capture tool had to do before the ring existed.
+ */
+public class FrameRingBenchmark {
+
+    public static void main(String[] args) {
+        Application.launch(FxApp.class, args);
+    }
+
+    public static class FxApp extends Application {
+
+        private static final int WIDTH = 1280;
+        private static final int HEIGHT = 800;
+
+        @Override
+        public void start(Stage stage) {
+            var args = getParameters().getRaw();
+            boolean robotMode = args.size() > 0 && "robot".equals(args.get(0));
+            long seconds = args.size() > 1 ? Long.parseLong(args.get(1)) : 10;
+            int count = args.size() > 2 ? Integer.parseInt(args.get(2)) : 200;
+
+            Random random = new Random(42);
+            Group group = new Group();
+            Rectangle[] rects = new Rectangle[count];
+            double[] dx = new double[count];
+            for (int i = 0; i < count; i++) {
+                rects[i] = new Rectangle(random.nextInt(WIDTH - 40),
+                        random.nextInt(HEIGHT - 40), 40, 40);
+                rects[i].setFill(Color.hsb(random.nextInt(360), 0.8, 0.9));
+                dx[i] = 1 + random.nextInt(4);
+                group.getChildren().add(rects[i]);
+            }
+            stage.setScene(new Scene(group, WIDTH, HEIGHT, Color.WHITE));
+            stage.show();
+
+            Robot robot = new Robot();
+            WritableImage image = new WritableImage(WIDTH, HEIGHT);
+            long[] frames = new long[1];
+
+            new AnimationTimer() {
+                private long start;
+
+                @Override
+                public void handle(long now) {
+                    if (start == 0) {
+                        start = now;
+                    }
+                    for (int i = 0; i < count; i++) {
+                        double x = rects[i].getX() + dx[i];
+                        if (x < 0 || x > WIDTH - 40) {
+                            dx[i] = -dx[i];
+                        }
+                        rects[i].setX(x);
+                    }
+                    if (robotMode) {
+                        robot.getScreenCapture(image, 0, 0, WIDTH, HEIGHT);
+                    }
+                    frames[0]++;
+                    long elapsed = now - start;
+                    if (elapsed >= seconds * 1_000_000_000L) {
+                        stop();
+                        System.out.printf("%s: %d frames in %.2f s, %.1f fps%n",
+                                robotMode ? "robot" : "ring", frames[0],
+                                elapsed / 1e9, frames[0] * 1e9 / elapsed);
+                        Platform.exit();
+                    }
+                }
+            }.start();
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gallery;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.stream.Collectors;
+import java.util.stream.Stream;
+
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.image.Image;
+import javafx.scene.image.ImageView;
+import javafx.scene.layout.TilePane;
+import javafx.stage.Stage;
+
+/**
+ * Loads a gallery of images in the background, the way a photo browser
+ * does, and reports how long it takes until the images on screen are shown
+ * and until the whole gallery is loaded.
+ * <p>
+ * The gallery is scrolled to its middle, so the visible images are neither
+ * the first nor the last ones requested. The image files found in the
+ * directory tree are repeated as needed to fill the gallery.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java gallery.ImageGalleryBenchmark &lt;photo dir&gt; [count] [size]
+ * </pre>
+ */
+public class ImageGalleryBenchmark {
+
+    private static final int COLUMNS = 6;
+    private static final int ROWS = 4;
+
+    public static void main(String[] args) throws Exception {
+        if (args.length < 1) {
+            System.err.println("usage: ImageGalleryBenchmark <photo dir> [count] [size]");
+            System.exit(2);
+        }
+        Path dir = Path.of(args[0]);
+        int count = args.length > 1 ? Integer.parseInt(args[1]) : 500;
+        int size = args.length > 2 ? Integer.parseInt(args[2]) : 256;
+
+        List<Path> files;
+        try (Stream<Path> s = Files.walk(dir)) {
+            files = s.filter(Files::isRegularFile)
+                     .filter(p -> {
+                         String n = p.getFileName().toString().toLowerCase(Locale.ROOT);
+                         return n.endsWith(".jpg") || n.endsWith(".jpeg") || n.endsWith(".png");
+                     })
+                     .sorted()
+                     .collect(Collectors.toList());
+        }
+        if (files.isEmpty()) {
+            System.err.println("No image files found in " + dir);
+            System.exit(1);
+        }
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        int visible = Math.min(count, COLUMNS * ROWS);
+        int firstVisible = (count - visible) / 2;
+        CountDownLatch visibleLoaded = new CountDownLatch(visible);
+        CountDownLatch allLoaded = new CountDownLatch(count);
+        AtomicInteger errors = new AtomicInteger();
+
+        System.out.printf("%d images from %d files, thumbnail size %d, %d visible%n",
+                count, files.size(), size, visible);
+
+        long start = System.nanoTime();
+        Platform.runLater(() -> {
+            TilePane tiles = new TilePane();
+            tiles.setPrefColumns(COLUMNS);
+            for (int i = 0; i < count; i++) {
+                String url = files.get(i % files.size()).toUri().toString();
+                Image image = new Image(url, size, size, true, true, true);
+                boolean isVisible = i >= firstVisible && i < firstVisible + visible;
+                Runnable loaded = () -> {
+                    if (image.isError()) {
+                        errors.incrementAndGet();
+                    }
+                    if (isVisible) {
+                        visibleLoaded.countDown();
+                    }
+                    allLoaded.countDown();
+                };
+                if (image.getProgress() >= 1) {
+                    loaded.run();
+                } else {
+                    image.progressProperty().addListener((ov, oldValue, newValue) -> {
+                        if (newValue.doubleValue() >= 1) {
+                            loaded.run();
+                        }
+                    });
+                }
+                if (isVisible) {
+                    ImageView view = new ImageView(image);
+                    view.setFitWidth(size);
+                    view.setFitHeight(size);
+                    view.setPreserveRatio(true);
+                    tiles.getChildren().add(view);
+                }
+            }
+            Stage stage = new Stage();
+            stage.setScene(new Scene(tiles));
+            stage.show();
+        });
+
+        visibleLoaded.await();
+        long firstVisibleTime = System.nanoTime() - start;
+        allLoaded.await();
+        long totalTime = System.nanoTime() - start;
+
+        System.out.printf("time to first visible: %.1f ms%n", firstVisibleTime / 1e6);
+        System.out.printf("total time: %.1f ms, %.1f images/s, %d errors%n",
+                totalTime / 1e6, count * 1e9 / totalTime, errors.get());
+        Platform.exit();
+    }
+}
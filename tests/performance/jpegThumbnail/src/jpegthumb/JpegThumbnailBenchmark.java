@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jpegthumb;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.CountDownLatch;
+import java.util.stream.Collectors;
+import java.util.stream.Stream;
+
+import javafx.application.Platform;
+import javafx.scene.image.Image;
+
+/**
+ * Decodes every JPEG file in a directory tree into a thumbnail, the way an
+ * image gallery does, and reports the throughput. The first pass warms up
+ * the decoder and is not counted.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java jpegthumb.JpegThumbnailBenchmark &lt;photo dir&gt; [size] [passes]
+ * </pre>
+ * A size of 0 decodes the images at full resolution.
+ */
+public class JpegThumbnailBenchmark {
+
+    public static void main(String[] args) throws Exception {
+        if (args.length < 1) {
+            System.err.println("usage: JpegThumbnailBenchmark <photo dir> [size] [passes]");
+            System.exit(2);
+        }
+        Path dir = Path.of(args[0]);
+        int size = args.length > 1 ? Integer.parseInt(args[1]) : 256;
+        int passes = args.length > 2 ? Integer.parseInt(args[2]) : 3;
+
+        List<Path> files;
+        try (Stream<Path> s = Files.walk(dir)) {
+            files = s.filter(Files::isRegularFile)
+                     .filter(p -> {
+                         String n = p.getFileName().toString().toLowerCase(Locale.ROOT);
+                         return n.endsWith(".jpg") || n.endsWith(".jpeg");
+                     })
+                     .sorted()
+                     .collect(Collectors.toList());
+        }
+        if (files.isEmpty()) {
+            System.err.println("No JPEG files found in " + dir);
+            System.exit(1);
+        }
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        long bytes = 0;
+        for (Path p : files) {
+            bytes += Files.size(p);
+        }
+        System.out.printf("%d files, %.1f MB, thumbnail size %d%n",
+                files.size(), bytes / 1e6, size);
+
+        for (int pass = 0; pass <= passes; pass++) {
+            long pixels = 0;
+            long start = System.nanoTime();
+            for (Path p : files) {
+                Image image = load(p, size);
+                pixels += (long) image.getWidth() * (long) image.getHeight();
+            }
+            long elapsed = System.nanoTime() - start;
+            if (pass > 0) {
+                System.out.printf("pass %d: %.1f images/s, %.1f ms/image, %.1f MB/s compressed, %d output pixels%n",
+                        pass, files.size() * 1e9 / elapsed,
+                        elapsed / 1e6 / files.size(), bytes * 1e3 / elapsed, pixels);
+            }
+        }
+        Platform.exit();
+    }
+
+    private static Image load(Path p, int size) throws IOException {
+        String url = p.toUri().toString();
+        Image image = size > 0
+                ? new Image(url, size, size, true, true, false)
+                : new Image(url, false);
+        if (image.isError()) {
+            throw new IOException("Failed loading " + p, image.getException());
+        }
+        return image;
+    }
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webbridge;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+import netscape.javascript.JSObject;
+
+/**
+ * Measures the throughput of calls across the WebView bridge in both
+ * directions: JavaScript calling methods of a Java object installed on
+ * the window, and Java calling JavaScript functions through JSObject.
+ * Each case uses a different set of argument and return types.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java webbridge.WebBridgeCallBenchmark [calls] [rounds]
+ * </pre>
+ */
+public class WebBridgeCallBenchmark {
+
+    public static class Bridge {
+        private long sum;
+
+        public void noArgs() {
+            sum++;
+        }
+
+        public int addInt(int a, int b) {
+            return a + b;
+        }
+
+        public double scale(double value, float factor) {
+            return value * factor;
+        }
+
+        public boolean toggle(boolean value) {
+            return !value;
+        }
+
+        public String echo(String s) {
+            return s;
+        }
+
+        public Object identity(Object o) {
+            return o;
+        }
+
+        public long getSum() {
+            return sum;
+        }
+    }
+
+    private static final String SCRIPT = """
+        function run(kind, n) {
+            var b = window.javaBridge, r = 0, s = 'bridge', o = { x: 1 };
+            switch (kind) {
+            case 'noArgs': for (var i = 0; i < n; i++) b.noArgs(); break;
+            case 'int': for (var i = 0; i < n; i++) r = b.addInt(i, r & 0xff); break;
+            case 'double': for (var i = 0; i < n; i++) r = b.scale(i * 0.5, 1.5); break;
+            case 'boolean': for (var i = 0; i < n; i++) r = b.toggle(r); break;
+            case 'String': for (var i = 0; i < n; i++) r = b.echo(s); break;
+            case 'Object': for (var i = 0; i < n; i++) r = b.identity(o); break;
+            }
+            return r;
+        }
+        function noArgs() { return 0; }
+        function addInt(a, b) { return a + b; }
+        function echo(s) { return s; }
+        function identity(o) { return o; }
+        """;
+
+    private static final String[] JS_TO_JAVA = {
+        "noArgs", "int", "double", "boolean", "String", "Object"
+    };
+
+    public static void main(String[] args) throws Exception {
+        int calls = args.length > 0 ? Integer.parseInt(args[0]) : 100000;
+        int rounds = args.length > 1 ? Integer.parseInt(args[1]) : 5;
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<WebEngine> loaded = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.getLoadWorker().stateProperty().addListener((ov, oldValue, newValue) -> {
+                if (newValue == Worker.State.SUCCEEDED) {
+                    loaded.complete(engine);
+                } else if (newValue == Worker.State.FAILED) {
+                    loaded.completeExceptionally(engine.getLoadWorker().getException());
+                }
+            });
+            engine.loadContent("<html><body><script>" + SCRIPT + "</script></body></html>");
+        });
+        WebEngine engine = loaded.get();
+
+        Bridge bridge = new Bridge();
+        Platform.runLater(() -> {
+            JSObject window = (JSObject) engine.executeScript("window");
+            window.setMember("javaBridge", bridge);
+        });
+
+        System.out.printf("%d calls, %d rounds%n", calls, rounds);
+        for (int round = 0; round < rounds; round++) {
+            System.out.printf("round %d%n", round);
+            for (String kind : JS_TO_JAVA) {
+                long time = runOnFxThread(() -> {
+                    long start = System.nanoTime();
+                    engine.executeScript("run('" + kind + "', " + calls + ")");
+                    return System.nanoTime() - start;
+                });
+                report("JS -> Java " + kind, calls, time);
+            }
+
+            long time = runOnFxThread(() -> {
+                JSObject window = (JSObject) engine.executeScript("window");
+                long start = System.nanoTime();
+                for (int i = 0; i < calls; i++) {
+                    window.call("noArgs");
+                }
+                return System.nanoTime() - start;
+            });
+            report("Java -> JS noArgs", calls, time);
+
+            time = runOnFxThread(() -> {
+                JSObject window = (JSObject) engine.executeScript("window");
+                long start = System.nanoTime();
+                int r = 0;
+                for (int i = 0; i < calls; i++) {
+                    r = ((Number) window.call("addInt", i, r & 0xff)).intValue();
+                }
+                return System.nanoTime() - start;
+            });
+            report("Java -> JS int", calls, time);
+
+            time = runOnFxThread(() -> {
+                JSObject window = (JSObject) engine.executeScript("window");
+                long start = System.nanoTime();
+                for (int i = 0; i < calls; i++) {
+                    window.call("echo", "bridge");
+                }
+                return System.nanoTime() - start;
+            });
+            report("Java -> JS String", calls, time);
+
+            time = runOnFxThread(() -> {
+                JSObject window = (JSObject) engine.executeScript("window");
+                long start = System.nanoTime();
+                for (int i = 0; i < calls; i++) {
+                    window.call("identity", bridge);
+                }
+                return System.nanoTime() - start;
+            });
+            report("Java -> JS Object", calls, time);
+        }
+        Platform.exit();
+    }
+
+    private interface Timed {
+        long run();
+    }
+
+    private static long runOnFxThread(Timed timed) throws Exception {
+        CompletableFuture<Long> result = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            try {
+                result.complete(timed.run());
+            } catch (Throwable t) {
+                result.completeExceptionally(t);
+            }
+        });
+        return result.get();
+    }
+
+    private static void report(String name, int calls, long time) {
+        System.out.printf("  %-20s %8.1f ms, %10.0f calls/s%n",
+                name, time / 1e6, calls / (time / 1e9));
+    }
+}
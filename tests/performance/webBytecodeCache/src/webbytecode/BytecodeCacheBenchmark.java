@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webbytecode;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.lang.management.ManagementFactory;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.stream.Stream;
+
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Measures how long a WebEngine takes to load and run a large script
+ * bundle with an empty (cold) and a populated (warm) bytecode cache.
+ * <p>
+ * Each measurement runs in a new JVM, so that nothing but the on-disk
+ * bytecode cache in the user data directory survives between the cold
+ * and the warm start.  Without a bundle argument a synthetic bundle of
+ * many small functions is generated.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java webbytecode.BytecodeCacheBenchmark [rounds] [bundle.js]
+ * </pre>
+ */
+public class BytecodeCacheBenchmark {
+
+    private static final String CHILD = "--child";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0 && args[0].equals(CHILD)) {
+            runChild(new File(args[1]), new File(args[2]));
+            return;
+        }
+
+        int rounds = args.length > 0 ? Integer.parseInt(args[0]) : 5;
+        Path work = Files.createTempDirectory("bytecodecache");
+        Path page = work.resolve("index.html");
+        Path bundle;
+        if (args.length > 1) {
+            bundle = Path.of(args[1]).toAbsolutePath();
+        } else {
+            bundle = work.resolve("bundle.js");
+            Files.writeString(bundle, createBundle(4000));
+        }
+        Files.writeString(page, "<html><body>"
+                + "<script>var start = performance.now();</script>"
+                + "<script src='" + bundle.toUri() + "'></script>"
+                + "<script>var elapsed = performance.now() - start;</script>"
+                + "</body></html>");
+        System.out.printf("bundle %s, %d KB, %d rounds%n",
+                bundle, Files.size(bundle) / 1024, rounds);
+
+        double coldTotal = 0, warmTotal = 0;
+        for (int i = 0; i < rounds; i++) {
+            Path userData = work.resolve("userdata" + i);
+            double cold = launch(userData, page);
+            double warm = launch(userData, page);
+            coldTotal += cold;
+            warmTotal += warm;
+            System.out.printf("round %d: cold %.1f ms, warm %.1f ms%n", i, cold, warm);
+        }
+        System.out.printf("average: cold %.1f ms, warm %.1f ms, %.2fx%n",
+                coldTotal / rounds, warmTotal / rounds, coldTotal / warmTotal);
+
+        try (Stream<Path> paths = Files.walk(work)) {
+            paths.sorted(Comparator.reverseOrder()).map(Path::toFile).forEach(File::delete);
+        }
+    }
+
+    /**
+     * Runs the page in a new JVM with the same options as this one and
+     * returns the script time it reports.
+     */
+    private static double launch(Path userData, Path page) throws Exception {
+        List<String> command = new ArrayList<>();
+        command.add(Path.of(System.getProperty("java.home"), "bin", "java").toString());
+        command.addAll(ManagementFactory.getRuntimeMXBean().getInputArguments());
+        String modulePath = System.getProperty("jdk.module.path");
+        if (modulePath != null) {
+            command.add("--module-path");
+            command.add(modulePath);
+            command.add("--add-modules");
+            command.add("javafx.web");
+        }
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        command.add(BytecodeCacheBenchmark.class.getName());
+        command.add(CHILD);
+        command.add(userData.toString());
+        command.add(page.toString());
+
+        Process process = new ProcessBuilder(command).redirectErrorStream(true).start();
+        double result = Double.NaN;
+        try (BufferedReader in = new BufferedReader(
+                new InputStreamReader(process.getInputStream()))) {
+            String line;
+            while ((line = in.readLine()) != null) {
+                if (line.startsWith("elapsed ")) {
+                    result = Double.parseDouble(line.substring(8));
+                } else {
+                    System.out.println("  " + line);
+                }
+            }
+        }
+        if (process.waitFor() != 0 || Double.isNaN(result)) {
+            throw new IOException("Benchmark process failed");
+        }
+        return result;
+    }
+
+    private static void runChild(File userData, File page) throws Exception {
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<Double> loaded = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setUserDataDirectory(userData);
+            engine.getLoadWorker().stateProperty().addListener((ov, oldValue, newValue) -> {
+                if (newValue == Worker.State.SUCCEEDED) {
+                    loaded.complete(((Number) engine.executeScript("elapsed")).doubleValue());
+                } else if (newValue == Worker.State.FAILED) {
+                    loaded.completeExceptionally(engine.getLoadWorker().getException());
+                }
+            });
+            engine.load(page.toURI().toString());
+        });
+        System.out.println("elapsed " + loaded.get());
+
+        // Give the cache time to write the bytecode of the functions that
+        // were compiled while the bundle ran
+        Thread.sleep(3000);
+        Platform.exit();
+    }
+
+    /**
+     * Creates a script of many small functions, a fraction of which is
+     * called at startup, roughly resembling an application bundle.
+     */
+    private static String createBundle(int functions) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("var modules = {};\n");
+        for (int i = 0; i < functions; i++) {
+            sb.append("modules.m").append(i).append(" = function(input, options) {\n")
+              .append("    var result = [];\n")
+              .append("    options = options || { scale: ").append(i % 7 + 1).append(" };\n")
+              .append("    for (var k = 0; k < input.length; k++) {\n")
+              .append("        var v = input[k] * options.scale + ").append(i).append(";\n")
+              .append("        if (v % 3 === 0) { result.push({ id: k, value: v, tag: 'm")
+              .append(i).append("' }); }\n")
+              .append("        else if (v % 5 === 0) { result.push(String(v).padStart(8, '0')); }\n")
+              .append("        else { result.push(Math.round(Math.sqrt(v) * 100) / 100); }\n")
+              .append("    }\n")
+              .append("    return result.filter(function(x) { return x !== null; });\n")
+              .append("};\n");
+        }
+        sb.append("var input = [1, 2, 3, 4, 5, 6, 7, 8];\n");
+        sb.append("for (var i = 0; i < ").append(functions).append("; i += 4) {\n")
+          .append("    modules['m' + i](input);\n")
+          .append("}\n");
+        return sb.toString();
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webjetstream;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Runs a small JetStream style subset of compute kernels in a headless
+ * WebEngine and reports, for each kernel, the time of the first iteration,
+ * the mean of the four worst later iterations and the mean of all later
+ * iterations.
+ * <p>
+ * The first iteration mostly measures the interpreter and baseline JIT,
+ * the later ones show how well the optimizing tiers (DFG, FTL and, for
+ * the WebAssembly kernels, BBQ and OMG) kick in.  The WebAssembly kernels
+ * are skipped if WebAssembly is not available.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java -Dcom.sun.webkit.useDFGJIT=true [-Dcom.sun.webkit.useFTLJIT=false] \
+ *       webjetstream.JetStreamBenchmark [iterations]
+ * </pre>
+ */
+public class JetStreamBenchmark {
+
+    // A module exporting mix(n), an integer mixing loop, and memsum(n),
+    // a loop over 64 KB of linear memory that needs bounds checks
+    private static final String WASM_MODULE =
+            "AGFzbQEAAAABBgFgAX8BfwMDAgAABQMBAAEHEAIDbWl4AAAGbWVtc3VtAAEKZgIm"
+            + "AQJ/AkADQCABIABPDQEgAkEfbCABcyECIAFBAWohAQwACwsgAgs9AQN/AkADQCAB"
+            + "IABPDQEgAUH//wBxQQJ0IgMgAygCACABajYCACACIAMoAgBqIQIgAUEBaiEBDAAL"
+            + "CyACCw==";
+
+    private static final String HARNESS = """
+            var kernels = {
+                "nbody": function() {
+                    var PI = Math.PI, SOLAR_MASS = 4 * PI * PI, DAYS = 365.24;
+                    var b = [
+                        [0, 0, 0, 0, 0, 0, SOLAR_MASS],
+                        [4.84, -1.16, -0.10, 1.66e-3 * DAYS, 7.69e-3 * DAYS, -6.90e-5 * DAYS, 9.54e-4 * SOLAR_MASS],
+                        [8.34, 4.12, -0.40, -2.76e-3 * DAYS, 4.99e-3 * DAYS, 2.30e-5 * DAYS, 2.85e-4 * SOLAR_MASS],
+                        [12.89, -15.11, -0.22, 2.96e-3 * DAYS, 2.37e-3 * DAYS, -2.96e-5 * DAYS, 4.36e-5 * SOLAR_MASS],
+                        [15.37, -25.91, 0.17, 2.68e-3 * DAYS, 1.62e-3 * DAYS, -9.51e-5 * DAYS, 5.15e-5 * SOLAR_MASS]
+                    ];
+                    for (var step = 0; step < 200000; step++) {
+                        for (var i = 0; i < 5; i++) {
+                            var bi = b[i];
+                            for (var j = i + 1; j < 5; j++) {
+                                var bj = b[j];
+                                var dx = bi[0] - bj[0], dy = bi[1] - bj[1], dz = bi[2] - bj[2];
+                                var d2 = dx * dx + dy * dy + dz * dz;
+                                var mag = 0.01 / (d2 * Math.sqrt(d2));
+                                bi[3] -= dx * bj[6] * mag; bi[4] -= dy * bj[6] * mag; bi[5] -= dz * bj[6] * mag;
+                                bj[3] += dx * bi[6] * mag; bj[4] += dy * bi[6] * mag; bj[5] += dz * bi[6] * mag;
+                            }
+                        }
+                        for (var k = 0; k < 5; k++) {
+                            b[k][0] += 0.01 * b[k][3]; b[k][1] += 0.01 * b[k][4]; b[k][2] += 0.01 * b[k][5];
+                        }
+                    }
+                    return b[0][0];
+                },
+                "hash": function() {
+                    var h = 0x811c9dc5;
+                    for (var r = 0; r < 400; r++) {
+                        for (var i = 0; i < 4096; i++) {
+                            h = Math.imul(h ^ ((i * r) & 0xff), 16777619);
+                            h = (h << 13) | (h >>> 19);
+                        }
+                    }
+                    return h;
+                },
+                "splay": function() {
+                    function Node(key, left, right) { this.key = key; this.left = left; this.right = right; }
+                    function insert(node, key) {
+                        if (!node) return new Node(key, null, null);
+                        if (key < node.key) node.left = insert(node.left, key);
+                        else node.right = insert(node.right, key);
+                        return node;
+                    }
+                    function depth(node) {
+                        return node ? 1 + Math.max(depth(node.left), depth(node.right)) : 0;
+                    }
+                    var seed = 49734321, max = 0;
+                    for (var t = 0; t < 20; t++) {
+                        var root = null;
+                        for (var i = 0; i < 5000; i++) {
+                            seed = (Math.imul(seed, 1103515245) + 12345) | 0;
+                            root = insert(root, seed >>> 8);
+                        }
+                        max = Math.max(max, depth(root));
+                    }
+                    return max;
+                },
+                "regexp": function() {
+                    var text = "";
+                    for (var i = 0; i < 2000; i++) {
+                        text += "var x" + i + " = foo(" + i + ", 'str" + i + "') + 0x" + i.toString(16) + ";\\n";
+                    }
+                    var re = /([A-Za-z_]\\w*)|(0x[0-9a-f]+|\\d+)|('[^']*')|(\\S)/g, count = 0;
+                    for (var r = 0; r < 10; r++) {
+                        re.lastIndex = 0;
+                        while (re.exec(text)) {
+                            count++;
+                        }
+                    }
+                    return count;
+                }
+            };
+
+            if (typeof WebAssembly === "object") {
+                var wasm = new WebAssembly.Instance(new WebAssembly.Module(
+                        Uint8Array.from(atob(WASM_MODULE), function(c) { return c.charCodeAt(0); }))).exports;
+                kernels["wasm-mix"] = function() { return wasm.mix(20000000); };
+                kernels["wasm-memsum"] = function() { return wasm.memsum(10000000); };
+            }
+
+            function runIteration(name) {
+                var start = performance.now();
+                kernels[name]();
+                return performance.now() - start;
+            }
+            """;
+
+    public static void main(String[] args) throws Exception {
+        int iterations = args.length > 0 ? Integer.parseInt(args[0]) : 20;
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<WebEngine> loaded = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.getLoadWorker().stateProperty().addListener((ov, oldValue, newValue) -> {
+                if (newValue == Worker.State.SUCCEEDED) {
+                    loaded.complete(engine);
+                } else if (newValue == Worker.State.FAILED) {
+                    loaded.completeExceptionally(engine.getLoadWorker().getException());
+                }
+            });
+            engine.loadContent("<html><body><script>var WASM_MODULE = '" + WASM_MODULE + "';\n"
+                    + HARNESS + "</script></body></html>");
+        });
+        WebEngine engine = loaded.get();
+
+        String[] names = call(engine, () -> (String) engine.executeScript(
+                "Object.keys(kernels).join(',')")).split(",");
+        boolean wasm = call(engine, () -> (Boolean) engine.executeScript(
+                "typeof WebAssembly === 'object'"));
+        System.out.printf("%d iterations, WebAssembly %s%n", iterations,
+                wasm ? "enabled" : "not available");
+        System.out.printf("%-12s %10s %10s %10s%n", "kernel", "first", "worst", "average");
+
+        List<Double> scores = new ArrayList<>();
+        for (String name : names) {
+            double[] times = new double[iterations];
+            for (int i = 0; i < iterations; i++) {
+                times[i] = call(engine, () -> ((Number) engine.executeScript(
+                        "runIteration('" + name + "')")).doubleValue());
+            }
+            double first = times[0];
+            double[] rest = Arrays.copyOfRange(times, 1, times.length);
+            Arrays.sort(rest);
+            double worst = mean(rest, Math.max(0, rest.length - 4), rest.length);
+            double average = mean(rest, 0, rest.length);
+            System.out.printf("%-12s %8.1f ms %7.1f ms %7.1f ms%n", name, first, worst, average);
+            scores.add(Math.cbrt(first * worst * average));
+        }
+        double log = 0;
+        for (double s : scores) {
+            log += Math.log(s);
+        }
+        System.out.printf("geometric mean: %.1f ms%n", Math.exp(log / scores.size()));
+        Platform.exit();
+    }
+
+    private static double mean(double[] values, int from, int to) {
+        if (from >= to) {
+            return Double.NaN;
+        }
+        double sum = 0;
+        for (int i = from; i < to; i++) {
+            sum += values[i];
+        }
+        return sum / (to - from);
+    }
+
+    private interface Script<T> {
+        T run();
+    }
+
+    private static <T> T call(WebEngine engine, Script<T> script) throws Exception {
+        CompletableFuture<T> result = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            try {
+                result.complete(script.run());
+            } catch (RuntimeException e) {
+                result.completeExceptionally(e);
+            }
+        });
+        return result.get();
+    }
+}
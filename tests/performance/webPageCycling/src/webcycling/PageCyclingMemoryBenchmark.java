@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webcycling;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+
+import javafx.application.Platform;
+import javafx.beans.value.ChangeListener;
+import javafx.beans.value.ObservableValue;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Loads a sequence of different pages into one headless WebEngine, the way
+ * a long-running kiosk cycles through its screens, and reports how the
+ * resident set size of the process evolves.
+ * <p>
+ * Each page builds a large DOM, allocates short and long lived script
+ * objects of many sizes and draws into a canvas.  The live set stays
+ * about the same from one page to the next, so growth of the resident
+ * set size over time is mostly fragmentation in the native allocator.
+ * Run it once with the default allocator and once with the environment
+ * variable {@code Malloc=1} set, which makes bmalloc use the system
+ * malloc, to compare them.
+ * <p>
+ * The resident set size is read from /proc/self/status and is only
+ * available on Linux.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java webcycling.PageCyclingMemoryBenchmark [cycles] [reportEvery]
+ * </pre>
+ */
+public class PageCyclingMemoryBenchmark {
+
+    public static void main(String[] args) throws Exception {
+        int cycles = args.length > 0 ? Integer.parseInt(args[0]) : 2000;
+        int reportEvery = args.length > 1 ? Integer.parseInt(args[1]) : 100;
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<WebEngine> created = new CompletableFuture<>();
+        Platform.runLater(() -> created.complete(new WebEngine()));
+        WebEngine engine = created.get();
+
+        System.out.printf("%d cycles, system malloc %s%n", cycles,
+                System.getenv("Malloc") != null ? "forced" : "not forced");
+        System.out.printf("%8s %10s %10s %10s %10s%n",
+                "cycle", "rss", "peak rss", "java heap", "ms/page");
+
+        long baseline = -1;
+        long start = System.nanoTime();
+        for (int i = 1; i <= cycles; i++) {
+            load(engine, createPage(i));
+            if (i % reportEvery == 0) {
+                long time = System.nanoTime() - start;
+                long rss = readStatus("VmRSS:");
+                if (baseline < 0) {
+                    baseline = rss;
+                }
+                Runtime rt = Runtime.getRuntime();
+                System.out.printf("%8d %7d MB %7d MB %7d MB %10.1f%n", i,
+                        rss >> 10, readStatus("VmHWM:") >> 10,
+                        (rt.totalMemory() - rt.freeMemory()) >> 20,
+                        time / 1e6 / reportEvery);
+                start = System.nanoTime();
+            }
+        }
+        long rss = readStatus("VmRSS:");
+        if (baseline > 0) {
+            System.out.printf("rss growth after the first report: %d MB%n", (rss - baseline) >> 10);
+        }
+        Platform.exit();
+    }
+
+    private static void load(WebEngine engine, String content) throws Exception {
+        CompletableFuture<Void> loaded = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            ChangeListener<Worker.State> listener = new ChangeListener<>() {
+                @Override
+                public void changed(ObservableValue<? extends Worker.State> ov,
+                        Worker.State oldValue, Worker.State newValue) {
+                    if (newValue == Worker.State.SUCCEEDED) {
+                        ov.removeListener(this);
+                        loaded.complete(null);
+                    } else if (newValue == Worker.State.FAILED) {
+                        ov.removeListener(this);
+                        loaded.completeExceptionally(engine.getLoadWorker().getException());
+                    }
+                }
+            };
+            engine.getLoadWorker().stateProperty().addListener(listener);
+            engine.loadContent(content);
+        });
+        loaded.get();
+    }
+
+    // Returns the value of a /proc/self/status field in KB, or 0
+    private static long readStatus(String field) {
+        try {
+            for (String line : Files.readAllLines(Path.of("/proc/self/status"))) {
+                if (line.startsWith(field)) {
+                    return Long.parseLong(line.substring(field.length()).trim().split("\\s+")[0]);
+                }
+            }
+        } catch (IOException | NumberFormatException e) {
+            // Not Linux
+        }
+        return 0;
+    }
+
+    private static String createPage(int cycle) {
+        // Vary the sizes from page to page so that freed memory has to be
+        // reused for objects of other size classes
+        int rows = 200 + (cycle * 37) % 400;
+        int words = 3 + cycle % 7;
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><head><style>td.c").append(cycle % 13)
+                .append(" { color: #").append(Integer.toHexString(0x100000 + cycle * 4099 % 0xefffff))
+                .append(" }</style></head><body><table>");
+        for (int r = 0; r < rows; r++) {
+            sb.append("<tr><td class='c").append(r % 13).append("'>");
+            for (int w = 0; w < words; w++) {
+                sb.append("word").append((r * 31 + w * 7 + cycle) % 1000).append(' ');
+            }
+            sb.append("</td><td>").append(r * cycle).append("</td></tr>");
+        }
+        sb.append("</table><canvas id='c' width='512' height='512'></canvas><script>");
+        sb.append("var keep = [];");
+        sb.append("for (var i = 0; i < 20000; i++) {");
+        sb.append("  var o = { id: i, name: 'item' + i + '-").append(cycle).append("',");
+        sb.append("          data: new Array(1 + (i * ").append(cycle % 17 + 1).append(") % 64) };");
+        sb.append("  if (i % 10 == 0) keep.push(o);");
+        sb.append("}");
+        sb.append("var s = ''; for (var i = 0; i < 2000; i++) s += String.fromCharCode(65 + i % 26);");
+        sb.append("var ctx = document.getElementById('c').getContext('2d');");
+        sb.append("for (var i = 0; i < 200; i++) {");
+        sb.append("  ctx.fillStyle = 'hsl(' + (i * 7) + ', 50%, 50%)';");
+        sb.append("  ctx.fillRect(i % 512, (i * 13) % 512, 40, 40);");
+        sb.append("  ctx.fillText(s.substr(i, 20), 10, i % 512);");
+        sb.append("}");
+        sb.append("var img = ctx.getImageData(0, 0, 256, 256);");
+        sb.append("</script></body></html>");
+        return sb.toString();
+    }
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package websocket;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.charset.StandardCharsets;
+import java.security.MessageDigest;
+import java.util.Base64;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+
+import netscape.javascript.JSObject;
+
+/**
+ * Measures WebSocket message rate and round trip latency in a WebEngine
+ * against an echo server on the loopback interface.
+ * <p>
+ * The page keeps a window of messages in flight and sends a new one for
+ * every echo it receives, so both the send and the receive path of the
+ * WebView socket implementation are exercised.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java websocket.WebSocketEchoBenchmark [messages] [size] [window] [rounds]
+ * </pre>
+ */
+public class WebSocketEchoBenchmark {
+
+    private static final String WEBSOCKET_GUID =
+            "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+    private static final String SCRIPT = """
+        function runBenchmark(url, count, size, inFlight) {
+            var ws = new WebSocket(url);
+            var padding = 'x'.repeat(Math.max(0, size - 24));
+            var sent = new Float64Array(count);
+            var latencies = new Float64Array(count);
+            var next = 0, done = 0, start = 0;
+            function send() {
+                sent[next] = performance.now();
+                ws.send(next + ':' + padding);
+                next++;
+            }
+            ws.onopen = function () {
+                start = performance.now();
+                while (next < Math.min(inFlight, count))
+                    send();
+            };
+            ws.onmessage = function (e) {
+                var seq = parseInt(e.data);
+                latencies[done++] = performance.now() - sent[seq];
+                if (next < count)
+                    send();
+                if (done == count) {
+                    var time = performance.now() - start;
+                    ws.close();
+                    latencies.sort();
+                    bench.report(time, latencies[count >> 1],
+                            latencies[Math.floor(count * 0.99)],
+                            latencies[count - 1]);
+                }
+            };
+            ws.onerror = function () { bench.fail('WebSocket error'); };
+        }
+        """;
+
+    public static class Bench {
+        private CompletableFuture<double[]> result;
+
+        public void report(double time, double p50, double p99, double max) {
+            result.complete(new double[] { time, p50, p99, max });
+        }
+
+        public void fail(String message) {
+            result.completeExceptionally(new IOException(message));
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        int messages = args.length > 0 ? Integer.parseInt(args[0]) : 50000;
+        int size = args.length > 1 ? Integer.parseInt(args[1]) : 128;
+        int window = args.length > 2 ? Integer.parseInt(args[2]) : 32;
+        int rounds = args.length > 3 ? Integer.parseInt(args[3]) : 5;
+
+        ServerSocket server = new ServerSocket(0, 50, InetAddress.getLoopbackAddress());
+        Thread acceptor = new Thread(() -> {
+            while (true) {
+                try {
+                    Socket socket = server.accept();
+                    Thread echo = new Thread(() -> echo(socket), "EchoServer");
+                    echo.setDaemon(true);
+                    echo.start();
+                } catch (IOException e) {
+                    return;
+                }
+            }
+        }, "EchoServerAcceptor");
+        acceptor.setDaemon(true);
+        acceptor.start();
+        String url = "ws://127.0.0.1:" + server.getLocalPort() + "/";
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<WebEngine> loaded = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            WebEngine engine = new WebEngine();
+            engine.getLoadWorker().stateProperty().addListener((ov, oldValue, newValue) -> {
+                if (newValue == Worker.State.SUCCEEDED) {
+                    loaded.complete(engine);
+                } else if (newValue == Worker.State.FAILED) {
+                    loaded.completeExceptionally(engine.getLoadWorker().getException());
+                }
+            });
+            engine.loadContent("<html><body><script>" + SCRIPT + "</script></body></html>");
+        });
+        WebEngine engine = loaded.get();
+
+        Bench bench = new Bench();
+        System.out.printf("%d messages of %d bytes, %d in flight, %d rounds%n",
+                messages, size, window, rounds);
+        for (int round = 0; round < rounds; round++) {
+            CompletableFuture<double[]> result = new CompletableFuture<>();
+            Platform.runLater(() -> {
+                bench.result = result;
+                JSObject win = (JSObject) engine.executeScript("window");
+                win.setMember("bench", bench);
+                win.call("runBenchmark", url, messages, size, window);
+            });
+            double[] r = result.get();
+            System.out.printf("round %d: %.1f ms, %.0f msg/s, latency p50 %.3f ms,"
+                    + " p99 %.3f ms, max %.3f ms%n",
+                    round, r[0], messages / (r[0] / 1000), r[1], r[2], r[3]);
+        }
+        Platform.exit();
+        server.close();
+    }
+
+    /**
+     * A minimal RFC 6455 echo server: completes the handshake, then sends
+     * every data frame back unmasked until the client closes.
+     */
+    private static void echo(Socket socket) {
+        try (socket) {
+            socket.setTcpNoDelay(true);
+            DataInputStream in = new DataInputStream(
+                    new BufferedInputStream(socket.getInputStream()));
+            OutputStream out = new BufferedOutputStream(socket.getOutputStream());
+
+            String key = null;
+            for (String line = readLine(in); !line.isEmpty(); line = readLine(in)) {
+                if (line.regionMatches(true, 0, "Sec-WebSocket-Key:", 0, 18)) {
+                    key = line.substring(18).trim();
+                }
+            }
+            MessageDigest sha1 = MessageDigest.getInstance("SHA-1");
+            String accept = Base64.getEncoder().encodeToString(sha1.digest(
+                    (key + WEBSOCKET_GUID).getBytes(StandardCharsets.US_ASCII)));
+            out.write(("HTTP/1.1 101 Switching Protocols\r\n"
+                    + "Upgrade: websocket\r\n"
+                    + "Connection: Upgrade\r\n"
+                    + "Sec-WebSocket-Accept: " + accept + "\r\n\r\n")
+                    .getBytes(StandardCharsets.US_ASCII));
+            out.flush();
+
+            byte[] payload = new byte[0];
+            byte[] mask = new byte[4];
+            while (true) {
+                int b0 = in.readUnsignedByte();
+                int b1 = in.readUnsignedByte();
+                long len = b1 & 0x7f;
+                if (len == 126) {
+                    len = in.readUnsignedShort();
+                } else if (len == 127) {
+                    len = in.readLong();
+                }
+                if ((b1 & 0x80) != 0) {
+                    in.readFully(mask);
+                }
+                if (payload.length < len) {
+                    payload = new byte[(int) len];
+                }
+                in.readFully(payload, 0, (int) len);
+                for (int i = 0; (b1 & 0x80) != 0 && i < len; i++) {
+                    payload[i] ^= mask[i & 3];
+                }
+
+                out.write(b0);
+                if (len < 126) {
+                    out.write((int) len);
+                } else if (len < 65536) {
+                    out.write(126);
+                    out.write((int) (len >> 8));
+                    out.write((int) len);
+                } else {
+                    out.write(127);
+                    for (int shift = 56; shift >= 0; shift -= 8) {
+                        out.write((int) (len >> shift));
+                    }
+                }
+                out.write(payload, 0, (int) len);
+                // Batch the echoes of frames that arrived together
+                if (in.available() == 0) {
+                    out.flush();
+                }
+                if ((b0 & 0x0f) == 0x8) {
+                    out.flush();
+                    return;
+                }
+            }
+        } catch (Exception e) {
+            // The client went away
+        }
+    }
+
+    private static String readLine(DataInputStream in) throws IOException {
+        StringBuilder sb = new StringBuilder();
+        int c;
+        while ((c = in.read()) != -1 && c != '\n') {
+            if (c != '\r') {
+                sb.append((char) c);
+            }
+        }
+        return sb.toString();
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webtable;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.logging.Level;
+import java.util.logging.Logger;
+
+import com.sun.webkit.perf.WCFontPerfLogger;
+
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Lays out a large HTML table in a WebView and reports, for each layout,
+ * how long it takes and how many calls WebKit made into the Java fonts.
+ * <p>
+ * Every layout after the first one uses a new font size, so the glyph
+ * widths and bounds have to be fetched again from the fonts.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java --add-exports javafx.web/com.sun.webkit.perf=ALL-UNNAMED \
+ *       webtable.WebTableLayoutBenchmark [rows] [layouts]
+ * </pre>
+ */
+public class WebTableLayoutBenchmark {
+
+    private static final String[] WORDS = {
+        "alpha", "Bravo", "charlie", "DELTA", "echo", "foxtrot", "Golf",
+        "hotel", "India", "juliett", "kilo", "LIMA", "mike", "november",
+        "Oscar", "papa", "quebec", "Romeo", "sierra", "tango", "uniform",
+        "victor", "whiskey", "x-ray", "yankee", "zulu", "0123456789",
+        "Ærø", "Ģirts", "naïve", "façade", "Øresund", "Œuvre", "ß"
+    };
+
+    // Keeps the perf logger enabled, it must be set before fonts are created
+    private static final Logger FONT_LOGGER =
+            Logger.getLogger(WCFontPerfLogger.class.getName());
+
+    public static void main(String[] args) throws Exception {
+        int rows = args.length > 0 ? Integer.parseInt(args[0]) : 10000;
+        int layouts = args.length > 1 ? Integer.parseInt(args[1]) : 5;
+
+        FONT_LOGGER.setLevel(Level.FINE);
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<WebEngine> loaded = new CompletableFuture<>();
+        Platform.runLater(() -> {
+            WebView view = new WebView();
+            WebEngine engine = view.getEngine();
+            engine.getLoadWorker().stateProperty().addListener((ov, oldValue, newValue) -> {
+                if (newValue == Worker.State.SUCCEEDED) {
+                    loaded.complete(engine);
+                } else if (newValue == Worker.State.FAILED) {
+                    loaded.completeExceptionally(engine.getLoadWorker().getException());
+                }
+            });
+            Stage stage = new Stage();
+            stage.setScene(new Scene(view, 1024, 768));
+            stage.show();
+            engine.loadContent(createTable(rows));
+        });
+        WebEngine engine = loaded.get();
+
+        if (!WCFontPerfLogger.isEnabled()) {
+            System.err.println("Font perf logger is not enabled, calls are not counted");
+        }
+        System.out.printf("%d rows, %d layouts%n", rows, layouts);
+        for (int i = 0; i < layouts; i++) {
+            int fontSize = 12 + i;
+            CompletableFuture<long[]> result = new CompletableFuture<>();
+            Platform.runLater(() -> {
+                WCFontPerfLogger.reset();
+                long start = System.nanoTime();
+                // Reading offsetHeight forces a synchronous layout
+                engine.executeScript("document.body.style.fontSize = '" + fontSize + "px';"
+                        + "document.body.offsetHeight");
+                long time = System.nanoTime() - start;
+                result.complete(new long[] { time, WCFontPerfLogger.getCallCount() });
+            });
+            long[] r = result.get();
+            System.out.printf("layout %d (%dpx): %.1f ms, %d font calls, %.2f calls/row%n",
+                    i, fontSize, r[0] / 1e6, r[1], (double) r[1] / rows);
+        }
+        Platform.exit();
+    }
+
+    private static String createTable(int rows) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><body style='font-family: sans-serif'><table border='1'>");
+        for (int r = 0; r < rows; r++) {
+            sb.append("<tr><td>").append(r).append("</td>");
+            for (int c = 0; c < 4; c++) {
+                sb.append("<td>");
+                for (int w = 0; w < 3; w++) {
+                    sb.append(WORDS[(r * 7 + c * 3 + w) % WORDS.length]).append(' ');
+                }
+                sb.append(c == 1 ? "<b>" + r * 31 + "</b>" : "<i>" + c + "</i>");
+                sb.append("</td>");
+            }
+            sb.append("</tr>");
+        }
+        sb.append("</table></body></html>");
+        return sb.toString();
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webtext;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Lays out a long document mixing several languages and scripts in a
+ * WebView, the text break iterators being used for line breaking, and
+ * segments its text by word with {@code Intl.Segmenter}.
+ * <p>
+ * Each layout uses a different body width so that all the lines have to
+ * be broken again.
+ * <p>
+ * Usage:
+ * <pre>
+ *   java webtext.WebTextLayoutBenchmark [paragraphs] [layouts]
+ * </pre>
+ */
+public class WebTextLayoutBenchmark {
+
+    private static final String[][] TEXTS = {
+        { "en", "The quick brown fox jumps over the lazy dog while the band plays on." },
+        { "de", "Falsches Üben von Xylophonmusik quält jeden größeren Zwerg im Straßenverkehr." },
+        { "fr", "Portez ce vieux whisky au juge blond qui fume, l'été à côté de l'église." },
+        { "ru", "Съешь же ещё этих мягких французских булок, да выпей чаю." },
+        { "el", "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία και τα γραφικά της αποτελέσματα." },
+        { "ja", "いろはにほへと ちりぬるを わかよたれそ つねならむ、日本語の文章を表示します。" },
+        { "zh", "我能吞下玻璃而不伤身体，这是一段用于测试换行的中文文本。" },
+        { "ko", "다람쥐 헌 쳇바퀴에 타고파, 한국어 문장의 줄바꿈을 시험합니다." },
+        { "th", "เป็นมนุษย์สุดประเสริฐเลิศคุณค่า กว่าบรรดาฝูงสัตว์เดรัจฉาน" },
+        { "ar", "نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ومغلف بجلد أزرق." },
+        { "he", "דג סקרן שט בים מאוכזב ולפתע מצא לו חברה איך הקליטה." },
+        { "hi", "ऋषियों को सताने वाले दुष्ट राक्षसों के राजा रावण का सर्वनाश करने वाले विष्णु।" },
+    };
+
+    public static void main(String[] args) throws Exception {
+        int paragraphs = args.length > 0 ? Integer.parseInt(args[0]) : 5000;
+        int layouts = args.length > 1 ? Integer.parseInt(args[1]) : 5;
+
+        CountDownLatch started = new CountDownLatch(1);
+        Platform.startup(started::countDown);
+        started.await();
+
+        CompletableFuture<WebEngine> loaded = new CompletableFuture<>();
+        long loadStart = System.nanoTime();
+        Platform.runLater(() -> {
+            WebView view = new WebView();
+            WebEngine engine = view.getEngine();
+            engine.getLoadWorker().stateProperty().addListener((ov, oldValue, newValue) -> {
+                if (newValue == Worker.State.SUCCEEDED) {
+                    loaded.complete(engine);
+                } else if (newValue == Worker.State.FAILED) {
+                    loaded.completeExceptionally(engine.getLoadWorker().getException());
+                }
+            });
+            Stage stage = new Stage();
+            stage.setScene(new Scene(view, 1024, 768));
+            stage.show();
+            engine.loadContent(createDocument(paragraphs));
+        });
+        WebEngine engine = loaded.get();
+        System.out.printf("%d paragraphs, load: %.1f ms%n",
+                paragraphs, (System.nanoTime() - loadStart) / 1e6);
+
+        for (int i = 0; i < layouts; i++) {
+            int width = 300 + 97 * i;
+            long time = runOnFxThread(() -> {
+                long start = System.nanoTime();
+                // Reading offsetHeight forces a synchronous layout
+                engine.executeScript("document.body.style.width = '" + width + "px';"
+                        + "document.body.offsetHeight");
+                return System.nanoTime() - start;
+            });
+            System.out.printf("layout %d (%dpx): %.1f ms%n", i, width, time / 1e6);
+        }
+
+        long time = runOnFxThread(() -> {
+            long start = System.nanoTime();
+            Object words = engine.executeScript(
+                    "var count = 0;"
+                    + "for (const p of document.querySelectorAll('p')) {"
+                    + "  const s = new Intl.Segmenter(p.lang, { granularity: 'word' });"
+                    + "  for (const w of s.segment(p.textContent)) {"
+                    + "    if (w.isWordLike) count++;"
+                    + "  }"
+                    + "}"
+                    + "count");
+            System.out.printf("segmented %s words, ", words);
+            return System.nanoTime() - start;
+        });
+        System.out.printf("%.1f ms%n", time / 1e6);
+        Platform.exit();
+    }
+
+    private interface Task {
+        long run();
+    }
+
+    private static long runOnFxThread(Task task) throws Exception {
+        CompletableFuture<Long> result = new CompletableFuture<>();
+        Platform.runLater(() -> result.complete(task.run()));
+        return result.get();
+    }
+
+    private static String createDocument(int paragraphs) {
+        StringBuilder sb = new StringBuilder();
+        sb.append("<html><head><meta charset='utf-8'></head><body>");
+        for (int i = 0; i < paragraphs; i++) {
+            String[] text = TEXTS[i % TEXTS.length];
+            String dir = text[0].equals("ar") || text[0].equals("he") ? "rtl" : "ltr";
+            sb.append("<p lang='").append(text[0]).append("' dir='").append(dir).append("'>");
+            for (int r = 0; r < 3; r++) {
+                sb.append(text[1]).append(' ');
+            }
+            sb.append(i).append("</p>");
+        }
+        sb.append("</body></html>");
+        return sb.toString();
+    }
+}
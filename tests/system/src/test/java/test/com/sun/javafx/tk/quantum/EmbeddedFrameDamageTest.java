@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.tk.quantum;
+
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
+import javax.swing.JFrame;
+import javax.swing.SwingUtilities;
+import javafx.animation.AnimationTimer;
+import javafx.application.Platform;
+import javafx.embed.swing.JFXPanel;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.shape.Rectangle;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import com.sun.javafx.tk.quantum.EmbeddedSceneShim;
+
+/**
+ * Embedded scenes always upload the whole frame, so the damage recorded
+ * for each rendered frame must not pile up in their scene state.
+ */
+public class EmbeddedFrameDamageTest {
+
+    private static final int FRAMES = 120;
+
+    private static JFrame frame;
+    private static JFXPanel jfxPanel;
+
+    @BeforeAll
+    public static void init() throws Exception {
+        CountDownLatch initLatch = new CountDownLatch(1);
+        SwingUtilities.invokeLater(() -> {
+            frame = new JFrame("Embedded frame damage test");
+            frame.setSize(200, 200);
+            jfxPanel = new JFXPanel();
+            frame.getContentPane().add(jfxPanel);
+            frame.setVisible(true);
+            initLatch.countDown();
+        });
+        assertTrue(initLatch.await(15, TimeUnit.SECONDS), "Timeout waiting for JFXPanel");
+    }
+
+    @AfterAll
+    public static void teardown() throws Exception {
+        if (frame != null) {
+            SwingUtilities.invokeLater(frame::dispose);
+        }
+    }
+
+    @Test
+    public void testFrameDamageStaysBounded() throws Exception {
+        CountDownLatch doneLatch = new CountDownLatch(1);
+        AtomicBoolean embedded = new AtomicBoolean();
+        AtomicInteger maxPending = new AtomicInteger();
+        Platform.runLater(() -> {
+            Rectangle rect = new Rectangle(20, 20);
+            Scene scene = new Scene(new Group(rect), 200, 200);
+            jfxPanel.setScene(scene);
+            embedded.set(EmbeddedSceneShim.isEmbedded(scene));
+            new AnimationTimer() {
+                private int frames;
+
+                @Override
+                public void handle(long now) {
+                    // Keep damaging a part of the scene on every pulse
+                    rect.setTranslateX(frames % 100);
+                    maxPending.accumulateAndGet(
+                            EmbeddedSceneShim.getPendingFrameDamageCount(scene), Math::max);
+                    if (++frames == FRAMES) {
+                        stop();
+                        doneLatch.countDown();
+                    }
+                }
+            }.start();
+        });
+        assertTrue(doneLatch.await(30, TimeUnit.SECONDS), "Timeout waiting for " + FRAMES + " frames");
+        assertTrue(embedded.get(), "Scene of the JFXPanel is not embedded");
+        assertTrue(maxPending.get() <= 1,
+                "Frame damage is queued up for an embedded scene: " + maxPending.get());
+    }
+}
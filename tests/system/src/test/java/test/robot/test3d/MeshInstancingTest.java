@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.robot.test3d;
+
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+import java.util.concurrent.TimeUnit;
+import javafx.application.ConditionalFeature;
+import javafx.application.Platform;
+import javafx.scene.AmbientLight;
+import javafx.scene.Group;
+import javafx.scene.Scene;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.PhongMaterial;
+import javafx.scene.shape.Box;
+import javafx.stage.Stage;
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.Timeout;
+import test.robot.testharness.VisualTestBase;
+
+/**
+ * Consecutive MeshViews sharing a mesh may be drawn with a single
+ * instanced draw call. Test that each of them keeps its own diffuse color.
+ */
+@Timeout(value=15000, unit=TimeUnit.MILLISECONDS)
+public class MeshInstancingTest extends VisualTestBase {
+
+    private static final int WIDTH = 200;
+    private static final int HEIGHT = 100;
+    private static final double BOX_SIZE = 60;
+    private static final double TOLERANCE = 0.07;
+
+    private Scene testScene;
+
+    @BeforeEach
+    @Override
+    public void doSetup() {
+        assumeTrue(Platform.isSupported(ConditionalFeature.SCENE3D));
+        super.doSetup();
+    }
+
+    private static Box createBox(double x, Color color) {
+        // Boxes of the same size share their mesh
+        Box box = new Box(BOX_SIZE, BOX_SIZE, BOX_SIZE);
+        box.setTranslateX(x);
+        box.setTranslateY(HEIGHT / 2);
+        box.setMaterial(new PhongMaterial(color));
+        return box;
+    }
+
+    @Test
+    public void testInstancesKeepTheirDiffuseColor() {
+        runAndWait(() -> {
+            // A white ambient light alone shows the diffuse colors unshaded
+            Group root = new Group(
+                    createBox(WIDTH / 4, Color.RED),
+                    createBox(3 * WIDTH / 4, Color.BLUE),
+                    new AmbientLight(Color.WHITE));
+
+            Stage testStage = getStage();
+            testStage.setTitle("Instanced MeshViews");
+            testScene = new Scene(root, WIDTH, HEIGHT, true);
+            testScene.setFill(Color.WHITE);
+            testStage.setScene(testScene);
+            testStage.show();
+        });
+        waitFirstFrame();
+        runAndWait(() -> {
+            assertColorEquals(Color.RED, getColor(testScene, WIDTH / 4, HEIGHT / 2), TOLERANCE);
+            assertColorEquals(Color.BLUE, getColor(testScene, 3 * WIDTH / 4, HEIGHT / 2), TOLERANCE);
+            assertColorEquals(Color.WHITE, getColor(testScene, WIDTH / 2, HEIGHT / 2), TOLERANCE);
+        });
+    }
+}